@@ -1,38 +1,53 @@
 #include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/action_map.hpp>
 #include <jage/engine/input/adapters/glfw.hpp>
+#include <jage/engine/input/adapters/glfw_gamepads.hpp>
+#include <jage/engine/input/binding.hpp>
 #include <jage/engine/input/contexts/glfw.hpp>
 #include <jage/engine/input/event.hpp>
 #include <jage/engine/input/event_formatters.hpp>
 #include <jage/engine/input/platforms/glfw.hpp>
+#include <jage/engine/logging/file_sink.hpp>
+#include <jage/engine/logging/logger.hpp>
 #include <jage/engine/scheduled_action.hpp>
 #include <jage/engine/time/clock.hpp>
 #include <jage/engine/time/durations.hpp>
 #include <jage/engine/time/events/snapshot.hpp>
 #include <jage/engine/time/hertz.hpp>
+#include <jage/engine/time/pacer.hpp>
 #include <jage/interop/glfw_glad.hpp>
-#include <jage/stdx/overloaded.hpp>
 
+#include <array>
 #include <chrono>
+#include <cstdint>
 #include <fmt/chrono.h>
 #include <fmt/format.h>
-#include <iostream>
 #include <string>
-#include <variant>
 using duration_type = jage::engine::time::durations::nanoseconds;
 
-auto operator<<(std::ostream &out,
-                const typename jage::engine::input::event<duration_type>
-                    &input_event) -> std::ostream & {
-  out << fmt::format("{}\n", input_event);
-  return out;
-}
-
-auto operator<<(std::ostream &out,
-                const jage::engine::time::events::snapshot<duration_type>
-                    &snapshot) -> std::ostream & {
-  out << fmt::format("{}", snapshot) << std::endl;
-  return out;
-}
+enum class demo_action : std::uint8_t {
+  quit,
+  toggle_cursor,
+  toggle_pause,
+  toggle_vsync,
+};
+
+using demo_binding = jage::engine::input::binding<demo_action>;
+
+static constexpr auto demo_actions =
+    jage::engine::input::action_map{std::array{
+        demo_binding{.input = jage::engine::input::keyboard::scancode::escape,
+                     .target = demo_action::quit},
+        demo_binding{.input = jage::engine::input::keyboard::scancode::l,
+                     .action = jage::engine::input::keyboard::action::release,
+                     .target = demo_action::toggle_cursor},
+        demo_binding{.input = jage::engine::input::keyboard::scancode::p,
+                     .action = jage::engine::input::keyboard::action::release,
+                     .target = demo_action::toggle_pause},
+        demo_binding{.input = jage::engine::input::keyboard::scancode::v,
+                     .action = jage::engine::input::keyboard::action::release,
+                     .target = demo_action::toggle_vsync},
+    }};
 
 auto main(int, char *[]) -> int {
   static constexpr auto frame_buffer_size_callback =
@@ -45,6 +60,10 @@ auto main(int, char *[]) -> int {
       jage::engine::containers::spmc::ring_buffer<event_type, 256>;
   auto event_buffer = buffer_type{};
 
+  auto logger = jage::engine::logging::logger<>{
+      jage::engine::logging::file_sink::standard_output()};
+  logger.start();
+
   using context_type =
       jage::engine::input::contexts::glfw<duration_type, buffer_type>;
   using platform_type = jage::engine::input::platforms::glfw<context_type>;
@@ -65,11 +84,13 @@ auto main(int, char *[]) -> int {
   platform.set_window_user_pointer(window, static_cast<void *>(&context));
 
   auto adapter = jage::engine::input::adapters::glfw<platform_type>{};
+  auto gamepads =
+      jage::engine::input::adapters::glfw_gamepads<platform_type>{};
   using jage::engine::time::operator""_Hz;
   auto refresh_rate = platform.refresh_rate();
   auto clock = jage::engine::time::clock<duration_type>{
       jage::engine::time::hertz{refresh_rate}};
-  adapter.initialize(window, platform, clock.real_time());
+  adapter.initialize(window, platform);
 
   std::ignore =
       gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
@@ -98,19 +119,20 @@ auto main(int, char *[]) -> int {
         average_loop_count +=
             (static_cast<double>(loop_count) - average_loop_count) /
             sample_count;
-        std::cout << "FPS: " << current_fps << '\n'
-                  << "Loop counter: " << loop_count << '\n'
-                  << "Avg. FPS: " << average_fps << '\n'
-                  << "Avg. Loop: " << average_loop_count << '\n'
-                  << "Event Count: " << average_event_count << '\n'
-                  << "Max Event Count: " << max_event_count << '\n'
-                  << current_snapshot << std::endl;
+        logger.log("FPS: {}\nLoop counter: {}\nAvg. FPS: {}\nAvg. Loop: {}\n"
+                   "Event Count: {}\nMax Event Count: {}\n",
+                   current_fps, loop_count, average_fps, average_loop_count,
+                   average_event_count, max_event_count);
+        logger.log("{}\n", current_snapshot);
         last_snapshot = current_snapshot;
         loop_count = 0UZ;
         max_event_count = std::max(max_event_count, average_event_count);
         average_event_count = 0.0;
       }};
 
+  auto pacer =
+      jage::engine::time::pacer<duration_type>{jage::engine::time::hertz{
+          refresh_rate}};
   auto last_real_time = clock.real_time();
   auto swap_interval = 1;
   while (!glfwWindowShouldClose(window)) {
@@ -124,6 +146,8 @@ auto main(int, char *[]) -> int {
     }
     glClear(GL_COLOR_BUFFER_BIT);
     glfwPollEvents();
+    gamepads.poll(window, platform);
+    context.flush();
     const auto write_index = event_buffer.write_head();
     const auto event_count =
         static_cast<double>(write_index) - static_cast<double>(read_index);
@@ -131,68 +155,50 @@ auto main(int, char *[]) -> int {
       auto next_input_event =
           event_buffer.read(read_index % event_buffer.capacity());
       ++read_index;
-      std::cout << next_input_event;
-      std::visit(
-          jage::stdx::overloaded{
-              [](auto &&) -> void {},
-              [&](jage::engine::input::keyboard::events::key_press key_press)
-                  -> void {
-                switch (key_press.scancode) {
-                case jage::engine::input::keyboard::scancode::escape:
-                  glfwSetWindowShouldClose(window, GLFW_TRUE);
-                  break;
-                case jage::engine::input::keyboard::scancode::l: {
-                  if (jage::engine::input::keyboard::action::release !=
-                      key_press.action) {
-                    break;
-                  }
-                  if (GLFW_CURSOR_DISABLED ==
-                      platform.get_input_mode(window, GLFW_CURSOR)) {
-                    std::cout << "enabling cursor\n";
-                    platform.set_input_mode(window, GLFW_CURSOR,
-                                            GLFW_CURSOR_NORMAL);
-                  } else {
-                    std::cout << "disabling cursor\n";
-                    platform.set_input_mode(window, GLFW_CURSOR,
-                                            GLFW_CURSOR_DISABLED);
-                  }
-                } break;
-                case jage::engine::input::keyboard::scancode::p: {
-                  if (jage::engine::input::keyboard::action::release !=
-                      key_press.action) {
-                    break;
-                  }
-                  const auto snapshot = clock.snapshot();
-                  const auto new_time_scale = 1.0 - 1.0 * snapshot.time_scale;
-                  std::cout << "setting time scale to " << new_time_scale
-                            << std::endl;
-                  clock.set_time_scale(new_time_scale);
-                  if (new_time_scale == 0) {
-                    output_snapshot.pause();
-                  } else {
-                    output_snapshot.resume();
-                  }
-                } break;
-                case jage::engine::input::keyboard::scancode::v: {
-                  if (jage::engine::input::keyboard::action::release !=
-                      key_press.action) {
-                    break;
-                  }
-                  if (swap_interval) {
-                    swap_interval = 0;
-                  } else {
-                    swap_interval = 1;
-                  }
-                  glfwSwapInterval(swap_interval);
-                } break;
-                default:
-                  break;
-                }
-              },
-          },
-          next_input_event.payload);
+      logger.log("{}\n", next_input_event);
+      const auto command = demo_actions.resolve(next_input_event);
+      if (not command) {
+        continue;
+      }
+      switch (*command) {
+      case demo_action::quit:
+        glfwSetWindowShouldClose(window, GLFW_TRUE);
+        break;
+      case demo_action::toggle_cursor:
+        if (GLFW_CURSOR_DISABLED ==
+            platform.get_input_mode(window, GLFW_CURSOR)) {
+          logger.log("enabling cursor\n");
+          platform.set_input_mode(window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+        } else {
+          logger.log("disabling cursor\n");
+          platform.set_input_mode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+        }
+        break;
+      case demo_action::toggle_pause: {
+        const auto snapshot = clock.snapshot();
+        const auto new_time_scale = 1.0 - 1.0 * snapshot.time_scale;
+        logger.log("setting time scale to {}\n", new_time_scale);
+        clock.set_time_scale(new_time_scale);
+        if (new_time_scale == 0) {
+          output_snapshot.pause();
+        } else {
+          output_snapshot.resume();
+        }
+      } break;
+      case demo_action::toggle_vsync:
+        if (swap_interval) {
+          swap_interval = 0;
+        } else {
+          swap_interval = 1;
+        }
+        glfwSwapInterval(swap_interval);
+        break;
+      }
     }
     glfwSwapBuffers(window);
+    if (0 == swap_interval) {
+      std::ignore = pacer.wait(clock.snapshot());
+    }
     ++loop_count;
     if (event_count > 0) {
       average_event_count +=
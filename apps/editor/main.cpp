@@ -1,12 +1,18 @@
 #include <jage/engine/containers/spmc/ring_buffer.hpp>
 #include <jage/engine/input/adapters/glfw.hpp>
+#include <jage/engine/input/adapters/glfw_gamepads.hpp>
 #include <jage/engine/input/contexts/glfw.hpp>
 #include <jage/engine/input/event.hpp>
 #include <jage/engine/input/event_formatters.hpp>
+#include <jage/engine/input/event_log.hpp>
+#include <jage/engine/input/latency_probe.hpp>
 #include <jage/engine/input/platforms/glfw.hpp>
+#include <jage/engine/logging/file_sink.hpp>
 #include <jage/engine/time/clock.hpp>
 #include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/frame_statistics.hpp>
 #include <jage/engine/time/events/snapshot.hpp>
+#include <jage/engine/time/frame_stats.hpp>
 #include <jage/engine/time/hertz.hpp>
 #include <jage/interop/glfw_glad.hpp>
 #include <jage/stdx/overloaded.hpp>
@@ -15,18 +21,32 @@
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <fmt/format.h>
 #include <print>
-#include <string>
+#include <span>
 #include <variant>
 #include <vector>
 
 using duration_type = jage::engine::time::durations::nanoseconds;
 using event_type = jage::engine::input::event<duration_type>;
+using latency_probe_type = jage::engine::input::latency_probe<event_type>;
+
+// In the order of event_type's payload alternatives.
+static constexpr auto payload_names =
+    std::array{"Key Press", "Click", "Cursor Position", "Cursor Motion",
+               "Horizontal Scroll", "Vertical Scroll", "Gamepad Button",
+               "Gamepad Axis"};
+static_assert(std::size(payload_names) ==
+              std::variant_size_v<event_type::payload_type>);
 
 auto draw_frame_stats_panel(
-    const jage::engine::time::events::snapshot<duration_type> &snap) -> void {
+    const jage::engine::time::events::snapshot<duration_type> &snap,
+    const jage::engine::time::events::frame_statistics<duration_type>
+        &statistics,
+    const latency_probe_type::statistics_type &latency) -> void {
   ImGui::Begin("Frame Stats");
   ImGui::Text("Frame: %lu", snap.frame);
   ImGui::Text("Time Scale: %.2f", snap.time_scale);
@@ -35,38 +55,56 @@ auto draw_frame_stats_panel(
   ImGui::Text("Elapsed Frames: %lu", snap.elapsed_frames);
   ImGui::Text("Accumulated Time: %.3f ms",
               snap.accumulated_time.count() / 1'000'000.0);
+  ImGui::Separator();
+  ImGui::Text("Window: %lu frames", statistics.frame_count);
+  ImGui::Text("Mean: %.3f ms", statistics.mean.count() / 1'000'000.0);
+  ImGui::Text("p50: %.3f ms", statistics.p50.count() / 1'000'000.0);
+  ImGui::Text("p95: %.3f ms", statistics.p95.count() / 1'000'000.0);
+  ImGui::Text("p99: %.3f ms", statistics.p99.count() / 1'000'000.0);
+  ImGui::Text("Max: %.3f ms", statistics.max.count() / 1'000'000.0);
+  ImGui::Separator();
+  ImGui::Text("Input Depth: p99 %lu, max %lu", latency.depth.p99,
+              latency.depth.max);
+  for (auto index = 0UZ; index < std::size(payload_names); ++index) {
+    const auto &payload = latency.payloads[index];
+    if (0U == payload.count) {
+      continue;
+    }
+    ImGui::Text("%s Latency: p50 %.3f ms, p99 %.3f ms, max %.3f ms",
+                payload_names[index], payload.p50.count() / 1'000'000.0,
+                payload.p99.count() / 1'000'000.0,
+                payload.max.count() / 1'000'000.0);
+  }
+  if (ImGui::Button("Export Input Latency")) {
+    const auto report = fmt::format("{}\n", latency);
+    jage::engine::logging::file_sink{"input_latency.txt"}.write(
+        std::as_bytes(std::span{report}));
+  }
   ImGui::End();
 }
 
 class event_log_panel {
-  std::size_t next_write_index_{};
-  std::array<std::optional<std::string>, 500> event_buffer_{};
+  jage::engine::input::event_log<event_type> log_;
 
 public:
-  auto push_back(const auto event) -> void {
-    event_buffer_[next_write_index_++ % 500] = fmt::format("{}", event);
-  }
+  explicit event_log_panel(const std::size_t history) : log_{history} {}
+
+  auto push_back(const event_type &event) -> void { log_.push(event); }
 
   auto draw() -> void {
     ImGui::Begin("Input Events");
-    ImGui::Text("Events: %zu", next_write_index_);
+    ImGui::Text("Events: %zu", log_.pushed());
     ImGui::Separator();
 
     if (ImGui::BeginChild("EventScroll", ImVec2(0, 0), ImGuiChildFlags_None,
                           ImGuiWindowFlags_HorizontalScrollbar)) {
-      const auto beginning_index =
-          next_write_index_ < 500 ? 0 : next_write_index_;
-      for (auto offset = 0UZ; offset < 500; ++offset) {
-        auto index = (beginning_index + offset) % 500;
-        const auto &entry = event_buffer_[index];
-
-        if (not entry.and_then(
-                [&](const auto &text) -> std::optional<std::string> {
-                  auto line = fmt::format("[{}]: {}", index, text);
-                  ImGui::TextUnformatted(line.c_str());
-                  return text;
-                })) [[unlikely]] {
-          break;
+      auto clipper = ImGuiListClipper{};
+      clipper.Begin(static_cast<int>(log_.size()));
+      while (clipper.Step()) {
+        for (auto row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+          const auto line = log_.text(static_cast<std::size_t>(row));
+          ImGui::TextUnformatted(std::data(line),
+                                 std::data(line) + std::size(line));
         }
       }
       if (ImGui::GetScrollY() >= ImGui::GetScrollMaxY()) {
@@ -81,11 +119,15 @@ public:
 static constexpr auto process_input_events = [](auto &read_index,
                                                 const auto &event_buffer,
                                                 auto &platform, auto window,
-                                                auto &event_display_panel) {
+                                                auto &event_display_panel,
+                                                auto &latency,
+                                                const auto &now) {
   const auto write_index = event_buffer.write_head();
+  latency.start_drain(now, write_index - read_index);
   while (read_index < write_index) {
     auto next_event = event_buffer.read(read_index % event_buffer.capacity());
     ++read_index;
+    latency.record(next_event);
     event_display_panel.push_back(next_event);
 
     std::visit(jage::stdx::overloaded{
@@ -144,9 +186,11 @@ auto main(int, char *[]) -> int {
   platform.set_window_user_pointer(window, static_cast<void *>(&context));
 
   auto adapter = jage::engine::input::adapters::glfw<platform_type>{};
+  auto gamepads =
+      jage::engine::input::adapters::glfw_gamepads<platform_type>{};
   using jage::engine::time::operator""_Hz;
   auto clock = jage::engine::time::clock<duration_type>{60_Hz};
-  adapter.initialize(window, platform, clock.real_time());
+  adapter.initialize(window, platform);
 
   platform.set_framebuffer_size_callback(window, frame_buffer_size_callback);
 
@@ -172,10 +216,16 @@ auto main(int, char *[]) -> int {
   ImGui_ImplOpenGL3_Init("#version 330");
 
   auto read_index = 0UZ;
-  auto input_events_display_panel = event_log_panel{};
+  constexpr auto event_history = 100'000UZ;
+  auto input_events_display_panel = event_log_panel{event_history};
+  auto frame_stats = jage::engine::time::frame_stats<240UZ, duration_type>{};
+  auto input_latency = latency_probe_type{};
+  const auto now = [&] { return context.timestamp(); };
 
   while (not platform.window_should_close(window)) {
     platform.poll_events();
+    gamepads.poll(window, platform);
+    context.flush();
 
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
@@ -183,9 +233,13 @@ auto main(int, char *[]) -> int {
 
     ImGui::DockSpaceOverViewport();
 
-    draw_frame_stats_panel(clock.snapshot());
+    const auto snapshot = clock.snapshot();
+    frame_stats.push(snapshot);
+    frame_stats.publish();
     process_input_events(read_index, event_buffer, platform, window,
-                         input_events_display_panel);
+                         input_events_display_panel, input_latency, now);
+    input_latency.publish();
+    draw_frame_stats_panel(snapshot, frame_stats.read(), input_latency.read());
     input_events_display_panel.draw();
 
     ImGui::Render();
@@ -78,4 +78,9 @@ if(DEFINED ENV{JAGE_ENABLE_SANITY_CHECKS})
   target_compile_definitions(jage_compiler_options INTERFACE -DJAGE_ENABLE_SANITY_CHECKS=1)
 endif()
 
+if(DEFINED ENV{JAGE_ENABLE_INPUT_LATENCY})
+  message("Turning on input latency probes")
+  target_compile_definitions(jage_compiler_options INTERFACE -DJAGE_ENABLE_INPUT_LATENCY=1)
+endif()
+
 add_library(jage::compiler_options ALIAS jage_compiler_options)
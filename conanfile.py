@@ -31,6 +31,7 @@ class JAGERecipe(ConanFile):
         "imgui/1.91.8-docking",
         "range-v3/0.12.0",
         "assimp/5.4.3",
+        "benchmark/1.9.1",
     )
 
     def set_sanitizers_(self):
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace jage::engine::concurrency {
+// Unpadded single-writer slot for small trivially copyable values. Several
+// slots share a cache line, unlike double_buffer which pads each one.
+template <class T, template <class> class TAtomic = std::atomic>
+  requires std::is_trivially_copyable_v<T> and
+           (sizeof(T) % sizeof(std::uint64_t) == 0UZ)
+class seqlock {
+  using word_array_ =
+      std::array<std::uint64_t, sizeof(T) / sizeof(std::uint64_t)>;
+
+  TAtomic<std::uint64_t> sequence_{0U};
+  std::array<TAtomic<std::uint64_t>, std::tuple_size_v<word_array_>> words_{};
+
+  template <std::size_t... Indices>
+  [[nodiscard]] auto load_words(std::index_sequence<Indices...>) const
+      -> word_array_ {
+    return {words_[Indices].load(std::memory_order::acquire)...};
+  }
+
+public:
+  [[nodiscard]] auto read() const -> T {
+    while (true) {
+      const auto sequence = sequence_.load(std::memory_order::acquire);
+      if (sequence % 2U != 0U) [[unlikely]] {
+        continue;
+      }
+      const auto words = load_words(
+          std::make_index_sequence<std::tuple_size_v<word_array_>>{});
+      if (sequence_.load(std::memory_order::relaxed) == sequence) [[likely]] {
+        return std::bit_cast<T>(words);
+      }
+    }
+  }
+
+  auto write(const T &desired) -> void {
+    const auto sequence = sequence_.load(std::memory_order::relaxed);
+    sequence_.store(sequence + 1U, std::memory_order::relaxed);
+    const auto words = std::bit_cast<word_array_>(desired);
+    for (auto index = 0UZ; index < std::size(words); ++index) {
+      words_[index].store(words[index], std::memory_order::release);
+    }
+    sequence_.store(sequence + 2U, std::memory_order::release);
+  }
+};
+} // namespace jage::engine::concurrency
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <variant>
+
+namespace jage::engine::containers::spmc::internal::concepts {
+// Events carrying a variant payload with few enough alternatives that the
+// alternative's index fits in a byte.
+template <class TEvent>
+concept tagged_event =
+    requires(const TEvent &event) {
+      { event.payload.index() } -> std::same_as<std::size_t>;
+    } and std::variant_size_v<decltype(TEvent::payload)> < 256UZ;
+} // namespace jage::engine::containers::spmc::internal::concepts
@@ -2,22 +2,34 @@
 #include <jage/engine/memory/cacheline_size.hpp>
 
 #include <jage/engine/concurrency/internal/concepts/buffer.hpp>
+#include <jage/engine/containers/spmc/internal/concepts/tagged_event.hpp>
 
 #include <array>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 #if defined(JAGE_ENABLE_SANITY_CHECKS) and JAGE_ENABLE_SANITY_CHECKS == 1
 #include <stdexcept>
 #endif
 
 namespace jage::engine::containers::spmc::internal {
+// When TEvent has a variant payload, push also records the payload's index in
+// a byte per slot, so a consumer can tell which slots it wants from tag()
+// without copying events out of the buffers.
 template <class TEvent, std::size_t Capacity, template <class> class TAtomic,
           template <class, template <class> class> class TBuffer>
   requires(concurrency::internal::concepts::buffer<TBuffer<TEvent, TAtomic>>)
 class ring_buffer {
+  struct no_tags_ {};
+  using tags_type_ =
+      std::conditional_t<concepts::tagged_event<TEvent>,
+                         std::array<TAtomic<std::uint8_t>, Capacity>, no_tags_>;
+
   alignas(memory::cacheline_size)
       std::array<TBuffer<TEvent, TAtomic>, Capacity> buffer_;
+  [[no_unique_address]] tags_type_ tags_;
   alignas(memory::cacheline_size) TAtomic<std::size_t> write_head_;
 
 public:
@@ -31,6 +43,11 @@ public:
 
   constexpr auto push(const TEvent &event) -> void {
     const auto head = write_head_.load(std::memory_order::relaxed);
+    if constexpr (concepts::tagged_event<TEvent>) {
+      tags_[head % Capacity].store(
+          static_cast<std::uint8_t>(event.payload.index()),
+          std::memory_order::relaxed);
+    }
     buffer_[head % Capacity].write(event);
     write_head_.store(head + 1, std::memory_order::release);
   }
@@ -44,5 +61,20 @@ public:
 #endif
     return buffer_[index].read();
   }
+
+  // The payload index of the event last pushed to slot index. Like read(),
+  // it is only meaningful for slots below write_head(); a slot the producer
+  // has since reused reports the newer event's tag.
+  [[nodiscard]] auto tag(const std::size_t index) const -> std::uint8_t
+    requires(concepts::tagged_event<TEvent>)
+  {
+#if defined(JAGE_ENABLE_SANITY_CHECKS) and JAGE_ENABLE_SANITY_CHECKS == 1
+    if (index >= Capacity) {
+      throw std::invalid_argument{
+          "Index is greater than capacity of ring buffer"};
+    }
+#endif
+    return tags_[index].load(std::memory_order::relaxed);
+  }
 };
 } // namespace jage::engine::containers::spmc::internal
\ No newline at end of file
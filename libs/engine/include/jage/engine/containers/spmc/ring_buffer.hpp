@@ -1,6 +1,7 @@
 #pragma once
 
 #include <jage/engine/concurrency/double_buffer.hpp>
+#include <jage/engine/concurrency/seqlock.hpp>
 
 #include <jage/engine/containers/spmc/internal/ring_buffer.hpp>
 
@@ -11,4 +12,8 @@ namespace jage::engine::containers::spmc {
 template <class TEvent, std::size_t Capacity>
 using ring_buffer = internal::ring_buffer<TEvent, Capacity, std::atomic,
                                           concurrency::double_buffer>;
-}
\ No newline at end of file
+
+template <class TEvent, std::size_t Capacity>
+using packed_ring_buffer = internal::ring_buffer<TEvent, Capacity, std::atomic,
+                                                 concurrency::seqlock>;
+} // namespace jage::engine::containers::spmc
\ No newline at end of file
@@ -48,6 +48,18 @@ public:
     tail_.store(tail_index + 1, std::memory_order::release);
   }
 
+  // Leaves a full queue alone and returns false where push() would overwrite
+  // the oldest event, so the producer never touches the consumer's head.
+  [[nodiscard]] auto try_push(TEvent &&event) -> bool {
+    const auto tail_index = tail_.load(std::memory_order::relaxed);
+    if (tail_index - head_.load(std::memory_order::acquire) >= Capacity) {
+      return false;
+    }
+    buffer_[tail_index % Capacity] = std::forward<decltype(event)>(event);
+    tail_.store(tail_index + 1, std::memory_order::release);
+    return true;
+  }
+
   [[nodiscard]] auto front() const -> TEvent {
     return buffer_[head_.load(std::memory_order::acquire) % Capacity];
   }
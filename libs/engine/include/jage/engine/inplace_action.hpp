@@ -0,0 +1,122 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace jage::engine {
+
+static constexpr auto inplace_action_default_capacity = 24UZ;
+static constexpr auto inplace_action_default_alignment = alignof(void *);
+
+template <std::size_t Capacity = inplace_action_default_capacity,
+          std::size_t Alignment = inplace_action_default_alignment>
+class inplace_action {
+  struct operations_ {
+    void (*invoke)(std::byte *);
+    void (*copy)(std::byte *, const std::byte *);
+    void (*move)(std::byte *, std::byte *) noexcept;
+    void (*destroy)(std::byte *) noexcept;
+  };
+
+  static constexpr auto empty_operations_ = operations_{
+      .invoke = [](std::byte *) -> void {},
+      .copy = [](std::byte *, const std::byte *) -> void {},
+      .move = [](std::byte *, std::byte *) noexcept -> void {},
+      .destroy = [](std::byte *) noexcept -> void {},
+  };
+
+  template <class TCallable>
+  static constexpr auto callable_operations_ = operations_{
+      .invoke = [](std::byte *storage) -> void {
+        (*std::launder(reinterpret_cast<TCallable *>(storage)))();
+      },
+      .copy = [](std::byte *destination, const std::byte *source) -> void {
+        std::construct_at(
+            reinterpret_cast<TCallable *>(destination),
+            *std::launder(reinterpret_cast<const TCallable *>(source)));
+      },
+      .move = [](std::byte *destination, std::byte *source) noexcept -> void {
+        auto *source_callable =
+            std::launder(reinterpret_cast<TCallable *>(source));
+        std::construct_at(reinterpret_cast<TCallable *>(destination),
+                          std::move(*source_callable));
+        std::destroy_at(source_callable);
+      },
+      .destroy = [](std::byte *storage) noexcept -> void {
+        std::destroy_at(std::launder(reinterpret_cast<TCallable *>(storage)));
+      },
+  };
+
+  alignas(Alignment) std::array<std::byte, Capacity> storage_;
+  const operations_ *operations_{&empty_operations_};
+
+public:
+  inplace_action() noexcept = default;
+
+  template <class TCallable>
+    requires(not std::same_as<std::remove_cvref_t<TCallable>,
+                              inplace_action>) and
+            std::invocable<std::remove_cvref_t<TCallable> &>
+  inplace_action(TCallable &&callable) {
+    using callable_type = std::remove_cvref_t<TCallable>;
+    static_assert(sizeof(callable_type) <= Capacity,
+                  "Callable does not fit in inplace_action storage.");
+    static_assert(Alignment % alignof(callable_type) == 0UZ,
+                  "Callable alignment exceeds inplace_action alignment.");
+    static_assert(std::is_nothrow_move_constructible_v<callable_type>,
+                  "Callable must be nothrow move constructible.");
+    static_assert(std::is_copy_constructible_v<callable_type>,
+                  "Callable must be copy constructible.");
+    std::construct_at(reinterpret_cast<callable_type *>(std::data(storage_)),
+                      std::forward<TCallable>(callable));
+    operations_ = &callable_operations_<callable_type>;
+  }
+
+  inplace_action(const inplace_action &other)
+      : operations_{other.operations_} {
+    operations_->copy(std::data(storage_), std::data(other.storage_));
+  }
+
+  inplace_action(inplace_action &&other) noexcept
+      : operations_{other.operations_} {
+    operations_->move(std::data(storage_), std::data(other.storage_));
+    other.operations_ = &empty_operations_;
+  }
+
+  auto operator=(const inplace_action &other) -> inplace_action & {
+    if (this != &other) {
+      auto copy = other;
+      *this = std::move(copy);
+    }
+    return *this;
+  }
+
+  auto operator=(inplace_action &&other) noexcept -> inplace_action & {
+    if (this != &other) {
+      operations_->destroy(std::data(storage_));
+      operations_ = other.operations_;
+      operations_->move(std::data(storage_), std::data(other.storage_));
+      other.operations_ = &empty_operations_;
+    }
+    return *this;
+  }
+
+  ~inplace_action() { operations_->destroy(std::data(storage_)); }
+
+  auto operator()() -> void { operations_->invoke(std::data(storage_)); }
+
+  [[nodiscard]] explicit operator bool() const noexcept {
+    return operations_ != &empty_operations_;
+  }
+
+  [[nodiscard]] static constexpr auto capacity() noexcept -> std::size_t {
+    return Capacity;
+  }
+};
+
+} // namespace jage::engine
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <jage/engine/input/binding.hpp>
+#include <jage/engine/input/chord.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/mouse/action.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/stdx/overloaded.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace jage::engine::input {
+// Resolves input events to user actions through two dense tables: one byte
+// per (input, action) selects a row, and the row holds a target per chord.
+// A lookup is a fixed handful of loads, whatever the number of bindings.
+//
+// A binding for the exact chord held wins over one without a chord, so W can
+// fire with Shift held unless Shift+W is bound separately. Scancode bindings
+// win over key bindings for the same event.
+template <class TAction, std::size_t Capacity>
+  requires(std::is_enum_v<TAction> and Capacity < 255UZ)
+class action_map {
+  static constexpr auto action_count_ = 3UZ;
+  static constexpr auto chord_count_ = std::to_underlying(chord::all) + 1UZ;
+  static constexpr auto key_offset_ = keyboard::scancode_count;
+  static constexpr auto button_offset_ = key_offset_ + keyboard::key_count;
+  static constexpr auto input_count_ = button_offset_ + mouse::button_count;
+
+  static_assert(std::to_underlying(keyboard::action::repeat) + 1UZ ==
+                action_count_);
+  static_assert(std::to_underlying(mouse::action::press) ==
+                std::to_underlying(keyboard::action::press));
+  static_assert(std::to_underlying(mouse::action::release) ==
+                std::to_underlying(keyboard::action::release));
+
+  using row_type_ = std::array<std::uint8_t, chord_count_>;
+
+  std::array<std::uint8_t, input_count_ * action_count_> rows_by_input_{};
+  std::array<row_type_, Capacity + 1UZ> rows_{};
+  std::array<TAction, Capacity + 1UZ> targets_{};
+  std::size_t size_{};
+
+  [[nodiscard]] static constexpr auto
+  input_index(const std::variant<keyboard::scancode, keyboard::key,
+                                 mouse::button> &input) -> std::size_t {
+    return std::visit(
+        stdx::overloaded{
+            [](const keyboard::scancode input_scancode) -> std::size_t {
+              return std::to_underlying(input_scancode);
+            },
+            [](const keyboard::key input_key) -> std::size_t {
+              return key_offset_ + std::to_underlying(input_key);
+            },
+            [](const mouse::button input_button) -> std::size_t {
+              return button_offset_ + std::to_underlying(input_button);
+            },
+        },
+        input);
+  }
+
+  [[nodiscard]] constexpr auto
+  lookup(const std::size_t offset, const std::size_t code,
+         const std::size_t count, const std::size_t action,
+         const std::size_t held_chord) const noexcept -> std::uint8_t {
+    if (code >= count or action >= action_count_) [[unlikely]] {
+      return 0U;
+    }
+    const auto row = rows_by_input_[(offset + code) * action_count_ + action];
+    return rows_[row][held_chord];
+  }
+
+  [[nodiscard]] constexpr auto
+  target(const std::uint8_t slot) const noexcept -> std::optional<TAction> {
+    if (0U == slot) {
+      return std::nullopt;
+    }
+    return targets_[slot];
+  }
+
+public:
+  using action_type = TAction;
+  using binding_type = binding<TAction>;
+
+  constexpr action_map() = default;
+
+  constexpr explicit action_map(const std::span<const binding_type> bindings) {
+    reload(bindings);
+  }
+
+  // Replaces every binding. Throws std::invalid_argument, leaving the map
+  // empty, if there are more than Capacity bindings or two of them share an
+  // input, action and chord.
+  constexpr auto reload(const std::span<const binding_type> bindings) -> void {
+    rows_by_input_ = {};
+    rows_ = {};
+    targets_ = {};
+    size_ = 0UZ;
+    if (std::size(bindings) > Capacity) [[unlikely]] {
+      throw std::invalid_argument{"Too many bindings for action_map."};
+    }
+
+    auto row_count = 1UZ;
+    for (const auto &input_binding : bindings) {
+      const auto action = std::to_underlying(input_binding.action);
+      const auto held_chord = std::to_underlying(input_binding.chord);
+      if (action >= action_count_ or held_chord >= chord_count_) [[unlikely]] {
+        *this = {};
+        throw std::invalid_argument{"Binding has an unknown action or chord."};
+      }
+      auto &row = rows_by_input_[input_index(input_binding.input) *
+                                     action_count_ +
+                                 action];
+      if (0U == row) {
+        row = static_cast<std::uint8_t>(row_count++);
+      }
+      auto &slot = rows_[row][held_chord];
+      if (0U != slot) [[unlikely]] {
+        *this = {};
+        throw std::invalid_argument{"Input is bound twice."};
+      }
+      targets_[++size_] = input_binding.target;
+      slot = static_cast<std::uint8_t>(size_);
+    }
+
+    for (auto row = 1UZ; row < row_count; ++row) {
+      const auto unmodified = rows_[row][std::to_underlying(chord::none)];
+      for (auto &slot : rows_[row]) {
+        if (0U == slot) {
+          slot = unmodified;
+        }
+      }
+    }
+  }
+
+  [[nodiscard]] constexpr auto
+  resolve(const keyboard::events::key_press &key_press) const noexcept
+      -> std::optional<TAction> {
+    const auto held_chord = std::to_underlying(to_chord(key_press.modifiers));
+    const auto action = std::to_underlying(key_press.action);
+    const auto by_scancode =
+        lookup(0UZ, std::to_underlying(key_press.scancode),
+               keyboard::scancode_count, action, held_chord);
+    const auto by_key =
+        lookup(key_offset_, std::to_underlying(key_press.key),
+               keyboard::key_count, action, held_chord);
+    return target(0U != by_scancode ? by_scancode : by_key);
+  }
+
+  [[nodiscard]] constexpr auto
+  resolve(const mouse::events::click &click) const noexcept
+      -> std::optional<TAction> {
+    return target(lookup(button_offset_, std::to_underlying(click.button),
+                         mouse::button_count,
+                         std::to_underlying(click.action),
+                         std::to_underlying(to_chord(click.modifiers))));
+  }
+
+  template <class TTimeDuration>
+  [[nodiscard]] constexpr auto
+  resolve(const event<TTimeDuration> &input_event) const noexcept
+      -> std::optional<TAction> {
+    return std::visit(
+        stdx::overloaded{
+            [this](const keyboard::events::key_press &key_press)
+                -> std::optional<TAction> { return resolve(key_press); },
+            [this](const mouse::events::click &click)
+                -> std::optional<TAction> { return resolve(click); },
+            [](const auto &) -> std::optional<TAction> {
+              return std::nullopt;
+            },
+        },
+        input_event.payload);
+  }
+
+  [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+    return size_;
+  }
+
+  [[nodiscard]] static constexpr auto capacity() noexcept -> std::size_t {
+    return Capacity;
+  }
+};
+
+template <class TAction, std::size_t Size>
+action_map(const std::array<binding<TAction>, Size> &)
+    -> action_map<TAction, Size>;
+} // namespace jage::engine::input
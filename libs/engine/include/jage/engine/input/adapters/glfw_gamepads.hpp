@@ -0,0 +1,146 @@
+#pragma once
+
+#include <jage/engine/input/gamepad/action.hpp>
+#include <jage/engine/input/gamepad/axis.hpp>
+#include <jage/engine/input/gamepad/axis_filter.hpp>
+#include <jage/engine/input/gamepad/button.hpp>
+#include <jage/engine/input/gamepad/events/axis_motion.hpp>
+#include <jage/engine/input/gamepad/events/button_press.hpp>
+#include <jage/engine/input/gamepad/id.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace jage::engine::input::adapters {
+// GLFW only reports gamepads when asked, so poll() reads every joystick slot
+// once per frame and pushes just the buttons and axes that changed since the
+// previous poll. Axes go through an axis_filter first so an idle or steadily
+// held stick stays silent. A gamepad that disconnects reads as released and
+// centred, which releases whatever it held.
+//
+// Each gamepad is kept as 16 button bytes and 8 quantized axis levels, so a
+// poll compares it against the previous one with two 16-byte compares.
+template <class TPlatform> class glfw_gamepads {
+  using context_type_ = typename TPlatform::context_type;
+  using event_type_ = typename context_type_::event_type;
+  using duration_type_ = decltype(event_type_::timestamp);
+  using window_handle_pointer_type_ =
+      typename TPlatform::window_handle_pointer_type;
+
+  static constexpr auto lane_bytes_ = 16UZ;
+
+  struct alignas(lane_bytes_) snapshot_ {
+    std::array<std::uint8_t, lane_bytes_> buttons{};
+    std::array<std::int16_t, lane_bytes_ / sizeof(std::int16_t)> axes{};
+  };
+
+  static_assert(gamepad::button_count <= lane_bytes_);
+  static_assert(gamepad::axis_count <= lane_bytes_ / sizeof(std::int16_t));
+
+  std::array<snapshot_, gamepad::id_count> previous_{};
+  gamepad::axis_filter filter_{};
+
+  // One bit per byte that differs.
+  template <class TLanes>
+    requires(sizeof(TLanes) == lane_bytes_)
+  [[nodiscard]] static auto changed_bytes(const TLanes &previous,
+                                          const TLanes &current)
+      -> std::uint32_t {
+#if defined(__SSE2__)
+    const auto equal = _mm_cmpeq_epi8(
+        _mm_load_si128(reinterpret_cast<const __m128i *>(std::data(previous))),
+        _mm_load_si128(reinterpret_cast<const __m128i *>(std::data(current))));
+    return ~static_cast<std::uint32_t>(_mm_movemask_epi8(equal)) & 0xFFFFU;
+#else
+    using bytes_type = std::array<std::uint8_t, lane_bytes_>;
+    const auto previous_bytes = std::bit_cast<bytes_type>(previous);
+    const auto current_bytes = std::bit_cast<bytes_type>(current);
+    auto changed = std::uint32_t{};
+    for (auto index = 0UZ; index < lane_bytes_; ++index) {
+      if (previous_bytes[index] != current_bytes[index]) {
+        changed |= 1U << index;
+      }
+    }
+    return changed;
+#endif
+  }
+
+  [[nodiscard]] auto read(TPlatform &platform, const int jid) const
+      -> snapshot_ {
+    auto state = typename TPlatform::gamepad_state_type{};
+    auto snapshot = snapshot_{};
+    if (not platform.get_gamepad_state(jid, state)) {
+      return snapshot;
+    }
+    for (auto index = 0UZ; index < gamepad::button_count; ++index) {
+      snapshot.buttons[index] = 0U != state.buttons[index] ? 1U : 0U;
+    }
+    for (auto index = 0UZ; index < gamepad::axis_count; ++index) {
+      snapshot.axes[index] = filter_.quantize(static_cast<gamepad::axis>(index),
+                                              state.axes[index]);
+    }
+    return snapshot;
+  }
+
+public:
+  glfw_gamepads() = default;
+
+  explicit glfw_gamepads(const gamepad::axis_filter filter) : filter_{filter} {}
+
+  // Call once per frame, after polling window events. Returns the number of
+  // events pushed; they share the timestamp of the poll.
+  auto poll(window_handle_pointer_type_ window, TPlatform &platform)
+      -> std::size_t {
+    auto &context = *static_cast<context_type_ *>(
+        platform.get_window_user_pointer(window));
+    auto timestamp = std::optional<duration_type_>{};
+    const auto push = [&](auto &&payload) -> void {
+      if (not timestamp) {
+        timestamp = context.timestamp();
+      }
+      context.push(event_type_{.timestamp = *timestamp, .payload = payload});
+    };
+
+    auto pushed = 0UZ;
+    for (auto jid = 0UZ; jid < gamepad::id_count; ++jid) {
+      const auto current = read(platform, static_cast<int>(jid));
+      auto &previous = previous_[jid];
+      const auto id = static_cast<gamepad::id>(jid);
+      for (auto changed = changed_bytes(previous.buttons, current.buttons);
+           0U != changed; changed &= changed - 1U, ++pushed) {
+        const auto index = static_cast<std::size_t>(std::countr_zero(changed));
+        push(gamepad::events::button_press{
+            .gamepad = id,
+            .button = static_cast<gamepad::button>(index),
+            .action = 0U != current.buttons[index] ? gamepad::action::press
+                                                   : gamepad::action::release,
+        });
+      }
+      for (auto changed = changed_bytes(previous.axes, current.axes);
+           0U != changed; ++pushed) {
+        const auto index = static_cast<std::size_t>(std::countr_zero(changed)) /
+                           sizeof(std::int16_t);
+        changed &= ~(0b11U << (index * sizeof(std::int16_t)));
+        push(gamepad::events::axis_motion{
+            .gamepad = id,
+            .axis = static_cast<gamepad::axis>(index),
+            .value = filter_.value(current.axes[index]),
+        });
+      }
+      previous = current;
+    }
+    return pushed;
+  }
+
+  [[nodiscard]] auto filter() const noexcept -> const gamepad::axis_filter & {
+    return filter_;
+  }
+};
+} // namespace jage::engine::input::adapters
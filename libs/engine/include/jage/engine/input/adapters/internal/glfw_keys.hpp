@@ -0,0 +1,210 @@
+#pragma once
+
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/interop/glfw_glad.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace jage::engine::input::adapters::internal {
+struct glfw_key_binding {
+  int glfw_key;
+  keyboard::key key;
+  keyboard::scancode scancode;
+};
+
+inline constexpr auto glfw_key_bindings = std::to_array<glfw_key_binding>({
+    {GLFW_KEY_SPACE, keyboard::key::spacebar, keyboard::scancode::spacebar},
+    {GLFW_KEY_APOSTROPHE, keyboard::key::apostrophe,
+     keyboard::scancode::apostrophe},
+    {GLFW_KEY_COMMA, keyboard::key::comma, keyboard::scancode::comma},
+    {GLFW_KEY_MINUS, keyboard::key::minus, keyboard::scancode::minus},
+    {GLFW_KEY_PERIOD, keyboard::key::period, keyboard::scancode::period},
+    {GLFW_KEY_SLASH, keyboard::key::slash, keyboard::scancode::slash},
+    {GLFW_KEY_0, keyboard::key::_0, keyboard::scancode::_0},
+    {GLFW_KEY_1, keyboard::key::_1, keyboard::scancode::_1},
+    {GLFW_KEY_2, keyboard::key::_2, keyboard::scancode::_2},
+    {GLFW_KEY_3, keyboard::key::_3, keyboard::scancode::_3},
+    {GLFW_KEY_4, keyboard::key::_4, keyboard::scancode::_4},
+    {GLFW_KEY_5, keyboard::key::_5, keyboard::scancode::_5},
+    {GLFW_KEY_6, keyboard::key::_6, keyboard::scancode::_6},
+    {GLFW_KEY_7, keyboard::key::_7, keyboard::scancode::_7},
+    {GLFW_KEY_8, keyboard::key::_8, keyboard::scancode::_8},
+    {GLFW_KEY_9, keyboard::key::_9, keyboard::scancode::_9},
+    {GLFW_KEY_SEMICOLON, keyboard::key::semicolon,
+     keyboard::scancode::semicolon},
+    {GLFW_KEY_EQUAL, keyboard::key::equal, keyboard::scancode::equal},
+    {GLFW_KEY_A, keyboard::key::a, keyboard::scancode::a},
+    {GLFW_KEY_B, keyboard::key::b, keyboard::scancode::b},
+    {GLFW_KEY_C, keyboard::key::c, keyboard::scancode::c},
+    {GLFW_KEY_D, keyboard::key::d, keyboard::scancode::d},
+    {GLFW_KEY_E, keyboard::key::e, keyboard::scancode::e},
+    {GLFW_KEY_F, keyboard::key::f, keyboard::scancode::f},
+    {GLFW_KEY_G, keyboard::key::g, keyboard::scancode::g},
+    {GLFW_KEY_H, keyboard::key::h, keyboard::scancode::h},
+    {GLFW_KEY_I, keyboard::key::i, keyboard::scancode::i},
+    {GLFW_KEY_J, keyboard::key::j, keyboard::scancode::j},
+    {GLFW_KEY_K, keyboard::key::k, keyboard::scancode::k},
+    {GLFW_KEY_L, keyboard::key::l, keyboard::scancode::l},
+    {GLFW_KEY_M, keyboard::key::m, keyboard::scancode::m},
+    {GLFW_KEY_N, keyboard::key::n, keyboard::scancode::n},
+    {GLFW_KEY_O, keyboard::key::o, keyboard::scancode::o},
+    {GLFW_KEY_P, keyboard::key::p, keyboard::scancode::p},
+    {GLFW_KEY_Q, keyboard::key::q, keyboard::scancode::q},
+    {GLFW_KEY_R, keyboard::key::r, keyboard::scancode::r},
+    {GLFW_KEY_S, keyboard::key::s, keyboard::scancode::s},
+    {GLFW_KEY_T, keyboard::key::t, keyboard::scancode::t},
+    {GLFW_KEY_U, keyboard::key::u, keyboard::scancode::u},
+    {GLFW_KEY_V, keyboard::key::v, keyboard::scancode::v},
+    {GLFW_KEY_W, keyboard::key::w, keyboard::scancode::w},
+    {GLFW_KEY_X, keyboard::key::x, keyboard::scancode::x},
+    {GLFW_KEY_Y, keyboard::key::y, keyboard::scancode::y},
+    {GLFW_KEY_Z, keyboard::key::z, keyboard::scancode::z},
+    {GLFW_KEY_LEFT_BRACKET, keyboard::key::left_bracket,
+     keyboard::scancode::left_bracket},
+    {GLFW_KEY_BACKSLASH, keyboard::key::backslash,
+     keyboard::scancode::backslash},
+    {GLFW_KEY_RIGHT_BRACKET, keyboard::key::right_bracket,
+     keyboard::scancode::right_bracket},
+    {GLFW_KEY_GRAVE_ACCENT, keyboard::key::grave_accent,
+     keyboard::scancode::grave_accent},
+    {GLFW_KEY_WORLD_1, keyboard::key::world_1, keyboard::scancode::world_1},
+    {GLFW_KEY_WORLD_2, keyboard::key::world_2, keyboard::scancode::world_2},
+    {GLFW_KEY_ESCAPE, keyboard::key::escape, keyboard::scancode::escape},
+    {GLFW_KEY_ENTER, keyboard::key::enter, keyboard::scancode::enter},
+    {GLFW_KEY_TAB, keyboard::key::tab, keyboard::scancode::tab},
+    {GLFW_KEY_BACKSPACE, keyboard::key::backspace,
+     keyboard::scancode::backspace},
+    {GLFW_KEY_INSERT, keyboard::key::insert, keyboard::scancode::insert},
+    {GLFW_KEY_DELETE, keyboard::key::delete_key,
+     keyboard::scancode::delete_key},
+    {GLFW_KEY_RIGHT, keyboard::key::arrow_right,
+     keyboard::scancode::arrow_right},
+    {GLFW_KEY_LEFT, keyboard::key::arrow_left, keyboard::scancode::arrow_left},
+    {GLFW_KEY_DOWN, keyboard::key::arrow_down, keyboard::scancode::arrow_down},
+    {GLFW_KEY_UP, keyboard::key::arrow_up, keyboard::scancode::arrow_up},
+    {GLFW_KEY_PAGE_UP, keyboard::key::page_up, keyboard::scancode::page_up},
+    {GLFW_KEY_PAGE_DOWN, keyboard::key::page_down,
+     keyboard::scancode::page_down},
+    {GLFW_KEY_HOME, keyboard::key::home, keyboard::scancode::home},
+    {GLFW_KEY_END, keyboard::key::end, keyboard::scancode::end},
+    {GLFW_KEY_CAPS_LOCK, keyboard::key::caps_lock,
+     keyboard::scancode::caps_lock},
+    {GLFW_KEY_SCROLL_LOCK, keyboard::key::scroll_lock,
+     keyboard::scancode::scroll_lock},
+    {GLFW_KEY_PRINT_SCREEN, keyboard::key::print_screen,
+     keyboard::scancode::print_screen},
+    {GLFW_KEY_NUM_LOCK, keyboard::key::num_lock, keyboard::scancode::num_lock},
+    {GLFW_KEY_PAUSE, keyboard::key::pause, keyboard::scancode::pause},
+    {GLFW_KEY_F1, keyboard::key::F1, keyboard::scancode::F1},
+    {GLFW_KEY_F2, keyboard::key::F2, keyboard::scancode::F2},
+    {GLFW_KEY_F3, keyboard::key::F3, keyboard::scancode::F3},
+    {GLFW_KEY_F4, keyboard::key::F4, keyboard::scancode::F4},
+    {GLFW_KEY_F5, keyboard::key::F5, keyboard::scancode::F5},
+    {GLFW_KEY_F6, keyboard::key::F6, keyboard::scancode::F6},
+    {GLFW_KEY_F7, keyboard::key::F7, keyboard::scancode::F7},
+    {GLFW_KEY_F8, keyboard::key::F8, keyboard::scancode::F8},
+    {GLFW_KEY_F9, keyboard::key::F9, keyboard::scancode::F9},
+    {GLFW_KEY_F10, keyboard::key::F10, keyboard::scancode::F10},
+    {GLFW_KEY_F11, keyboard::key::F11, keyboard::scancode::F11},
+    {GLFW_KEY_F12, keyboard::key::F12, keyboard::scancode::F12},
+    {GLFW_KEY_F13, keyboard::key::F13, keyboard::scancode::F13},
+    {GLFW_KEY_F14, keyboard::key::F14, keyboard::scancode::F14},
+    {GLFW_KEY_F15, keyboard::key::F15, keyboard::scancode::F15},
+    {GLFW_KEY_F16, keyboard::key::F16, keyboard::scancode::F16},
+    {GLFW_KEY_F17, keyboard::key::F17, keyboard::scancode::F17},
+    {GLFW_KEY_F18, keyboard::key::F18, keyboard::scancode::F18},
+    {GLFW_KEY_F19, keyboard::key::F19, keyboard::scancode::F19},
+    {GLFW_KEY_F20, keyboard::key::F20, keyboard::scancode::F20},
+    {GLFW_KEY_F21, keyboard::key::F21, keyboard::scancode::F21},
+    {GLFW_KEY_F22, keyboard::key::F22, keyboard::scancode::F22},
+    {GLFW_KEY_F23, keyboard::key::F23, keyboard::scancode::F23},
+    {GLFW_KEY_F24, keyboard::key::F24, keyboard::scancode::F24},
+    {GLFW_KEY_F25, keyboard::key::execute, keyboard::scancode::execute},
+    {GLFW_KEY_KP_0, keyboard::key::kp_0, keyboard::scancode::kp_0},
+    {GLFW_KEY_KP_1, keyboard::key::kp_1, keyboard::scancode::kp_1},
+    {GLFW_KEY_KP_2, keyboard::key::kp_2, keyboard::scancode::kp_2},
+    {GLFW_KEY_KP_3, keyboard::key::kp_3, keyboard::scancode::kp_3},
+    {GLFW_KEY_KP_4, keyboard::key::kp_4, keyboard::scancode::kp_4},
+    {GLFW_KEY_KP_5, keyboard::key::kp_5, keyboard::scancode::kp_5},
+    {GLFW_KEY_KP_6, keyboard::key::kp_6, keyboard::scancode::kp_6},
+    {GLFW_KEY_KP_7, keyboard::key::kp_7, keyboard::scancode::kp_7},
+    {GLFW_KEY_KP_8, keyboard::key::kp_8, keyboard::scancode::kp_8},
+    {GLFW_KEY_KP_9, keyboard::key::kp_9, keyboard::scancode::kp_9},
+    {GLFW_KEY_KP_DECIMAL, keyboard::key::kp_decimal,
+     keyboard::scancode::kp_decimal},
+    {GLFW_KEY_KP_DIVIDE, keyboard::key::kp_divide,
+     keyboard::scancode::kp_divide},
+    {GLFW_KEY_KP_MULTIPLY, keyboard::key::kp_multiply,
+     keyboard::scancode::kp_multiply},
+    {GLFW_KEY_KP_SUBTRACT, keyboard::key::kp_subtract,
+     keyboard::scancode::kp_subtract},
+    {GLFW_KEY_KP_ADD, keyboard::key::kp_add, keyboard::scancode::kp_add},
+    {GLFW_KEY_KP_ENTER, keyboard::key::kp_enter, keyboard::scancode::kp_enter},
+    {GLFW_KEY_KP_EQUAL, keyboard::key::kp_equal, keyboard::scancode::kp_equal},
+    {GLFW_KEY_LEFT_SHIFT, keyboard::key::left_shift,
+     keyboard::scancode::left_shift},
+    {GLFW_KEY_LEFT_CONTROL, keyboard::key::left_control,
+     keyboard::scancode::left_control},
+    {GLFW_KEY_LEFT_ALT, keyboard::key::left_alt, keyboard::scancode::left_alt},
+    {GLFW_KEY_LEFT_SUPER, keyboard::key::left_super,
+     keyboard::scancode::left_super},
+    {GLFW_KEY_RIGHT_SHIFT, keyboard::key::right_shift,
+     keyboard::scancode::right_shift},
+    {GLFW_KEY_RIGHT_CONTROL, keyboard::key::right_control,
+     keyboard::scancode::right_control},
+    {GLFW_KEY_RIGHT_ALT, keyboard::key::right_alt,
+     keyboard::scancode::right_alt},
+    {GLFW_KEY_RIGHT_SUPER, keyboard::key::right_super,
+     keyboard::scancode::right_super},
+    {GLFW_KEY_MENU, keyboard::key::menu, keyboard::scancode::menu},
+});
+
+inline constexpr auto glfw_keys = [] {
+  auto keys = std::array<keyboard::key, GLFW_KEY_LAST + 1>{};
+  keys.fill(keyboard::key::unidentified);
+  for (const auto &binding : glfw_key_bindings) {
+    keys[static_cast<std::size_t>(binding.glfw_key)] = binding.key;
+  }
+  return keys;
+}();
+
+// GLFW_KEY_UNKNOWN is -1, so the unsigned compare also rejects it.
+[[nodiscard]] constexpr auto
+to_key(const int glfw_key) noexcept -> keyboard::key {
+  const auto index = static_cast<std::size_t>(glfw_key);
+  return index < std::size(glfw_keys) ? glfw_keys[index]
+                                      : keyboard::key::unidentified;
+}
+
+// OS scancodes are only known once GLFW is initialised. They stay below 0x200
+// on Windows and 0x80 on macOS; on Linux they are evdev codes plus 8.
+class glfw_scancode_table {
+  static constexpr auto capacity_ = 1024UZ;
+  std::array<keyboard::scancode, capacity_> scancodes_{};
+
+public:
+  auto load(const auto &platform) -> void {
+    scancodes_.fill(keyboard::scancode::unidentified);
+    for (const auto &binding : glfw_key_bindings) {
+      const auto os_scancode =
+          static_cast<std::size_t>(platform.get_key_scancode(binding.glfw_key));
+      if (os_scancode < capacity_) {
+        scancodes_[os_scancode] = binding.scancode;
+      }
+    }
+  }
+
+  [[nodiscard]] auto
+  operator[](const int os_scancode) const noexcept -> keyboard::scancode {
+    const auto index = static_cast<std::size_t>(os_scancode);
+    return index < capacity_ ? scancodes_[index]
+                             : keyboard::scancode::unidentified;
+  }
+};
+
+// Shared by every window and adapter instantiation. Zero-initialised, so it
+// costs nothing before the first adapter loads it.
+inline constinit auto glfw_scancodes = glfw_scancode_table{};
+} // namespace jage::engine::input::adapters::internal
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <jage/engine/input/chord.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+
+#include <variant>
+
+namespace jage::engine::input {
+// Maps one input to a user action. Mouse buttons only distinguish press and
+// release, so a repeat binding on a button never fires.
+template <class TAction> struct binding {
+  std::variant<keyboard::scancode, keyboard::key, mouse::button> input;
+  keyboard::action action{keyboard::action::press};
+  input::chord chord{input::chord::none};
+  TAction target;
+};
+} // namespace jage::engine::input
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <jage/engine/input/modifier.hpp>
+
+#include <bitset>
+#include <cstdint>
+#include <utility>
+
+namespace jage::engine::input {
+// The modifiers a binding requires, with left and right sides folded together
+// and lock keys ignored.
+enum class chord : std::uint8_t {
+  none = 0U,
+  control = 1U << 0U,
+  shift = 1U << 1U,
+  alt = 1U << 2U,
+  gui = 1U << 3U,
+  all = control | shift | alt | gui,
+};
+
+[[nodiscard]] constexpr auto operator|(const chord lhs,
+                                       const chord rhs) noexcept -> chord {
+  return static_cast<chord>(std::to_underlying(lhs) | std::to_underlying(rhs));
+}
+
+// Relies on modifier listing the left keys in the same order as the right
+// keys, four apart, and in the same order as the chord bits.
+[[nodiscard]] inline auto
+to_chord(const std::bitset<modifier_count> &modifiers) noexcept -> chord {
+  static_assert(std::to_underlying(modifier::right_control) -
+                    std::to_underlying(modifier::left_control) ==
+                4);
+  static_assert(std::to_underlying(modifier::left_gui) == 3);
+  const auto bits = modifiers.to_ulong();
+  return static_cast<chord>((bits | (bits >> 4U)) &
+                            std::to_underlying(chord::all));
+}
+} // namespace jage::engine::input
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace jage::engine::input::contexts::coalescing {
+// Forward every event to the sink as it arrives.
+struct none {};
+
+// Forward the first cursor report of a run, then fold the rest of the run
+// into a single event: motion deltas are summed and only the latest position
+// is kept. A run ends on any other event, on a switch between motion and
+// position, or on flush().
+struct cursor {};
+} // namespace jage::engine::input::contexts::coalescing
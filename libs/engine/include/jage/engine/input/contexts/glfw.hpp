@@ -1,37 +1,106 @@
 #pragma once
 
+#include <jage/engine/input/contexts/coalescing.hpp>
 #include <jage/engine/input/event.hpp>
+#include <jage/engine/input/window_id.hpp>
 #include <jage/engine/time/durations.hpp>
 
 #include <jage/engine/input/internal/concepts/event_sink.hpp>
+#include <jage/engine/input/internal/cursor_coalescer.hpp>
 #include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+#include <jage/engine/time/internal/concepts/real_number_time_source.hpp>
+#include <jage/engine/time/internal/steady_clock.hpp>
 
+#include <concepts>
 #include <functional>
+#include <type_traits>
 #include <utility>
 
 namespace jage::engine::input::contexts {
 template <time::internal::concepts::real_number_duration TTimeDuration,
-          class TEventSink>
-  requires internal::concepts::event_sink<TEventSink, event<TTimeDuration>>
+          class TEventSink,
+          time::internal::concepts::real_number_time_source TTimeSource =
+              time::internal::steady_clock<TTimeDuration>,
+          class TCoalescingPolicy = coalescing::cursor>
+  requires internal::concepts::event_sink<TEventSink, event<TTimeDuration>> and
+           std::same_as<TTimeDuration, typename TTimeSource::duration> and
+           (std::same_as<TCoalescingPolicy, coalescing::none> or
+            std::same_as<TCoalescingPolicy, coalescing::cursor>)
 class glfw {
   using duration_type_ = TTimeDuration;
   using event_type_ = event<duration_type_>;
   using cursor_position_type_ = std::pair<double, double>;
 
+  struct no_coalescer_ {};
+  using coalescer_type_ =
+      std::conditional_t<std::same_as<TCoalescingPolicy, coalescing::cursor>,
+                         internal::cursor_coalescer<event_type_>,
+                         no_coalescer_>;
+
   cursor_position_type_ cursor_position_{};
   std::reference_wrapper<TEventSink> event_sink_{};
+  [[no_unique_address]] TTimeSource time_source_{};
+  window_id window_{};
+  [[no_unique_address]] coalescer_type_ coalescer_{};
 
 public:
   using duration_type = duration_type_;
   using event_type = event_type_;
+  using time_source_type = TTimeSource;
+  using coalescing_policy_type = TCoalescingPolicy;
 
   explicit glfw(TEventSink &event_sink) : event_sink_{event_sink} {}
 
+  glfw(TEventSink &event_sink, TTimeSource time_source)
+      : event_sink_{event_sink}, time_source_{std::move(time_source)} {}
+
+  // For one of several windows publishing into the same sink. The window is
+  // stamped on keyboard and mouse events; gamepad events, such as those from
+  // adapters::glfw_gamepads, keep the default window.
+  glfw(TEventSink &event_sink, const window_id window)
+      : event_sink_{event_sink}, window_{window} {}
+
+  glfw(TEventSink &event_sink, TTimeSource time_source, const window_id window)
+      : event_sink_{event_sink}, time_source_{std::move(time_source)},
+        window_{window} {}
+
   auto push(event_type &&event) -> void {
+    event.window = is_window_less(event) ? window_id{} : window_;
+    if constexpr (std::same_as<TCoalescingPolicy, coalescing::cursor>) {
+      if (coalescer_.coalesce(event, event_sink_.get())) {
+        return;
+      }
+    }
     event_sink_.get().push(std::move(event));
   }
 
-  auto push(const event_type &event) -> void { event_sink_.get().push(event); }
+  auto push(const event_type &event) -> void {
+    push(event_type{event});
+  }
+
+  // Forwards the pending cursor run, if any. Call once per frame.
+  auto flush() -> void {
+    if constexpr (std::same_as<TCoalescingPolicy, coalescing::cursor>) {
+      coalescer_.flush(event_sink_.get());
+    }
+  }
+
+  [[nodiscard]] constexpr auto window() const noexcept -> window_id {
+    return window_;
+  }
+
+  [[nodiscard]] auto timestamp() const -> duration_type {
+    return time_source_.now().time_since_epoch();
+  }
+
+  [[nodiscard]] constexpr auto time_source() noexcept -> TTimeSource & {
+    return time_source_;
+  }
+
+  [[nodiscard]] constexpr auto
+  time_source() const noexcept -> const TTimeSource & {
+    return time_source_;
+  }
 
   [[nodiscard]] auto
   last_known_cursor_position() const -> const cursor_position_type_ & {
@@ -43,4 +112,4 @@ public:
   }
 };
 
-} // namespace jage::engine::input::contexts
\ No newline at end of file
+} // namespace jage::engine::input::contexts
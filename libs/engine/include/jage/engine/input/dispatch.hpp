@@ -0,0 +1,37 @@
+#pragma once
+
+#include <jage/engine/input/internal/dispatch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+
+namespace jage::engine::input {
+// Hands a batch of events to a handler one payload type at a time: a
+// counting sort groups the batch by payload, then each payload type gets its
+// own loop calling the handler directly, where std::visit would branch
+// through a jump table per event. The handler takes (payload, timestamp) or
+// (payload); payload types it accepts neither way are skipped.
+//
+// Events keep their order within a payload type but not across types, so a
+// consumer that needs a key press ordered against a click should keep using
+// std::visit.
+template <std::size_t BatchSize = 1024UZ,
+          std::ranges::contiguous_range TEvents, class THandler>
+  requires(BatchSize <= std::numeric_limits<std::uint16_t>::max() and
+           requires {
+             typename std::ranges::range_value_t<TEvents>::payload_list;
+           })
+auto dispatch(const TEvents &events, THandler &&handler) -> void {
+  using event_type = std::ranges::range_value_t<TEvents>;
+  const auto all = std::span<const event_type>{events};
+  for (auto offset = 0UZ; offset < std::size(all); offset += BatchSize) {
+    internal::dispatch_batch<event_type, BatchSize>(
+        all.subspan(offset, std::min(BatchSize, std::size(all) - offset)),
+        handler);
+  }
+}
+} // namespace jage::engine::input
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/gamepad/action.hpp>
+#include <jage/engine/input/gamepad/axis.hpp>
+#include <jage/engine/input/gamepad/button.hpp>
+#include <jage/engine/input/gamepad/events/axis_motion.hpp>
+#include <jage/engine/input/gamepad/events/button_press.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/modifier.hpp>
+#include <jage/engine/input/mouse/action.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/cursor/position.hpp>
+#include <jage/engine/input/mouse/events/horizontal_scroll.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/input/window_id.hpp>
+
+#include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace jage::engine::input {
+// Fixed 32-byte form of input::event. The timestamp is stored as whole
+// nanoseconds whatever the event's duration, so the round trip is exact for
+// timestamps that fall on a nanosecond, as those read from steady_clock or
+// the kernel do, and rounds anything finer. Coordinates stay as doubles to
+// keep them lossless. device holds the gamepad an event came from, or for
+// keyboard and mouse events the window. Gamepads are not tied to a window, so
+// gamepad events decode with the default window.
+struct encoded_event {
+  std::uint8_t type{};
+  std::uint8_t action{};
+  std::uint16_t modifiers{};
+  std::uint16_t scancode{};
+  std::uint8_t code{};
+  std::uint8_t device{};
+  std::int64_t timestamp{};
+  double x{};
+  double y{};
+
+  [[nodiscard]] friend constexpr auto
+  operator==(const encoded_event &, const encoded_event &) -> bool = default;
+};
+
+static_assert(sizeof(encoded_event) == 32UZ);
+static_assert(std::is_trivially_copyable_v<encoded_event>);
+
+namespace detail {
+[[nodiscard]] inline auto
+encode_modifiers(const std::bitset<modifier_count> &modifiers)
+    -> std::uint16_t {
+  return static_cast<std::uint16_t>(modifiers.to_ulong());
+}
+
+[[nodiscard]] inline auto
+decode_modifiers(const std::uint16_t modifiers)
+    -> std::bitset<modifier_count> {
+  return std::bitset<modifier_count>{modifiers};
+}
+
+inline auto encode_payload(const keyboard::events::key_press &key_press,
+                              encoded_event &encoded) -> void {
+  encoded.code = std::to_underlying(key_press.key);
+  encoded.scancode = std::to_underlying(key_press.scancode);
+  encoded.action = std::to_underlying(key_press.action);
+  encoded.modifiers = encode_modifiers(key_press.modifiers);
+}
+
+inline auto encode_payload(const mouse::events::click &click,
+                              encoded_event &encoded) -> void {
+  encoded.code = std::to_underlying(click.button);
+  encoded.action = std::to_underlying(click.action);
+  encoded.modifiers = encode_modifiers(click.modifiers);
+}
+
+inline auto encode_payload(const mouse::events::cursor::position &position,
+                              encoded_event &encoded) -> void {
+  encoded.x = position.x;
+  encoded.y = position.y;
+}
+
+inline auto encode_payload(const mouse::events::cursor::motion &motion,
+                              encoded_event &encoded) -> void {
+  encoded.x = motion.delta_x;
+  encoded.y = motion.delta_y;
+}
+
+inline auto encode_payload(const mouse::events::horizontal_scroll &scroll,
+                              encoded_event &encoded) -> void {
+  encoded.x = scroll.offset;
+}
+
+inline auto encode_payload(const mouse::events::vertical_scroll &scroll,
+                              encoded_event &encoded) -> void {
+  encoded.y = scroll.offset;
+}
+
+inline auto encode_payload(const gamepad::events::button_press &button_press,
+                           encoded_event &encoded) -> void {
+  encoded.device = button_press.gamepad;
+  encoded.code = std::to_underlying(button_press.button);
+  encoded.action = std::to_underlying(button_press.action);
+}
+
+inline auto encode_payload(const gamepad::events::axis_motion &axis_motion,
+                           encoded_event &encoded) -> void {
+  encoded.device = axis_motion.gamepad;
+  encoded.code = std::to_underlying(axis_motion.axis);
+  encoded.x = axis_motion.value;
+}
+
+template <class TPayload>
+[[nodiscard]] auto decode_payload(const encoded_event &encoded)
+    -> TPayload {
+  if constexpr (std::is_same_v<TPayload, keyboard::events::key_press>) {
+    return {
+        .key = static_cast<keyboard::key>(encoded.code),
+        .scancode = static_cast<keyboard::scancode>(encoded.scancode),
+        .action = static_cast<keyboard::action>(encoded.action),
+        .modifiers = decode_modifiers(encoded.modifiers),
+    };
+  } else if constexpr (std::is_same_v<TPayload, mouse::events::click>) {
+    return {
+        .button = static_cast<mouse::button>(encoded.code),
+        .action = static_cast<mouse::action>(encoded.action),
+        .modifiers = decode_modifiers(encoded.modifiers),
+    };
+  } else if constexpr (std::is_same_v<TPayload,
+                                      mouse::events::cursor::position>) {
+    return {.x = encoded.x, .y = encoded.y};
+  } else if constexpr (std::is_same_v<TPayload,
+                                      mouse::events::cursor::motion>) {
+    return {.delta_x = encoded.x, .delta_y = encoded.y};
+  } else if constexpr (std::is_same_v<TPayload,
+                                      mouse::events::horizontal_scroll>) {
+    return {.offset = encoded.x};
+  } else if constexpr (std::is_same_v<TPayload,
+                                      mouse::events::vertical_scroll>) {
+    return {.offset = encoded.y};
+  } else if constexpr (std::is_same_v<TPayload,
+                                      gamepad::events::button_press>) {
+    return {
+        .gamepad = encoded.device,
+        .button = static_cast<gamepad::button>(encoded.code),
+        .action = static_cast<gamepad::action>(encoded.action),
+    };
+  } else {
+    static_assert(std::is_same_v<TPayload, gamepad::events::axis_motion>);
+    return {
+        .gamepad = encoded.device,
+        .axis = static_cast<gamepad::axis>(encoded.code),
+        .value = encoded.x,
+    };
+  }
+}
+template <class TVariant, std::size_t Index = 0UZ>
+[[nodiscard]] auto decode_variant(const encoded_event &encoded) -> TVariant {
+  if constexpr (Index == std::variant_size_v<TVariant>) {
+    throw std::invalid_argument("Unknown encoded input event type.");
+  } else {
+    if (Index == encoded.type) {
+      return TVariant{
+          std::in_place_index<Index>,
+          decode_payload<std::variant_alternative_t<Index, TVariant>>(encoded)};
+    }
+    return decode_variant<TVariant, Index + 1UZ>(encoded);
+  }
+}
+} // namespace detail
+
+template <time::internal::concepts::real_number_duration TTimeDuration>
+[[nodiscard]] auto encode_timestamp(const TTimeDuration timestamp)
+    -> std::int64_t {
+  return std::chrono::round<std::chrono::nanoseconds>(timestamp).count();
+}
+
+template <time::internal::concepts::real_number_duration TTimeDuration>
+[[nodiscard]] auto decode_timestamp(const std::int64_t timestamp)
+    -> TTimeDuration {
+  return std::chrono::duration_cast<TTimeDuration>(
+      std::chrono::nanoseconds{timestamp});
+}
+
+template <time::internal::concepts::real_number_duration TTimeDuration>
+[[nodiscard]] auto encode(const event<TTimeDuration> &input_event)
+    -> encoded_event {
+  auto encoded = encoded_event{
+      .type = static_cast<std::uint8_t>(input_event.payload.index()),
+      .device = input_event.window,
+      .timestamp = encode_timestamp(input_event.timestamp),
+  };
+  std::visit(
+      [&](const auto &payload) -> void {
+        detail::encode_payload(payload, encoded);
+      },
+      input_event.payload);
+  return encoded;
+}
+
+template <time::internal::concepts::real_number_duration TTimeDuration>
+[[nodiscard]] auto decode(const encoded_event &encoded)
+    -> event<TTimeDuration> {
+  auto decoded = event<TTimeDuration>{
+      .timestamp = decode_timestamp<TTimeDuration>(encoded.timestamp),
+      .payload =
+          detail::decode_variant<typename event<TTimeDuration>::payload_type>(
+              encoded),
+  };
+  if (not is_window_less(decoded)) {
+    decoded.window = encoded.device;
+  }
+  return decoded;
+}
+} // namespace jage::engine::input
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <jage/engine/input/gamepad/events/axis_motion.hpp>
+#include <jage/engine/input/gamepad/events/button_press.hpp>
 #include <jage/engine/input/keyboard/events/key_press.hpp>
 #include <jage/engine/input/mouse/events/click.hpp>
 #include <jage/engine/input/mouse/events/cursor/motion.hpp>
@@ -10,10 +12,24 @@
 #include <jage/engine/input/internal/event.hpp>
 #include <jage/engine/time/internal/concepts/real_number_duration.hpp>
 
+#include <variant>
+
 namespace jage::engine::input {
 template <time::internal::concepts::real_number_duration TTimeDuration>
 using event = internal::event<
     TTimeDuration, keyboard::events::key_press, mouse::events::click,
     mouse::events::cursor::position, mouse::events::cursor::motion,
-    mouse::events::horizontal_scroll, mouse::events::vertical_scroll>;
-}
\ No newline at end of file
+    mouse::events::horizontal_scroll, mouse::events::vertical_scroll,
+    gamepad::events::button_press, gamepad::events::axis_motion>;
+
+// Gamepads are not tied to a window, so their events always carry the
+// default window_id whichever context pushed them.
+template <time::internal::concepts::real_number_duration TTimeDuration>
+[[nodiscard]] constexpr auto
+is_window_less(const event<TTimeDuration> &input_event) noexcept -> bool {
+  return std::holds_alternative<gamepad::events::button_press>(
+             input_event.payload) or
+         std::holds_alternative<gamepad::events::axis_motion>(
+             input_event.payload);
+}
+} // namespace jage::engine::input
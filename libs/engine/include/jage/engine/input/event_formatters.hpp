@@ -1,10 +1,17 @@
 #pragma once
 
 #include <jage/engine/input/event.hpp>
+#include <jage/engine/input/gamepad/action.hpp>
+#include <jage/engine/input/gamepad/axis.hpp>
+#include <jage/engine/input/gamepad/button.hpp>
+#include <jage/engine/input/gamepad/events/axis_motion.hpp>
+#include <jage/engine/input/gamepad/events/button_press.hpp>
 #include <jage/engine/input/keyboard/action.hpp>
 #include <jage/engine/input/keyboard/events/key_press.hpp>
 #include <jage/engine/input/keyboard/key.hpp>
 #include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/latency_statistics.hpp>
+#include <jage/engine/input/modifier.hpp>
 #include <jage/engine/input/mouse/action.hpp>
 #include <jage/engine/input/mouse/button.hpp>
 #include <jage/engine/input/mouse/events/click.hpp>
@@ -14,14 +21,21 @@
 #include <jage/engine/input/mouse/events/vertical_scroll.hpp>
 #include <jage/engine/time/durations.hpp>
 #include <jage/engine/time/events/snapshot.hpp>
-#include <jage/stdx/overloaded.hpp>
+
+#include <jage/engine/input/internal/layout_formatter.hpp>
 
 #include <chrono>
-#include <fmt/chrono.h>
+#include <cstddef>
+#include <cstdint>
+#include <fmt/compile.h>
 #include <fmt/format.h>
-#include <string>
 #include <string_view>
+#include <variant>
 
+// Formatters for input events and frame snapshots. "{}" gives the multi-line
+// layout, "{:c}" a single line. Both write straight into the output, so
+// formatting an event allocates nothing beyond what the caller's buffer
+// does, and neither reads a clock: stamp log lines where they are written.
 template <>
 struct fmt::formatter<jage::engine::input::keyboard::key>
     : fmt::formatter<std::string_view> {
@@ -72,146 +86,281 @@ struct fmt::formatter<jage::engine::input::mouse::action>
   }
 };
 
+template <>
+struct fmt::formatter<jage::engine::input::gamepad::button>
+    : fmt::formatter<std::string_view> {
+  auto format(const jage::engine::input::gamepad::button &input_button,
+              fmt::format_context &ctx) const {
+    return fmt::formatter<std::string_view>::format(
+        jage::engine::input::gamepad::serialize(input_button), ctx);
+  }
+};
+
+template <>
+struct fmt::formatter<jage::engine::input::gamepad::axis>
+    : fmt::formatter<std::string_view> {
+  auto format(const jage::engine::input::gamepad::axis &input_axis,
+              fmt::format_context &ctx) const {
+    return fmt::formatter<std::string_view>::format(
+        jage::engine::input::gamepad::serialize(input_axis), ctx);
+  }
+};
+
+template <>
+struct fmt::formatter<jage::engine::input::gamepad::action>
+    : fmt::formatter<std::string_view> {
+  auto format(const jage::engine::input::gamepad::action &input_action,
+              fmt::format_context &ctx) const {
+    return fmt::formatter<std::string_view>::format(
+        jage::engine::input::gamepad::serialize(input_action), ctx);
+  }
+};
+
+namespace jage::engine::input::internal {
+// Calendar date and time of day of wall_time in UTC, worked out without the
+// C library's time zone machinery, followed by the raw count.
+template <class TOutput>
+auto format_timestamp(TOutput output, const std::chrono::nanoseconds wall_time,
+                      const std::chrono::nanoseconds since_epoch) -> TOutput {
+  const auto days = std::chrono::floor<std::chrono::days>(wall_time);
+  const auto date = std::chrono::year_month_day{std::chrono::sys_days{days}};
+  const auto time = std::chrono::hh_mm_ss{
+      std::chrono::floor<std::chrono::seconds>(wall_time - days)};
+  return fmt::format_to(
+      output,
+      FMT_COMPILE("{:04}-{:02}-{:02} {:02}:{:02}:{:02} ({} ns since epoch)"),
+      static_cast<int>(date.year()), static_cast<unsigned>(date.month()),
+      static_cast<unsigned>(date.day()), time.hours().count(),
+      time.minutes().count(), time.seconds().count(),
+      static_cast<std::uint64_t>(since_epoch.count()));
+}
+
+// Modifier bitsets print as ten binary digits.
+static_assert(10U == modifier_count);
+} // namespace jage::engine::input::internal
+
 template <>
 struct fmt::formatter<jage::engine::time::durations::nanoseconds>
-    : fmt::formatter<std::string> {
+    : jage::engine::input::internal::layout_formatter {
   auto format(const jage::engine::time::durations::nanoseconds &input_timestamp,
               fmt::format_context &ctx) const {
-    auto timepoint = std::chrono::system_clock::time_point{
-        std::chrono::duration_cast<std::chrono::system_clock::duration>(
-            input_timestamp)};
-    const auto text =
-        fmt::format("{:%Y-%m-%d %H:%M:%S} ({} ns since epoch)", timepoint,
-                    static_cast<std::uint64_t>(input_timestamp.count()));
-    return fmt::formatter<std::string>::format(text, ctx);
+    const auto since_epoch =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(input_timestamp);
+    if (compact) {
+      return fmt::format_to(ctx.out(), FMT_COMPILE("{} ns"),
+                            static_cast<std::uint64_t>(since_epoch.count()));
+    }
+    return jage::engine::input::internal::format_timestamp(
+        ctx.out(), since_epoch, since_epoch);
   }
 };
 
 template <>
-struct fmt::formatter<std::chrono::nanoseconds> : fmt::formatter<std::string> {
+struct fmt::formatter<std::chrono::nanoseconds>
+    : jage::engine::input::internal::layout_formatter {
   auto format(const std::chrono::nanoseconds &input_timestamp,
               fmt::format_context &ctx) const {
-    constexpr auto cst_adj =
-        std::chrono::duration_cast<std::chrono::system_clock::duration>(
-            std::chrono::nanoseconds{21600000000000});
-    auto timepoint = std::chrono::system_clock::time_point{
-        std::chrono::duration_cast<std::chrono::system_clock::duration>(
-            input_timestamp) -
-        cst_adj};
-    const auto text =
-        fmt::format("{:%Y-%m-%d %H:%M:%S} ({} ns since epoch)", timepoint,
-                    static_cast<std::uint64_t>(input_timestamp.count()));
-    return fmt::formatter<std::string>::format(text, ctx);
+    if (compact) {
+      const auto count = static_cast<std::uint64_t>(input_timestamp.count());
+      return fmt::format_to(ctx.out(), FMT_COMPILE("{} ns"), count);
+    }
+    constexpr auto cst_adj = std::chrono::nanoseconds{21600000000000};
+    return jage::engine::input::internal::format_timestamp(
+        ctx.out(), input_timestamp - cst_adj, input_timestamp);
   }
 };
 
 template <>
 struct fmt::formatter<jage::engine::input::mouse::events::click>
-    : fmt::formatter<std::string> {
+    : jage::engine::input::internal::layout_formatter {
   auto format(const jage::engine::input::mouse::events::click &input_event,
               fmt::format_context &ctx) const {
-    static constexpr auto template_text = R"("mouse-click": {{
+    const auto modifiers = input_event.modifiers.to_ulong();
+    if (compact) {
+      return fmt::format_to(
+          ctx.out(),
+          FMT_COMPILE(R"("mouse-click": {{"button": {}, "action": {}, )"
+                      R"("modifiers": {:010b}}})"),
+          input_event.button, input_event.action, modifiers);
+    }
+    return fmt::format_to(ctx.out(), FMT_COMPILE(R"("mouse-click": {{
       "button": {},
       "action": {},
-      "modifiers": {}
-  }})";
-    return fmt::formatter<std::string>::format(
-        fmt::format(fmt::runtime(template_text), input_event.button,
-                    input_event.action, input_event.modifiers.to_string()),
-        ctx);
+      "modifiers": {:010b}
+  }})"),
+                          input_event.button, input_event.action, modifiers);
   }
 };
 
 template <>
 struct fmt::formatter<jage::engine::input::keyboard::events::key_press>
-    : fmt::formatter<std::string> {
+    : jage::engine::input::internal::layout_formatter {
   auto
   format(const jage::engine::input::keyboard::events::key_press &input_event,
          fmt::format_context &ctx) const {
-    static constexpr auto template_text = R"("key-press": {{
+    const auto modifiers = input_event.modifiers.to_ulong();
+    if (compact) {
+      return fmt::format_to(
+          ctx.out(),
+          FMT_COMPILE(R"("key-press": {{"key": {}, "scancode": {}, )"
+                      R"("action": {}, "modifiers": {:010b}}})"),
+          input_event.key, input_event.scancode, input_event.action,
+          modifiers);
+    }
+    return fmt::format_to(ctx.out(), FMT_COMPILE(R"("key-press": {{
       "key": {},
       "scancode": {},
       "action": {},
-      "modifiers": {}
-  }})";
-    return fmt::formatter<std::string>::format(
-        fmt::format(fmt::runtime(template_text), input_event.key,
-                    input_event.scancode, input_event.action,
-                    input_event.modifiers.to_string()),
-        ctx);
+      "modifiers": {:010b}
+  }})"),
+                          input_event.key, input_event.scancode,
+                          input_event.action, modifiers);
   }
 };
 
 template <>
 struct fmt::formatter<jage::engine::input::mouse::events::cursor::position>
-    : fmt::formatter<std::string> {
+    : jage::engine::input::internal::layout_formatter {
   auto format(
       const jage::engine::input::mouse::events::cursor::position &input_event,
       fmt::format_context &ctx) const {
-    static constexpr auto template_text = R"("cursor-position": {{
+    if (compact) {
+      return fmt::format_to(
+          ctx.out(), FMT_COMPILE(R"("cursor-position": {{"x": {}, "y": {}}})"),
+          input_event.x, input_event.y);
+    }
+    return fmt::format_to(ctx.out(), FMT_COMPILE(R"("cursor-position": {{
       "x": {},
       "y": {}
-  }})";
-    return fmt::formatter<std::string>::format(
-        fmt::format(fmt::runtime(template_text), input_event.x, input_event.y),
-        ctx);
+  }})"),
+                          input_event.x, input_event.y);
   }
 };
 
 template <>
 struct fmt::formatter<jage::engine::input::mouse::events::cursor::motion>
-    : fmt::formatter<std::string> {
+    : jage::engine::input::internal::layout_formatter {
   auto
   format(const jage::engine::input::mouse::events::cursor::motion &input_event,
          fmt::format_context &ctx) const {
-    static constexpr auto template_text = R"("cursor-motion": {{
+    if (compact) {
+      return fmt::format_to(
+          ctx.out(),
+          FMT_COMPILE(R"("cursor-motion": {{"delta_x": {}, "delta_y": {}}})"),
+          input_event.delta_x, input_event.delta_y);
+    }
+    return fmt::format_to(ctx.out(), FMT_COMPILE(R"("cursor-motion": {{
       "delta_x": {},
       "delta_y": {}
-  }})";
-    return fmt::formatter<std::string>::format(
-        fmt::format(fmt::runtime(template_text), input_event.delta_x,
-                    input_event.delta_y),
-        ctx);
+  }})"),
+                          input_event.delta_x, input_event.delta_y);
   }
 };
 
 template <>
 struct fmt::formatter<jage::engine::input::mouse::events::horizontal_scroll>
-    : fmt::formatter<std::string> {
+    : jage::engine::input::internal::layout_formatter {
   auto format(
       const jage::engine::input::mouse::events::horizontal_scroll &input_event,
       fmt::format_context &ctx) const {
-    static constexpr auto template_text = R"("horizontal-scroll": {{
+    if (compact) {
+      return fmt::format_to(
+          ctx.out(), FMT_COMPILE(R"("horizontal-scroll": {{"offset": {}}})"),
+          input_event.offset);
+    }
+    return fmt::format_to(ctx.out(), FMT_COMPILE(R"("horizontal-scroll": {{
       "offset": {}
-  }})";
-    return fmt::formatter<std::string>::format(
-        fmt::format(fmt::runtime(template_text), input_event.offset), ctx);
+  }})"),
+                          input_event.offset);
   }
 };
 
 template <>
 struct fmt::formatter<jage::engine::input::mouse::events::vertical_scroll>
-    : fmt::formatter<std::string> {
+    : jage::engine::input::internal::layout_formatter {
   auto
   format(const jage::engine::input::mouse::events::vertical_scroll &input_event,
          fmt::format_context &ctx) const {
-    static constexpr auto template_text = R"("vertical-scroll": {{
+    if (compact) {
+      return fmt::format_to(
+          ctx.out(), FMT_COMPILE(R"("vertical-scroll": {{"offset": {}}})"),
+          input_event.offset);
+    }
+    return fmt::format_to(ctx.out(), FMT_COMPILE(R"("vertical-scroll": {{
       "offset": {}
-  }})";
-    return fmt::formatter<std::string>::format(
-        fmt::format(fmt::runtime(template_text), input_event.offset), ctx);
+  }})"),
+                          input_event.offset);
+  }
+};
+
+template <>
+struct fmt::formatter<jage::engine::input::gamepad::events::button_press>
+    : jage::engine::input::internal::layout_formatter {
+  auto format(
+      const jage::engine::input::gamepad::events::button_press &input_event,
+      fmt::format_context &ctx) const {
+    if (compact) {
+      return fmt::format_to(
+          ctx.out(),
+          FMT_COMPILE(R"("gamepad-button-press": {{"gamepad": {}, )"
+                      R"("button": {}, "action": {}}})"),
+          input_event.gamepad, input_event.button, input_event.action);
+    }
+    return fmt::format_to(ctx.out(), FMT_COMPILE(R"("gamepad-button-press": {{
+      "gamepad": {},
+      "button": {},
+      "action": {}
+  }})"),
+                          input_event.gamepad, input_event.button,
+                          input_event.action);
+  }
+};
+
+template <>
+struct fmt::formatter<jage::engine::input::gamepad::events::axis_motion>
+    : jage::engine::input::internal::layout_formatter {
+  auto format(
+      const jage::engine::input::gamepad::events::axis_motion &input_event,
+      fmt::format_context &ctx) const {
+    if (compact) {
+      return fmt::format_to(
+          ctx.out(),
+          FMT_COMPILE(R"("gamepad-axis-motion": {{"gamepad": {}, )"
+                      R"("axis": {}, "value": {}}})"),
+          input_event.gamepad, input_event.axis, input_event.value);
+    }
+    return fmt::format_to(ctx.out(), FMT_COMPILE(R"("gamepad-axis-motion": {{
+      "gamepad": {},
+      "axis": {},
+      "value": {}
+  }})"),
+                          input_event.gamepad, input_event.axis,
+                          input_event.value);
   }
 };
 
 template <>
 struct fmt::formatter<jage::engine::time::events::snapshot<
-    jage::engine::time::durations::nanoseconds>> : fmt::formatter<std::string> {
+    jage::engine::time::durations::nanoseconds>>
+    : jage::engine::input::internal::layout_formatter {
   auto format(const jage::engine::time::events::snapshot<
                   jage::engine::time::durations::nanoseconds> &input_event,
               fmt::format_context &ctx) const {
-    static constexpr auto template_text = R"(
+    if (compact) {
+      return fmt::format_to(
+          ctx.out(),
+          FMT_COMPILE(
+              R"("frame": {{"real_time": {:c}, "tick_duration": {:c}, )"
+              R"("time_scale": {}, "elapsed_time": {:c}, )"
+              R"("elapsed_frames": {}, "frame": {}, )"
+              R"("accumulated_time": {:c}}})"),
+          input_event.real_time, input_event.tick_duration,
+          input_event.time_scale, input_event.elapsed_time,
+          input_event.elapsed_frames, input_event.frame,
+          input_event.accumulated_time);
+    }
+    return fmt::format_to(ctx.out(), FMT_COMPILE(R"(
 "frame": {{
-  "wall-time": {},
   "snapshot": {{
     "real_time": {},
     "tick_duration": {},
@@ -220,58 +369,110 @@ struct fmt::formatter<jage::engine::time::events::snapshot<
     "elapsed_frames": {},
     "frame": {},
     "accumulated_time": {}
-}})";
-    return fmt::formatter<std::string>::format(
-        fmt::format(
-            fmt::runtime(template_text),
-            std::chrono::high_resolution_clock::now().time_since_epoch(),
-            input_event.real_time, input_event.tick_duration,
-            input_event.time_scale, input_event.elapsed_time,
-            input_event.elapsed_frames, input_event.frame,
-            input_event.accumulated_time),
-        ctx);
+}})"),
+                          input_event.real_time, input_event.tick_duration,
+                          input_event.time_scale, input_event.elapsed_time,
+                          input_event.elapsed_frames, input_event.frame,
+                          input_event.accumulated_time);
   }
 };
 
 template <>
 struct fmt::formatter<jage::engine::input::event<
     jage::engine::time::durations::nanoseconds>::payload_type>
-    : fmt::formatter<std::string> {
+    : jage::engine::input::internal::layout_formatter {
   auto format(const jage::engine::input::event<
                   jage::engine::time::durations::nanoseconds>::payload_type
                   &input_event,
               fmt::format_context &ctx) const {
-    return fmt::formatter<std::string>::format(
-        std::visit(jage::stdx::overloaded{
-                       [&]<class T>(const T &payload) -> std::string
-                         requires fmt::is_formattable<T>::value
-                       { return fmt::format("{}", payload); },
-                       [](auto &&) -> std::string {
-                         return "event type formatter is missing";
-                       },
-                       },
-                       input_event),
-                   ctx);
+    return std::visit(
+        [&]<class T>(const T &payload) {
+          if constexpr (not fmt::is_formattable<T>::value) {
+            return fmt::format_to(
+                ctx.out(), FMT_COMPILE("event type formatter is missing"));
+          } else if (compact) {
+            return fmt::format_to(ctx.out(), FMT_COMPILE("{:c}"), payload);
+          } else {
+            return fmt::format_to(ctx.out(), FMT_COMPILE("{}"), payload);
+          }
+        },
+        input_event);
   }
 };
 
 template <>
 struct fmt::formatter<
     jage::engine::input::event<jage::engine::time::durations::nanoseconds>>
-    : fmt::formatter<std::string> {
+    : jage::engine::input::internal::layout_formatter {
   auto format(const jage::engine::input::event<
                   jage::engine::time::durations::nanoseconds> &input_event,
               fmt::format_context &ctx) const {
-    static constexpr auto template_text = R"("input-event": {{
-    "wall-time": {},
+    if (compact) {
+      return fmt::format_to(
+          ctx.out(),
+          FMT_COMPILE(R"("input-event": {{"timestamp": {:c}, {:c}}})"),
+          input_event.timestamp, input_event.payload);
+    }
+    return fmt::format_to(ctx.out(), FMT_COMPILE(R"("input-event": {{
     "timestamp": {},
     {}
-}})";
-    return fmt::formatter<std::string>::format(
-        fmt::format(
-            fmt::runtime(template_text),
-            std::chrono::high_resolution_clock::now().time_since_epoch(),
-            input_event.timestamp, input_event.payload),
-        ctx);
+}})"),
+                          input_event.timestamp, input_event.payload);
+  }
+};
+
+template <>
+struct fmt::formatter<jage::engine::input::percentile_summary<std::uint64_t>>
+    : jage::engine::input::internal::layout_formatter {
+  auto format(
+      const jage::engine::input::percentile_summary<std::uint64_t> &summary,
+      fmt::format_context &ctx) const {
+    return fmt::format_to(ctx.out(),
+                          FMT_COMPILE(R"({{"count": {}, "p50": {}, )"
+                                      R"("p95": {}, "p99": {}, "max": {}}})"),
+                          summary.count, summary.p50, summary.p95, summary.p99,
+                          summary.max);
+  }
+};
+
+template <>
+struct fmt::formatter<jage::engine::input::percentile_summary<
+    jage::engine::time::durations::nanoseconds>>
+    : jage::engine::input::internal::layout_formatter {
+  auto format(const jage::engine::input::percentile_summary<
+                  jage::engine::time::durations::nanoseconds> &summary,
+              fmt::format_context &ctx) const {
+    return fmt::format_to(
+        ctx.out(),
+        FMT_COMPILE(R"({{"count": {}, "p50": {:c}, "p95": {:c}, )"
+                    R"("p99": {:c}, "max": {:c}}})"),
+        summary.count, summary.p50, summary.p95, summary.p99, summary.max);
+  }
+};
+
+// Summaries are listed in the event's payload order. Both layouts keep each
+// summary on one line.
+template <std::size_t PayloadCount>
+struct fmt::formatter<jage::engine::input::latency_statistics<
+    jage::engine::time::durations::nanoseconds, PayloadCount>>
+    : jage::engine::input::internal::layout_formatter {
+  auto format(const jage::engine::input::latency_statistics<
+                  jage::engine::time::durations::nanoseconds, PayloadCount>
+                  &statistics,
+              fmt::format_context &ctx) const {
+    const auto *const line = compact ? "" : "\n    ";
+    const auto *const item = compact ? " " : "\n        ";
+    auto output = fmt::format_to(
+        ctx.out(),
+        FMT_COMPILE(R"("input-latency": {{{}"depth": {},{}"payloads": [)"),
+        line, statistics.depth, compact ? " " : line);
+    for (auto index = 0UZ; index < PayloadCount; ++index) {
+      output = fmt::format_to(output, FMT_COMPILE("{}{}{}"),
+                              compact and 0UZ == index ? "" : item,
+                              statistics.payloads[index],
+                              index + 1UZ < PayloadCount ? "," : "");
+    }
+    return fmt::format_to(output, FMT_COMPILE("{}]{}}}"), line,
+                          compact ? "" : "\n");
   }
 };
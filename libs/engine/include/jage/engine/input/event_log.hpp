@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <fmt/format.h>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace jage::engine::input {
+// Scrollback of input events for display. Events are kept raw in a ring and
+// only turned into text when a row is asked for, so pushing costs a copy and
+// drawing costs the rows on screen, however long the history.
+//
+// Formatted rows are cached by sequence number. A sequence number always
+// names the same event, so the cache never needs invalidating; a row that
+// falls out of it is formatted again. TEvent needs a formatter that accepts
+// "{:c}".
+template <class TEvent> class event_log {
+  static constexpr auto cached_rows_ = 512UZ;
+  static constexpr auto no_sequence_ = std::numeric_limits<std::size_t>::max();
+
+  struct cached_row_ {
+    std::size_t sequence{no_sequence_};
+    std::string text{};
+  };
+
+  std::vector<TEvent> events_;
+  std::vector<cached_row_> rows_{cached_rows_};
+  std::size_t pushed_{};
+  std::size_t formatted_rows_{};
+
+public:
+  explicit event_log(const std::size_t capacity) : events_(capacity) {
+    if (0UZ == capacity) [[unlikely]] {
+      throw std::invalid_argument{"event_log capacity must not be zero."};
+    }
+  }
+
+  auto push(const TEvent &input_event) -> void {
+    events_[pushed_++ % std::size(events_)] = input_event;
+  }
+
+  // Rows run from the oldest event still held, row 0, to the newest.
+  [[nodiscard]] auto size() const noexcept -> std::size_t {
+    return std::min(pushed_, std::size(events_));
+  }
+
+  [[nodiscard]] auto capacity() const noexcept -> std::size_t {
+    return std::size(events_);
+  }
+
+  // Every event ever pushed, including those that have scrolled away.
+  [[nodiscard]] auto pushed() const noexcept -> std::size_t {
+    return pushed_;
+  }
+
+  [[nodiscard]] auto sequence(const std::size_t row) const noexcept
+      -> std::size_t {
+    return pushed_ - size() + row;
+  }
+
+  [[nodiscard]] auto event(const std::size_t row) const -> const TEvent & {
+    return events_[sequence(row) % std::size(events_)];
+  }
+
+  // "[sequence]: event" on one line. The view stays valid until a row that
+  // shares its cache slot is formatted, which a frame drawing fewer than 512
+  // rows never does.
+  [[nodiscard]] auto text(const std::size_t row) -> std::string_view {
+    const auto row_sequence = sequence(row);
+    auto &cached = rows_[row_sequence % cached_rows_];
+    if (row_sequence != cached.sequence) {
+      cached.text.clear();
+      fmt::format_to(std::back_inserter(cached.text), "[{}]: {:c}",
+                     row_sequence, event(row));
+      cached.sequence = row_sequence;
+      ++formatted_rows_;
+    }
+    return cached.text;
+  }
+
+  // How many times a row has been formatted, cache misses only.
+  [[nodiscard]] auto formatted_rows() const noexcept -> std::size_t {
+    return formatted_rows_;
+  }
+};
+} // namespace jage::engine::input
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <jage/mp/contains.hpp>
+#include <jage/mp/first_index_of.hpp>
+#include <jage/mp/size.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace jage::engine::input {
+// One consumer's read head on an spmc ring of input events that only stops
+// at events carrying one of TPayloads. Slots are chosen from the ring's tag
+// bytes, so events of other types are never copied out of their buffers.
+//
+// The reader keeps its own position and never holds the producer back. If
+// it is lapped it skips ahead to the oldest event still in the ring and
+// counts the overwritten ones, whatever their type, as dropped.
+template <class... TPayloads>
+  requires(sizeof...(TPayloads) > 0UZ)
+class filtered_reader {
+  std::size_t read_index_{};
+  std::uint64_t dropped_{};
+
+  template <class TRing>
+  using event_type_ =
+      std::remove_cvref_t<decltype(std::declval<const TRing &>().read(0UZ))>;
+
+  template <class TRing>
+  [[nodiscard]] static constexpr auto accepted_tags() -> std::uint64_t {
+    using payload_list = typename event_type_<TRing>::payload_list;
+    static_assert(mp::size<payload_list> <= 64UZ);
+    static_assert((mp::contains<payload_list, TPayloads> and ...),
+                  "filtered_reader payloads must be alternatives of the "
+                  "ring's event payload.");
+    return ((std::uint64_t{1U} << mp::first_index_of<payload_list, TPayloads>) |
+            ...);
+  }
+
+  template <class TRing>
+  [[nodiscard]] static constexpr auto
+  is_accepted(const std::size_t tag) noexcept -> bool {
+    return tag < 64UZ and 0U != ((accepted_tags<TRing>() >> tag) & 1U);
+  }
+
+  template <class TRing>
+  [[nodiscard]] static auto is_lapped(const TRing &ring,
+                                      const std::size_t write_head,
+                                      const std::size_t index) -> bool {
+    return write_head - index >= ring.capacity();
+  }
+
+public:
+  filtered_reader() = default;
+
+  // Starts at the ring's current write head, skipping what is already there.
+  template <class TRing>
+  explicit filtered_reader(const TRing &ring)
+      : read_index_{ring.write_head()} {}
+
+  // The next accepted event published since the last call, or nothing once
+  // the reader has caught up with the producer.
+  template <class TRing>
+    requires requires(const TRing &ring, const std::size_t index) {
+      { ring.tag(index) } -> std::same_as<std::uint8_t>;
+    }
+  [[nodiscard]] auto next(const TRing &ring)
+      -> std::optional<event_type_<TRing>> {
+    for (auto write_head = ring.write_head(); read_index_ < write_head;) {
+      if (is_lapped(ring, write_head, read_index_)) [[unlikely]] {
+        const auto oldest = write_head - ring.capacity() + 1UZ;
+        dropped_ += oldest - read_index_;
+        read_index_ = oldest;
+      }
+      const auto index = read_index_++;
+      const auto slot = index % ring.capacity();
+      const auto tag = ring.tag(slot);
+      // The tag may already belong to a newer event; the one at index is
+      // then lost whatever its type.
+      if (const auto after = ring.write_head();
+          is_lapped(ring, after, index)) [[unlikely]] {
+        ++dropped_;
+        write_head = after;
+        continue;
+      }
+      if (not is_accepted<TRing>(tag)) {
+        continue;
+      }
+      auto input_event = ring.read(slot);
+      if (is_lapped(ring, ring.write_head(), index)) [[unlikely]] {
+        ++dropped_;
+        write_head = ring.write_head();
+        continue;
+      }
+      return input_event;
+    }
+    return std::nullopt;
+  }
+
+  // Hands every accepted event published since the last call to handler,
+  // as (payload, timestamp) or (payload), and returns how many it handed
+  // over.
+  template <class TRing, class THandler>
+  auto drain(const TRing &ring, THandler &&handler) -> std::size_t {
+    auto handled = 0UZ;
+    for (auto input_event = next(ring); input_event;
+         input_event = next(ring), ++handled) {
+      const auto &timestamp = input_event->timestamp;
+      const auto call = [&]<class TPayload>() -> void {
+        const auto *payload = std::get_if<TPayload>(&input_event->payload);
+        if (nullptr == payload) {
+          return;
+        }
+        if constexpr (std::invocable<THandler &, const TPayload &,
+                                     decltype(timestamp)>) {
+          handler(*payload, timestamp);
+        } else {
+          handler(*payload);
+        }
+      };
+      (call.template operator()<TPayloads>(), ...);
+    }
+    return handled;
+  }
+
+  [[nodiscard]] auto read_index() const noexcept -> std::size_t {
+    return read_index_;
+  }
+
+  // Events overwritten before this reader got to them, of any payload type.
+  [[nodiscard]] auto dropped() const noexcept -> std::uint64_t {
+    return dropped_;
+  }
+};
+} // namespace jage::engine::input
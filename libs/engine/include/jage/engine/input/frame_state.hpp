@@ -0,0 +1,139 @@
+#pragma once
+
+#include <jage/engine/input/gamepad/axis.hpp>
+#include <jage/engine/input/gamepad/button.hpp>
+#include <jage/engine/input/gamepad/id.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/modifier.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace jage::engine::input {
+// Input as of the end of one frame. The down sets carry over between frames;
+// pressed and released record every edge seen during the frame, so a key
+// tapped within a single frame reads as both pressed and released. Gamepad
+// buttons are indexed by gamepad, then button; axes keep their last value.
+struct frame_state {
+  static constexpr auto gamepad_button_count =
+      gamepad::id_count * gamepad::button_count;
+
+  std::bitset<keyboard::key_count> keys_down{};
+  std::bitset<keyboard::key_count> keys_pressed{};
+  std::bitset<keyboard::key_count> keys_released{};
+  std::bitset<keyboard::scancode_count> scancodes_down{};
+  std::bitset<keyboard::scancode_count> scancodes_pressed{};
+  std::bitset<keyboard::scancode_count> scancodes_released{};
+  std::bitset<mouse::button_count> buttons_down{};
+  std::bitset<mouse::button_count> buttons_pressed{};
+  std::bitset<mouse::button_count> buttons_released{};
+  std::bitset<gamepad_button_count> gamepad_buttons_down{};
+  std::bitset<gamepad_button_count> gamepad_buttons_pressed{};
+  std::bitset<gamepad_button_count> gamepad_buttons_released{};
+  std::array<std::array<double, gamepad::axis_count>, gamepad::id_count>
+      gamepad_axes{};
+  std::bitset<modifier_count> modifiers{};
+  double scroll_x{};
+  double scroll_y{};
+  double motion_x{};
+  double motion_y{};
+  double cursor_x{};
+  double cursor_y{};
+  std::uint64_t frame{};
+
+  [[nodiscard]] static constexpr auto
+  gamepad_button_index(const gamepad::id input_gamepad,
+                       const gamepad::button input_button) noexcept
+      -> std::size_t {
+    return input_gamepad * gamepad::button_count +
+           std::to_underlying(input_button);
+  }
+
+  [[nodiscard]] constexpr auto
+  is_down(const keyboard::key input_key) const noexcept -> bool {
+    return keys_down[std::to_underlying(input_key)];
+  }
+
+  [[nodiscard]] constexpr auto
+  is_down(const keyboard::scancode input_scancode) const noexcept -> bool {
+    return scancodes_down[std::to_underlying(input_scancode)];
+  }
+
+  [[nodiscard]] constexpr auto
+  is_down(const mouse::button input_button) const noexcept -> bool {
+    return buttons_down[std::to_underlying(input_button)];
+  }
+
+  [[nodiscard]] constexpr auto
+  was_pressed(const keyboard::key input_key) const noexcept -> bool {
+    return keys_pressed[std::to_underlying(input_key)];
+  }
+
+  [[nodiscard]] constexpr auto
+  was_pressed(const keyboard::scancode input_scancode) const noexcept -> bool {
+    return scancodes_pressed[std::to_underlying(input_scancode)];
+  }
+
+  [[nodiscard]] constexpr auto
+  was_pressed(const mouse::button input_button) const noexcept -> bool {
+    return buttons_pressed[std::to_underlying(input_button)];
+  }
+
+  [[nodiscard]] constexpr auto
+  was_released(const keyboard::key input_key) const noexcept -> bool {
+    return keys_released[std::to_underlying(input_key)];
+  }
+
+  [[nodiscard]] constexpr auto
+  was_released(const keyboard::scancode input_scancode) const noexcept
+      -> bool {
+    return scancodes_released[std::to_underlying(input_scancode)];
+  }
+
+  [[nodiscard]] constexpr auto
+  was_released(const mouse::button input_button) const noexcept -> bool {
+    return buttons_released[std::to_underlying(input_button)];
+  }
+
+  [[nodiscard]] constexpr auto
+  is_down(const gamepad::id input_gamepad,
+          const gamepad::button input_button) const noexcept -> bool {
+    return gamepad_buttons_down[gamepad_button_index(input_gamepad,
+                                                     input_button)];
+  }
+
+  [[nodiscard]] constexpr auto
+  was_pressed(const gamepad::id input_gamepad,
+              const gamepad::button input_button) const noexcept -> bool {
+    return gamepad_buttons_pressed[gamepad_button_index(input_gamepad,
+                                                        input_button)];
+  }
+
+  [[nodiscard]] constexpr auto
+  was_released(const gamepad::id input_gamepad,
+               const gamepad::button input_button) const noexcept -> bool {
+    return gamepad_buttons_released[gamepad_button_index(input_gamepad,
+                                                         input_button)];
+  }
+
+  [[nodiscard]] constexpr auto
+  axis(const gamepad::id input_gamepad,
+       const gamepad::axis input_axis) const noexcept -> double {
+    return gamepad_axes[input_gamepad][std::to_underlying(input_axis)];
+  }
+
+  [[nodiscard]] constexpr auto
+  is_modifier_active(const modifier input_modifier) const noexcept -> bool {
+    return modifiers[std::to_underlying(input_modifier)];
+  }
+};
+
+static_assert(std::is_trivially_copyable_v<frame_state>);
+static_assert(sizeof(frame_state) % sizeof(std::uint64_t) == 0UZ);
+} // namespace jage::engine::input
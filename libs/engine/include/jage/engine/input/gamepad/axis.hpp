@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace jage::engine::input::gamepad {
+enum class axis : std::uint8_t {
+  left_x,
+  left_y,
+  right_x,
+  right_y,
+  left_trigger,
+  right_trigger,
+  last = right_trigger,
+};
+
+static constexpr auto axis_count = std::to_underlying(axis::last) + 1UZ;
+
+[[nodiscard]] constexpr auto
+serialize(const axis input_axis) -> std::string_view {
+  switch (input_axis) {
+  case axis::left_x:
+    return "left_x";
+  case axis::left_y:
+    return "left_y";
+  case axis::right_x:
+    return "right_x";
+  case axis::right_y:
+    return "right_y";
+  case axis::left_trigger:
+    return "left_trigger";
+  case axis::right_trigger:
+    return "right_trigger";
+  default:
+    return "unknown enumerator";
+  }
+}
+} // namespace jage::engine::input::gamepad
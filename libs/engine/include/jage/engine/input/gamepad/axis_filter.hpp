@@ -0,0 +1,41 @@
+#pragma once
+
+#include <jage/engine/input/gamepad/axis.hpp>
+
+#include <cstdint>
+
+namespace jage::engine::input::gamepad {
+// Snaps raw axis readings to a fixed number of levels on each side of rest,
+// with readings inside dead_zone snapped to rest, so sensor noise on an idle
+// or steadily held stick produces the same level frame after frame. The dead
+// zone is applied per axis and the range outside it is rescaled, so the
+// first level past it is still small.
+struct axis_filter {
+  double dead_zone{0.1};
+  std::int16_t levels{128};
+
+  // Sticks read -1 to 1. Triggers, which GLFW reports from -1 at rest, are
+  // shifted to 0 to 1 first.
+  [[nodiscard]] constexpr auto
+  quantize(const axis input_axis, const double raw) const noexcept
+      -> std::int16_t {
+    const auto is_trigger =
+        axis::left_trigger == input_axis or axis::right_trigger == input_axis;
+    const auto position = is_trigger ? (raw + 1.0) / 2.0 : raw;
+    const auto magnitude =
+        position < 0.0 ? (position < -1.0 ? 1.0 : -position)
+                       : (position > 1.0 ? 1.0 : position);
+    if (not(magnitude > dead_zone)) {
+      return 0;
+    }
+    const auto scaled = (magnitude - dead_zone) / (1.0 - dead_zone);
+    const auto level = static_cast<std::int16_t>(scaled * levels + 0.5);
+    return position < 0.0 ? static_cast<std::int16_t>(-level) : level;
+  }
+
+  [[nodiscard]] constexpr auto
+  value(const std::int16_t level) const noexcept -> double {
+    return static_cast<double>(level) / static_cast<double>(levels);
+  }
+};
+} // namespace jage::engine::input::gamepad
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+namespace jage::engine::input::gamepad {
+enum class button : std::uint8_t {
+  a,
+  b,
+  x,
+  y,
+  left_bumper,
+  right_bumper,
+  back,
+  start,
+  guide,
+  left_thumb,
+  right_thumb,
+  dpad_up,
+  dpad_right,
+  dpad_down,
+  dpad_left,
+  last = dpad_left,
+};
+
+static constexpr auto button_count = std::to_underlying(button::last) + 1UZ;
+
+[[nodiscard]] constexpr auto
+serialize(const button input_button) -> std::string_view {
+  switch (input_button) {
+  case button::a:
+    return "a";
+  case button::b:
+    return "b";
+  case button::x:
+    return "x";
+  case button::y:
+    return "y";
+  case button::left_bumper:
+    return "left_bumper";
+  case button::right_bumper:
+    return "right_bumper";
+  case button::back:
+    return "back";
+  case button::start:
+    return "start";
+  case button::guide:
+    return "guide";
+  case button::left_thumb:
+    return "left_thumb";
+  case button::right_thumb:
+    return "right_thumb";
+  case button::dpad_up:
+    return "dpad_up";
+  case button::dpad_right:
+    return "dpad_right";
+  case button::dpad_down:
+    return "dpad_down";
+  case button::dpad_left:
+    return "dpad_left";
+  default:
+    return "unknown enumerator";
+  }
+}
+} // namespace jage::engine::input::gamepad
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <jage/engine/input/gamepad/axis.hpp>
+#include <jage/engine/input/gamepad/id.hpp>
+
+namespace jage::engine::input::gamepad::events {
+// value is the axis position after dead-zone filtering: -1 to 1 for sticks,
+// 0 (released) to 1 for triggers.
+struct axis_motion {
+  gamepad::id gamepad;
+  gamepad::axis axis;
+  double value;
+};
+} // namespace jage::engine::input::gamepad::events
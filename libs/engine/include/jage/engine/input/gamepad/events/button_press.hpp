@@ -0,0 +1,13 @@
+#pragma once
+
+#include <jage/engine/input/gamepad/action.hpp>
+#include <jage/engine/input/gamepad/button.hpp>
+#include <jage/engine/input/gamepad/id.hpp>
+
+namespace jage::engine::input::gamepad::events {
+struct button_press {
+  gamepad::id gamepad;
+  gamepad::button button;
+  gamepad::action action;
+};
+} // namespace jage::engine::input::gamepad::events
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+namespace jage::engine::input::gamepad {
+// Which connected gamepad an event came from, as GLFW numbers joysticks.
+using id = std::uint8_t;
+
+static constexpr auto id_count = 16UZ;
+} // namespace jage::engine::input::gamepad
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/cursor/position.hpp>
+#include <jage/engine/input/window_id.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <utility>
+#include <variant>
+
+namespace jage::engine::input::internal {
+// The folding behind coalescing::cursor. A run is consecutive cursor reports
+// of one kind from one window, so when several windows share a coalescer a
+// report from another window ends the run like any other event would.
+template <class TEvent> class cursor_coalescer {
+  static constexpr auto no_run_ = std::variant_npos;
+
+  std::size_t run_index_{no_run_};
+  window_id run_window_{};
+  std::optional<TEvent> pending_{};
+
+  [[nodiscard]] static constexpr auto is_cursor_event(const TEvent &event)
+      -> bool {
+    return std::holds_alternative<mouse::events::cursor::motion>(
+               event.payload) or
+           std::holds_alternative<mouse::events::cursor::position>(
+               event.payload);
+  }
+
+  auto merge(const TEvent &event) -> void {
+    if (not pending_) {
+      pending_ = event;
+      return;
+    }
+    pending_->timestamp = event.timestamp;
+    if (const auto *motion =
+            std::get_if<mouse::events::cursor::motion>(&event.payload)) {
+      auto &accumulated =
+          std::get<mouse::events::cursor::motion>(pending_->payload);
+      accumulated.delta_x += motion->delta_x;
+      accumulated.delta_y += motion->delta_y;
+    } else {
+      pending_->payload = event.payload;
+    }
+  }
+
+public:
+  // Returns true when the event was folded into the pending run and must not
+  // be forwarded. A run the event ends is pushed to sink first.
+  template <class TEventSink>
+  [[nodiscard]] auto coalesce(const TEvent &event, TEventSink &sink) -> bool {
+    if (not is_cursor_event(event)) {
+      flush(sink);
+      return false;
+    }
+    if (run_index_ == event.payload.index() and run_window_ == event.window) {
+      merge(event);
+      return true;
+    }
+    flush(sink);
+    run_index_ = event.payload.index();
+    run_window_ = event.window;
+    return false;
+  }
+
+  template <class TEventSink> auto flush(TEventSink &sink) -> void {
+    if (pending_) {
+      sink.push(std::move(*pending_));
+      pending_.reset();
+    }
+    run_index_ = no_run_;
+  }
+};
+} // namespace jage::engine::input::internal
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <jage/mp/at.hpp>
+#include <jage/mp/size.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <variant>
+
+namespace jage::engine::input::internal {
+template <class TEvent, std::size_t Index, class THandler>
+auto dispatch_payloads(const std::span<const TEvent> events,
+                       const std::span<const std::uint16_t> order,
+                       THandler &handler) -> void {
+  using payload_type = mp::at<typename TEvent::payload_list, Index>;
+  using duration_type = decltype(TEvent::timestamp);
+  if constexpr (std::invocable<THandler &, const payload_type &,
+                               const duration_type &>) {
+    for (const auto index : order) {
+      const auto &input_event = events[index];
+      handler(*std::get_if<Index>(&input_event.payload),
+              input_event.timestamp);
+    }
+  } else if constexpr (std::invocable<THandler &, const payload_type &>) {
+    for (const auto index : order) {
+      handler(*std::get_if<Index>(&events[index].payload));
+    }
+  }
+}
+
+template <class TEvent, std::size_t BatchSize, class THandler>
+auto dispatch_batch(const std::span<const TEvent> events,
+                    THandler &handler) -> void {
+  static constexpr auto payload_count = mp::size<typename TEvent::payload_list>;
+  auto starts = std::array<std::uint16_t, payload_count + 1UZ>{};
+  for (const auto &input_event : events) {
+    ++starts[input_event.payload.index() + 1UZ];
+  }
+  for (auto index = 1UZ; index < std::size(starts); ++index) {
+    starts[index] += starts[index - 1UZ];
+  }
+
+  auto order = std::array<std::uint16_t, BatchSize>{};
+  auto next = starts;
+  for (auto index = 0UZ; index < std::size(events); ++index) {
+    order[next[events[index].payload.index()]++] =
+        static_cast<std::uint16_t>(index);
+  }
+
+  [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+    (dispatch_payloads<TEvent, Index>(
+         events,
+         std::span{std::data(order) + starts[Index],
+                   std::data(order) + starts[Index + 1UZ]},
+         handler),
+     ...);
+  }(std::make_index_sequence<payload_count>{});
+}
+} // namespace jage::engine::input::internal
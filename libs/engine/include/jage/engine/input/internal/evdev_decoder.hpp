@@ -0,0 +1,425 @@
+#pragma once
+
+#if !defined(__linux__)
+#error "evdev input is only available on Linux"
+#endif
+
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/modifier.hpp>
+#include <jage/engine/input/mouse/action.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/horizontal_scroll.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+
+#include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include <linux/input.h>
+
+namespace jage::engine::input::internal {
+struct evdev_key_binding {
+  std::uint16_t code;
+  keyboard::scancode scancode;
+};
+
+inline constexpr auto evdev_key_bindings = std::to_array<evdev_key_binding>({
+    {KEY_A, keyboard::scancode::a},
+    {KEY_B, keyboard::scancode::b},
+    {KEY_C, keyboard::scancode::c},
+    {KEY_D, keyboard::scancode::d},
+    {KEY_E, keyboard::scancode::e},
+    {KEY_F, keyboard::scancode::f},
+    {KEY_G, keyboard::scancode::g},
+    {KEY_H, keyboard::scancode::h},
+    {KEY_I, keyboard::scancode::i},
+    {KEY_J, keyboard::scancode::j},
+    {KEY_K, keyboard::scancode::k},
+    {KEY_L, keyboard::scancode::l},
+    {KEY_M, keyboard::scancode::m},
+    {KEY_N, keyboard::scancode::n},
+    {KEY_O, keyboard::scancode::o},
+    {KEY_P, keyboard::scancode::p},
+    {KEY_Q, keyboard::scancode::q},
+    {KEY_R, keyboard::scancode::r},
+    {KEY_S, keyboard::scancode::s},
+    {KEY_T, keyboard::scancode::t},
+    {KEY_U, keyboard::scancode::u},
+    {KEY_V, keyboard::scancode::v},
+    {KEY_W, keyboard::scancode::w},
+    {KEY_X, keyboard::scancode::x},
+    {KEY_Y, keyboard::scancode::y},
+    {KEY_Z, keyboard::scancode::z},
+    {KEY_1, keyboard::scancode::_1},
+    {KEY_2, keyboard::scancode::_2},
+    {KEY_3, keyboard::scancode::_3},
+    {KEY_4, keyboard::scancode::_4},
+    {KEY_5, keyboard::scancode::_5},
+    {KEY_6, keyboard::scancode::_6},
+    {KEY_7, keyboard::scancode::_7},
+    {KEY_8, keyboard::scancode::_8},
+    {KEY_9, keyboard::scancode::_9},
+    {KEY_0, keyboard::scancode::_0},
+    {KEY_ENTER, keyboard::scancode::enter},
+    {KEY_ESC, keyboard::scancode::escape},
+    {KEY_BACKSPACE, keyboard::scancode::backspace},
+    {KEY_TAB, keyboard::scancode::tab},
+    {KEY_SPACE, keyboard::scancode::spacebar},
+    {KEY_MINUS, keyboard::scancode::minus},
+    {KEY_EQUAL, keyboard::scancode::equal},
+    {KEY_LEFTBRACE, keyboard::scancode::left_bracket},
+    {KEY_RIGHTBRACE, keyboard::scancode::right_bracket},
+    {KEY_BACKSLASH, keyboard::scancode::backslash},
+    {KEY_SEMICOLON, keyboard::scancode::semicolon},
+    {KEY_APOSTROPHE, keyboard::scancode::apostrophe},
+    {KEY_GRAVE, keyboard::scancode::grave_accent},
+    {KEY_COMMA, keyboard::scancode::comma},
+    {KEY_DOT, keyboard::scancode::period},
+    {KEY_SLASH, keyboard::scancode::slash},
+    {KEY_CAPSLOCK, keyboard::scancode::caps_lock},
+    {KEY_F1, keyboard::scancode::F1},
+    {KEY_F2, keyboard::scancode::F2},
+    {KEY_F3, keyboard::scancode::F3},
+    {KEY_F4, keyboard::scancode::F4},
+    {KEY_F5, keyboard::scancode::F5},
+    {KEY_F6, keyboard::scancode::F6},
+    {KEY_F7, keyboard::scancode::F7},
+    {KEY_F8, keyboard::scancode::F8},
+    {KEY_F9, keyboard::scancode::F9},
+    {KEY_F10, keyboard::scancode::F10},
+    {KEY_F11, keyboard::scancode::F11},
+    {KEY_F12, keyboard::scancode::F12},
+    {KEY_SYSRQ, keyboard::scancode::print_screen},
+    {KEY_SCROLLLOCK, keyboard::scancode::scroll_lock},
+    {KEY_PAUSE, keyboard::scancode::pause},
+    {KEY_INSERT, keyboard::scancode::insert},
+    {KEY_HOME, keyboard::scancode::home},
+    {KEY_PAGEUP, keyboard::scancode::page_up},
+    {KEY_DELETE, keyboard::scancode::delete_key},
+    {KEY_END, keyboard::scancode::end},
+    {KEY_PAGEDOWN, keyboard::scancode::page_down},
+    {KEY_RIGHT, keyboard::scancode::arrow_right},
+    {KEY_LEFT, keyboard::scancode::arrow_left},
+    {KEY_DOWN, keyboard::scancode::arrow_down},
+    {KEY_UP, keyboard::scancode::arrow_up},
+    {KEY_NUMLOCK, keyboard::scancode::num_lock},
+    {KEY_KPSLASH, keyboard::scancode::kp_divide},
+    {KEY_KPASTERISK, keyboard::scancode::kp_multiply},
+    {KEY_KPMINUS, keyboard::scancode::kp_subtract},
+    {KEY_KPPLUS, keyboard::scancode::kp_add},
+    {KEY_KPENTER, keyboard::scancode::kp_enter},
+    {KEY_KP1, keyboard::scancode::kp_1},
+    {KEY_KP2, keyboard::scancode::kp_2},
+    {KEY_KP3, keyboard::scancode::kp_3},
+    {KEY_KP4, keyboard::scancode::kp_4},
+    {KEY_KP5, keyboard::scancode::kp_5},
+    {KEY_KP6, keyboard::scancode::kp_6},
+    {KEY_KP7, keyboard::scancode::kp_7},
+    {KEY_KP8, keyboard::scancode::kp_8},
+    {KEY_KP9, keyboard::scancode::kp_9},
+    {KEY_KP0, keyboard::scancode::kp_0},
+    {KEY_KPDOT, keyboard::scancode::kp_decimal},
+    {KEY_102ND, keyboard::scancode::world_1},
+    {KEY_RO, keyboard::scancode::world_2},
+    {KEY_KPEQUAL, keyboard::scancode::kp_equal},
+    {KEY_COMPOSE, keyboard::scancode::menu},
+    {KEY_F13, keyboard::scancode::F13},
+    {KEY_F14, keyboard::scancode::F14},
+    {KEY_F15, keyboard::scancode::F15},
+    {KEY_F16, keyboard::scancode::F16},
+    {KEY_F17, keyboard::scancode::F17},
+    {KEY_F18, keyboard::scancode::F18},
+    {KEY_F19, keyboard::scancode::F19},
+    {KEY_F20, keyboard::scancode::F20},
+    {KEY_F21, keyboard::scancode::F21},
+    {KEY_F22, keyboard::scancode::F22},
+    {KEY_F23, keyboard::scancode::F23},
+    {KEY_F24, keyboard::scancode::F24},
+    {KEY_OPEN, keyboard::scancode::execute},
+    {KEY_LEFTCTRL, keyboard::scancode::left_control},
+    {KEY_LEFTSHIFT, keyboard::scancode::left_shift},
+    {KEY_LEFTALT, keyboard::scancode::left_alt},
+    {KEY_LEFTMETA, keyboard::scancode::left_super},
+    {KEY_RIGHTCTRL, keyboard::scancode::right_control},
+    {KEY_RIGHTSHIFT, keyboard::scancode::right_shift},
+    {KEY_RIGHTALT, keyboard::scancode::right_alt},
+    {KEY_RIGHTMETA, keyboard::scancode::right_super},
+});
+
+// Keyboard codes all sit below BTN_MISC; everything above is a button.
+inline constexpr auto evdev_scancodes = [] {
+  auto scancodes = std::array<keyboard::scancode, BTN_MISC>{};
+  scancodes.fill(keyboard::scancode::unidentified);
+  for (const auto &binding : evdev_key_bindings) {
+    scancodes[binding.code] = binding.scancode;
+  }
+  return scancodes;
+}();
+
+[[nodiscard]] constexpr auto
+to_scancode(const std::uint16_t code) noexcept -> keyboard::scancode {
+  return code < std::size(evdev_scancodes) ? evdev_scancodes[code]
+                                           : keyboard::scancode::unidentified;
+}
+
+[[nodiscard]] constexpr auto
+to_button(const std::uint16_t code) noexcept -> std::optional<mouse::button> {
+  switch (code) {
+  case BTN_LEFT:
+    return mouse::button::left;
+  case BTN_RIGHT:
+    return mouse::button::right;
+  case BTN_MIDDLE:
+    return mouse::button::middle;
+  case BTN_SIDE:
+  case BTN_BACK:
+    return mouse::button::back;
+  case BTN_EXTRA:
+  case BTN_FORWARD:
+    return mouse::button::forward;
+  case BTN_TASK:
+    return mouse::button::action;
+  default:
+    return std::nullopt;
+  }
+}
+
+[[nodiscard]] constexpr auto
+to_modifier(const std::uint16_t code) noexcept -> std::optional<modifier> {
+  switch (code) {
+  case KEY_LEFTCTRL:
+    return modifier::left_control;
+  case KEY_LEFTSHIFT:
+    return modifier::left_shift;
+  case KEY_LEFTALT:
+    return modifier::left_alt;
+  case KEY_LEFTMETA:
+    return modifier::left_gui;
+  case KEY_RIGHTCTRL:
+    return modifier::right_control;
+  case KEY_RIGHTSHIFT:
+    return modifier::right_shift;
+  case KEY_RIGHTALT:
+    return modifier::right_alt;
+  case KEY_RIGHTMETA:
+    return modifier::right_gui;
+  default:
+    return std::nullopt;
+  }
+}
+
+// Turns one device's input_event stream into engine events. Keys and buttons
+// are pushed as they arrive; relative axes are summed and pushed as one
+// motion or scroll event per SYN_REPORT. After SYN_DROPPED the kernel has
+// lost events, so everything up to the next SYN_REPORT is discarded and
+// resync_pending() turns true: the owner then reads the device's key and LED
+// state and hands it to resync(), which pushes the presses and releases that
+// were lost so no key or modifier stays stuck.
+//
+// evdev only knows physical keys, the layout lives in the compositor, so key
+// presses carry keyboard::key::unidentified.
+template <time::internal::concepts::real_number_duration TTimeDuration,
+          class TEvent>
+class evdev_decoder {
+public:
+  using key_state = std::bitset<KEY_CNT>;
+  using led_state = std::bitset<LED_CNT>;
+
+private:
+  std::bitset<modifier_count> modifiers_{};
+  key_state pressed_{};
+  ::input_event resync_report_{};
+  double motion_x_{};
+  double motion_y_{};
+  double vertical_scroll_{};
+  double horizontal_scroll_{};
+  bool dropping_{};
+  bool resync_pending_{};
+  std::uint64_t dropped_reports_{};
+
+  [[nodiscard]] static auto
+  timestamp(const ::input_event &input) -> TTimeDuration {
+    return std::chrono::duration_cast<TTimeDuration>(
+        std::chrono::seconds{input.input_event_sec} +
+        std::chrono::microseconds{input.input_event_usec});
+  }
+
+  auto decode_key(const ::input_event &input, auto &sink) -> std::size_t {
+    if (input.code < KEY_CNT and 2 != input.value) {
+      pressed_.set(input.code, 0 != input.value);
+    }
+    if (const auto button = to_button(input.code)) {
+      if (2 == input.value) {
+        return 0UZ;
+      }
+      sink.push(TEvent{
+          .timestamp = timestamp(input),
+          .payload =
+              mouse::events::click{
+                  .button = *button,
+                  .action = 0 == input.value ? mouse::action::release
+                                             : mouse::action::press,
+                  .modifiers = modifiers_,
+              },
+      });
+      return 1UZ;
+    }
+    if (input.code >= BTN_MISC) {
+      return 0UZ;
+    }
+    sink.push(TEvent{
+        .timestamp = timestamp(input),
+        .payload =
+            keyboard::events::key_press{
+                .key = keyboard::key::unidentified,
+                .scancode = to_scancode(input.code),
+                .action = static_cast<keyboard::action>(input.value),
+                .modifiers = modifiers_,
+            },
+    });
+    if (const auto held = to_modifier(input.code)) {
+      modifiers_.set(std::to_underlying(*held), 0 != input.value);
+    }
+    return 1UZ;
+  }
+
+  auto decode_relative(const ::input_event &input) -> void {
+    const auto value = static_cast<double>(input.value);
+    switch (input.code) {
+    case REL_X:
+      motion_x_ += value;
+      break;
+    case REL_Y:
+      motion_y_ += value;
+      break;
+    case REL_WHEEL:
+      vertical_scroll_ += value;
+      break;
+    case REL_HWHEEL:
+      horizontal_scroll_ += value;
+      break;
+    default:
+      break;
+    }
+  }
+
+  auto decode_led(const ::input_event &input) -> void {
+    if (LED_NUML == input.code) {
+      modifiers_.set(std::to_underlying(modifier::num_lock), 0 != input.value);
+    } else if (LED_CAPSL == input.code) {
+      modifiers_.set(std::to_underlying(modifier::caps_lock),
+                     0 != input.value);
+    }
+  }
+
+  auto reset_axes() -> void {
+    motion_x_ = 0.0;
+    motion_y_ = 0.0;
+    vertical_scroll_ = 0.0;
+    horizontal_scroll_ = 0.0;
+  }
+
+  auto report(const ::input_event &input, auto &sink) -> std::size_t {
+    auto pushed = 0UZ;
+    const auto push = [&](const auto &payload) {
+      sink.push(TEvent{.timestamp = timestamp(input), .payload = payload});
+      ++pushed;
+    };
+    if (0.0 != motion_x_ or 0.0 != motion_y_) {
+      push(mouse::events::cursor::motion{.delta_x = motion_x_,
+                                         .delta_y = motion_y_});
+    }
+    if (0.0 != vertical_scroll_) {
+      push(mouse::events::vertical_scroll{.offset = vertical_scroll_});
+    }
+    if (0.0 != horizontal_scroll_) {
+      push(mouse::events::horizontal_scroll{.offset = horizontal_scroll_});
+    }
+    reset_axes();
+    return pushed;
+  }
+
+public:
+  // Returns the number of events pushed into sink.
+  auto decode(const ::input_event &input, auto &sink) -> std::size_t {
+    if (EV_SYN == input.type) {
+      if (SYN_DROPPED == input.code) {
+        dropping_ = true;
+        ++dropped_reports_;
+        reset_axes();
+        return 0UZ;
+      }
+      if (SYN_REPORT == input.code) {
+        if (std::exchange(dropping_, false)) {
+          resync_pending_ = true;
+          resync_report_ = input;
+          return 0UZ;
+        }
+        return report(input, sink);
+      }
+      return 0UZ;
+    }
+    if (dropping_) {
+      return 0UZ;
+    }
+    switch (input.type) {
+    case EV_KEY:
+      return decode_key(input, sink);
+    case EV_REL:
+      decode_relative(input);
+      return 0UZ;
+    case EV_LED:
+      decode_led(input);
+      return 0UZ;
+    default:
+      return 0UZ;
+    }
+  }
+
+  // Brings tracked keys and locks in line with the device after a drop.
+  // Keys whose state differs from keys are pushed as presses or releases,
+  // stamped with the SYN_REPORT that ended the drop. Returns the number of
+  // events pushed into sink.
+  auto resync(const key_state &keys, const led_state &leds,
+              auto &sink) -> std::size_t {
+    resync_pending_ = false;
+    modifiers_.set(std::to_underlying(modifier::num_lock), leds[LED_NUML]);
+    modifiers_.set(std::to_underlying(modifier::caps_lock), leds[LED_CAPSL]);
+    auto pushed = 0UZ;
+    auto input = resync_report_;
+    input.type = EV_KEY;
+    for (auto code = 0UZ; code < KEY_CNT; ++code) {
+      if (keys[code] != pressed_[code]) {
+        input.code = static_cast<std::uint16_t>(code);
+        input.value = keys[code] ? 1 : 0;
+        pushed += decode_key(input, sink);
+      }
+    }
+    return pushed;
+  }
+
+  [[nodiscard]] auto resync_pending() const noexcept -> bool {
+    return resync_pending_;
+  }
+
+  [[nodiscard]] auto dropped_reports() const noexcept -> std::uint64_t {
+    return dropped_reports_;
+  }
+
+  [[nodiscard]] auto
+  modifiers() const noexcept -> const std::bitset<modifier_count> & {
+    return modifiers_;
+  }
+};
+} // namespace jage::engine::input::internal
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <jage/engine/input/window_id.hpp>
 #include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+#include <jage/mp/list.hpp>
 
 #include <variant>
 
@@ -9,7 +11,11 @@ template <time::internal::concepts::real_number_duration TTimeDuration,
           class... TPayloads>
 struct event {
   using payload_type = std::variant<TPayloads...>;
+  using payload_list = mp::list<TPayloads...>;
   TTimeDuration timestamp;
-  payload_type payload;
+  // Lets window sit in the variant's tail padding, keeping events the size
+  // they were without it.
+  [[no_unique_address]] payload_type payload;
+  window_id window{};
 };
 } // namespace jage::engine::input::internal
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <jage/engine/input/latency_statistics.hpp>
+#include <jage/engine/metrics/log_histogram.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/mp/size.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace jage::engine::input::internal {
+template <class TEvent, bool Enabled,
+          template <class, template <class> class> class TBuffer,
+          template <class> class TAtomic>
+  requires requires { typename TEvent::payload_list; }
+class latency_probe {
+  using duration_type_ = decltype(TEvent::timestamp);
+  static constexpr auto payload_count_ =
+      mp::size<typename TEvent::payload_list>;
+  using statistics_type_ = latency_statistics<duration_type_, payload_count_>;
+  using latency_histogram_type_ = metrics::log_histogram<5U, 40U>;
+  using depth_histogram_type_ = metrics::log_histogram<5U, 32U>;
+
+  std::array<latency_histogram_type_, payload_count_> latencies_{};
+  depth_histogram_type_ depths_{};
+  duration_type_ now_{};
+  TBuffer<statistics_type_, TAtomic> statistics_{};
+
+  template <class TValue, class THistogram>
+  [[nodiscard]] static auto summarize(const THistogram &histogram,
+                                      const auto &to_value)
+      -> percentile_summary<TValue> {
+    const auto [p50, p95, p99] =
+        histogram.values_at_percentiles(std::array{50.0, 95.0, 99.0});
+    return {
+        .count = histogram.count(),
+        .p50 = to_value(p50),
+        .p95 = to_value(p95),
+        .p99 = to_value(p99),
+        .max = to_value(histogram.max()),
+    };
+  }
+
+public:
+  using duration_type = duration_type_;
+  using statistics_type = statistics_type_;
+
+  static constexpr auto enabled = true;
+
+  // Call as the consumer starts draining, with how many events are waiting
+  // in the ring (write_head() - read index). now is read once and stamps
+  // every record() until the next drain.
+  template <std::invocable TNow>
+  auto start_drain(TNow &&now, const std::size_t depth) -> void {
+    now_ = std::invoke(now);
+    depths_.record(depth);
+  }
+
+  auto record(const TEvent &input_event) noexcept -> void {
+    const auto age =
+        time::cast<time::nanoseconds>(now_ - input_event.timestamp).count();
+    latencies_[input_event.payload.index()].record(static_cast<std::uint64_t>(
+        std::clamp(age, 0.0,
+                   static_cast<double>(latency_histogram_type_::max_value()))));
+  }
+
+  // Summarizes everything recorded so far for read() on any thread.
+  auto publish() -> void {
+    const auto to_duration = [](const std::uint64_t value) -> duration_type_ {
+      return time::cast<duration_type_>(
+          time::nanoseconds{static_cast<double>(value)});
+    };
+    auto statistics = statistics_type_{};
+    for (auto index = 0UZ; index < payload_count_; ++index) {
+      statistics.payloads[index] =
+          summarize<duration_type_>(latencies_[index], to_duration);
+    }
+    statistics.depth = summarize<std::uint64_t>(
+        depths_, [](const std::uint64_t value) { return value; });
+    statistics_.write(statistics);
+  }
+
+  auto reset() -> void {
+    for (auto &histogram : latencies_) {
+      histogram.reset();
+    }
+    depths_.reset();
+  }
+
+  [[nodiscard]] auto read() const -> statistics_type_ {
+    return statistics_.read();
+  }
+};
+
+// With instrumentation off the probe holds nothing, never calls now, and
+// every call inlines away.
+template <class TEvent, template <class, template <class> class> class TBuffer,
+          template <class> class TAtomic>
+  requires requires { typename TEvent::payload_list; }
+class latency_probe<TEvent, false, TBuffer, TAtomic> {
+public:
+  using duration_type = decltype(TEvent::timestamp);
+  using statistics_type =
+      latency_statistics<duration_type,
+                         mp::size<typename TEvent::payload_list>>;
+
+  static constexpr auto enabled = false;
+
+  template <std::invocable TNow>
+  constexpr auto start_drain(TNow &&, const std::size_t) noexcept -> void {}
+
+  constexpr auto record(const TEvent &) noexcept -> void {}
+
+  constexpr auto publish() noexcept -> void {}
+
+  constexpr auto reset() noexcept -> void {}
+
+  [[nodiscard]] constexpr auto read() const noexcept -> statistics_type {
+    return {};
+  }
+};
+} // namespace jage::engine::input::internal
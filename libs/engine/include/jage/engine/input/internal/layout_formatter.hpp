@@ -0,0 +1,24 @@
+#pragma once
+
+#include <fmt/format.h>
+
+namespace jage::engine::input::internal {
+// Format spec shared by the event formatters: "{}" lays an event out over
+// several lines, "{:c}" keeps it to one.
+struct layout_formatter {
+  bool compact{};
+
+  constexpr auto parse(fmt::format_parse_context &ctx)
+      -> fmt::format_parse_context::iterator {
+    auto position = ctx.begin();
+    if (position != ctx.end() and 'c' == *position) {
+      compact = true;
+      ++position;
+    }
+    if (position != ctx.end() and '}' != *position) {
+      throw fmt::format_error{"Event format spec must be empty or 'c'."};
+    }
+    return position;
+  }
+};
+} // namespace jage::engine::input::internal
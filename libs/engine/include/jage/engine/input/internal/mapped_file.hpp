@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) or defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <ios>
+#include <vector>
+#endif
+
+namespace jage::engine::input::internal {
+// Read-only view of a whole file. Mapped where the platform allows it, read
+// into memory otherwise.
+class mapped_file {
+#if defined(__unix__) or defined(__APPLE__)
+  std::byte *data_{nullptr};
+  std::size_t size_{};
+
+public:
+  explicit mapped_file(const std::filesystem::path &path) {
+    const auto descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) [[unlikely]] {
+      throw std::system_error{errno, std::generic_category(),
+                              "Unable to open " + path.string()};
+    }
+    struct stat status {};
+    if (::fstat(descriptor, &status) < 0) [[unlikely]] {
+      const auto error = errno;
+      ::close(descriptor);
+      throw std::system_error{error, std::generic_category(),
+                              "Unable to stat " + path.string()};
+    }
+    size_ = static_cast<std::size_t>(status.st_size);
+    if (0UZ != size_) {
+      auto *mapping =
+          ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      if (MAP_FAILED == mapping) [[unlikely]] {
+        const auto error = errno;
+        ::close(descriptor);
+        throw std::system_error{error, std::generic_category(),
+                                "Unable to map " + path.string()};
+      }
+      ::madvise(mapping, size_, MADV_SEQUENTIAL);
+      data_ = static_cast<std::byte *>(mapping);
+    }
+    ::close(descriptor);
+  }
+
+  mapped_file(const mapped_file &) = delete;
+  auto operator=(const mapped_file &) -> mapped_file & = delete;
+
+  mapped_file(mapped_file &&other) noexcept
+      : data_{std::exchange(other.data_, nullptr)},
+        size_{std::exchange(other.size_, 0UZ)} {}
+
+  auto operator=(mapped_file &&other) noexcept -> mapped_file & {
+    if (this != &other) {
+      std::swap(data_, other.data_);
+      std::swap(size_, other.size_);
+    }
+    return *this;
+  }
+
+  ~mapped_file() {
+    if (nullptr != data_) {
+      ::munmap(data_, size_);
+    }
+  }
+
+  [[nodiscard]] auto bytes() const noexcept -> std::span<const std::byte> {
+    return {data_, size_};
+  }
+#else
+  std::vector<std::byte> bytes_{};
+
+public:
+  explicit mapped_file(const std::filesystem::path &path) {
+    auto stream = std::ifstream{path, std::ios::binary};
+    if (not stream) [[unlikely]] {
+      throw std::system_error{errno, std::generic_category(),
+                              "Unable to open " + path.string()};
+    }
+    bytes_.resize(static_cast<std::size_t>(std::filesystem::file_size(path)));
+    stream.read(reinterpret_cast<char *>(std::data(bytes_)),
+                static_cast<std::streamsize>(std::size(bytes_)));
+  }
+
+  [[nodiscard]] auto bytes() const noexcept -> std::span<const std::byte> {
+    return bytes_;
+  }
+#endif
+};
+} // namespace jage::engine::input::internal
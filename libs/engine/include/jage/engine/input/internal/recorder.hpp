@@ -0,0 +1,212 @@
+#pragma once
+
+#include <jage/engine/input/encoded_event.hpp>
+#include <jage/engine/input/recording.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace jage::engine::input::internal {
+// Attaches to an event ring and a snapshot cache as one more consumer and
+// streams both to TWriter in 64 KiB blocks. The read heads belong to the
+// recorder, so the producer never waits on it; if it is lapped it skips ahead
+// and writes a dropped record in place of the overwritten events.
+template <class TRing, class TSnapshotCache, class TWriter>
+  requires requires(TWriter &writer, std::span<const std::byte> bytes) {
+    writer.write(bytes);
+  }
+class recorder {
+  using event_ =
+      std::remove_cvref_t<decltype(std::declval<const TRing &>().read(0UZ))>;
+  using duration_ = decltype(event_::timestamp);
+
+  static constexpr auto block_size_ = 64UZ * 1024UZ;
+  static constexpr auto batch_size_ = 64UZ;
+
+  const TRing *ring_;
+  const TSnapshotCache *snapshots_;
+  TWriter writer_;
+  std::unique_ptr<std::byte[]> block_{
+      std::make_unique_for_overwrite<std::byte[]>(block_size_)};
+  std::size_t block_used_{};
+  std::uint64_t event_head_{};
+  std::uint64_t snapshot_head_{};
+  std::array<event_, batch_size_> batch_{};
+  std::atomic<std::uint64_t> recorded_events_{};
+  std::atomic<std::uint64_t> recorded_snapshots_{};
+  std::atomic<std::uint64_t> dropped_events_{};
+  std::jthread thread_{};
+
+  template <class TRecord>
+  auto append(const recording::record_kind kind, const TRecord &record)
+      -> void {
+    static constexpr auto size =
+        sizeof(recording::record_header) + sizeof(TRecord);
+    if (block_used_ + size > block_size_) [[unlikely]] {
+      flush();
+    }
+    const auto header = recording::record_header{.kind = kind};
+    std::memcpy(block_.get() + block_used_, &header, sizeof(header));
+    std::memcpy(block_.get() + block_used_ + sizeof(header), &record,
+                sizeof(TRecord));
+    block_used_ += size;
+  }
+
+  auto drop(const std::uint64_t count) -> void {
+    append(recording::record_kind::dropped,
+           recording::dropped_record{.count = count});
+    dropped_events_.fetch_add(count, std::memory_order::relaxed);
+  }
+
+  [[nodiscard]] auto is_lapped(const std::uint64_t write_head,
+                               const std::uint64_t index) const -> bool {
+    return write_head - index >= ring_->capacity();
+  }
+
+  auto record_snapshots_until(const std::uint64_t snapshot_head,
+                              const duration_ timestamp) -> void {
+    for (; snapshot_head_ < snapshot_head; ++snapshot_head_) {
+      const auto snapshot = snapshots_->read(snapshot_head_);
+      if (snapshot.real_time > timestamp) {
+        return;
+      }
+      append(recording::record_kind::snapshot, recording::encode(snapshot));
+      recorded_snapshots_.fetch_add(1U, std::memory_order::relaxed);
+    }
+  }
+
+public:
+  static constexpr auto default_poll_interval = std::chrono::milliseconds{1};
+
+  recorder(const TRing &ring, const TSnapshotCache &snapshots,
+           auto &&...writer_arguments)
+      : ring_{&ring}, snapshots_{&snapshots},
+        writer_(std::forward<decltype(writer_arguments)>(writer_arguments)...),
+        event_head_{ring.write_head()},
+        snapshot_head_{snapshots.write_index()} {
+    const auto header = recording::header<duration_>();
+    std::memcpy(block_.get(), &header, sizeof(header));
+    block_used_ = sizeof(header);
+  }
+
+  recorder(const recorder &) = delete;
+  recorder(recorder &&) = delete;
+  auto operator=(const recorder &) -> recorder & = delete;
+  auto operator=(recorder &&) -> recorder & = delete;
+
+  ~recorder() {
+    stop();
+    flush();
+  }
+
+  // Drains everything published since the last call and returns how many
+  // events and snapshots it consumed, dropped ones included. The background
+  // thread calls this in a loop, so only call it directly when not running.
+  auto poll() -> std::size_t {
+    const auto snapshot_head = snapshots_->write_index();
+    snapshot_head_ = std::max(snapshot_head_,
+                              snapshot_head > snapshots_->capacity() - 1UZ
+                                  ? snapshot_head - snapshots_->capacity() + 1UZ
+                                  : 0UZ);
+    const auto first_snapshot = snapshot_head_;
+    const auto first_event = event_head_;
+
+    for (auto write_head = ring_->write_head(); event_head_ < write_head;
+         write_head = ring_->write_head()) {
+      if (is_lapped(write_head, event_head_)) [[unlikely]] {
+        const auto oldest = write_head - ring_->capacity() + 1UZ;
+        drop(oldest - event_head_);
+        event_head_ = oldest;
+      }
+      const auto count =
+          std::min<std::uint64_t>(write_head - event_head_, batch_size_);
+      for (auto offset = 0UZ; offset < count; ++offset) {
+        batch_[offset] =
+            ring_->read((event_head_ + offset) % ring_->capacity());
+      }
+
+      auto overwritten = 0UZ;
+      if (const auto after = ring_->write_head();
+          is_lapped(after, event_head_)) [[unlikely]] {
+        const auto oldest = after - ring_->capacity() + 1UZ;
+        overwritten = static_cast<std::size_t>(
+            std::min<std::uint64_t>(oldest - event_head_, count));
+        drop(overwritten);
+      }
+      for (auto offset = overwritten; offset < count; ++offset) {
+        const auto &input_event = batch_[offset];
+        record_snapshots_until(snapshot_head, input_event.timestamp);
+        append(recording::record_kind::event, encode(input_event));
+      }
+      recorded_events_.fetch_add(count - overwritten,
+                                 std::memory_order::relaxed);
+      event_head_ += count;
+    }
+    record_snapshots_until(snapshot_head, duration_::max());
+    return static_cast<std::size_t>((snapshot_head_ - first_snapshot) +
+                                    (event_head_ - first_event));
+  }
+
+  auto flush() -> void {
+    if (0UZ == block_used_) {
+      return;
+    }
+    writer_.write(std::span<const std::byte>{block_.get(), block_used_});
+    block_used_ = 0UZ;
+  }
+
+  auto start(const std::chrono::nanoseconds poll_interval =
+                 default_poll_interval) -> void {
+    stop();
+    thread_ = std::jthread{[this, poll_interval](const std::stop_token stop) {
+      while (not stop.stop_requested()) {
+        if (0UZ == poll()) {
+          std::this_thread::sleep_for(poll_interval);
+        }
+      }
+      poll();
+      flush();
+    }};
+  }
+
+  auto stop() -> void {
+    if (thread_.joinable()) {
+      thread_.request_stop();
+      thread_.join();
+    }
+  }
+
+  [[nodiscard]] auto is_running() const noexcept -> bool {
+    return thread_.joinable();
+  }
+
+  [[nodiscard]] auto recorded_events() const -> std::uint64_t {
+    return recorded_events_.load(std::memory_order::relaxed);
+  }
+
+  [[nodiscard]] auto recorded_snapshots() const -> std::uint64_t {
+    return recorded_snapshots_.load(std::memory_order::relaxed);
+  }
+
+  [[nodiscard]] auto dropped_events() const -> std::uint64_t {
+    return dropped_events_.load(std::memory_order::relaxed);
+  }
+
+  [[nodiscard]] auto writer() noexcept -> TWriter & { return writer_; }
+
+  [[nodiscard]] auto writer() const noexcept -> const TWriter & {
+    return writer_;
+  }
+};
+} // namespace jage::engine::input::internal
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/frame_state.hpp>
+#include <jage/engine/input/gamepad/action.hpp>
+#include <jage/engine/input/gamepad/events/axis_motion.hpp>
+#include <jage/engine/input/gamepad/events/button_press.hpp>
+#include <jage/engine/input/gamepad/id.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/mouse/action.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/cursor/position.hpp>
+#include <jage/engine/input/mouse/events/horizontal_scroll.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+
+#include <jage/engine/concurrency/internal/concepts/buffer.hpp>
+#include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <utility>
+#include <variant>
+
+namespace jage::engine::input::internal {
+// Folds a frame's drained events into a frame_state. publish() hands the
+// finished frame to TBuffer for other threads and starts the next one.
+template <time::internal::concepts::real_number_duration TTimeDuration,
+          template <class, template <class> class> class TBuffer,
+          template <class> class TAtomic>
+  requires(concurrency::internal::concepts::buffer<
+           TBuffer<frame_state, TAtomic>>)
+class state {
+  frame_state current_{};
+  TBuffer<frame_state, TAtomic> published_{};
+
+  template <std::size_t Bits>
+  static auto set_edge(std::bitset<Bits> &down, std::bitset<Bits> &pressed,
+                       std::bitset<Bits> &released, const std::size_t index,
+                       const bool is_down) -> void {
+    if (index >= Bits) [[unlikely]] {
+      return;
+    }
+    if (is_down and not down[index]) {
+      pressed.set(index);
+    } else if (not is_down and down[index]) {
+      released.set(index);
+    }
+    down[index] = is_down;
+  }
+
+  auto apply(const keyboard::events::key_press &key_press) -> void {
+    const auto is_down = keyboard::action::release != key_press.action;
+    set_edge(current_.keys_down, current_.keys_pressed, current_.keys_released,
+             std::to_underlying(key_press.key), is_down);
+    set_edge(current_.scancodes_down, current_.scancodes_pressed,
+             current_.scancodes_released,
+             std::to_underlying(key_press.scancode), is_down);
+    current_.modifiers = key_press.modifiers;
+  }
+
+  auto apply(const mouse::events::click &click) -> void {
+    set_edge(current_.buttons_down, current_.buttons_pressed,
+             current_.buttons_released, std::to_underlying(click.button),
+             mouse::action::press == click.action);
+    current_.modifiers = click.modifiers;
+  }
+
+  auto apply(const mouse::events::cursor::position &position) -> void {
+    current_.cursor_x = position.x;
+    current_.cursor_y = position.y;
+  }
+
+  auto apply(const mouse::events::cursor::motion &motion) -> void {
+    current_.motion_x += motion.delta_x;
+    current_.motion_y += motion.delta_y;
+  }
+
+  auto apply(const mouse::events::horizontal_scroll &scroll) -> void {
+    current_.scroll_x += scroll.offset;
+  }
+
+  auto apply(const mouse::events::vertical_scroll &scroll) -> void {
+    current_.scroll_y += scroll.offset;
+  }
+
+  auto apply(const gamepad::events::button_press &button_press) -> void {
+    set_edge(current_.gamepad_buttons_down, current_.gamepad_buttons_pressed,
+             current_.gamepad_buttons_released,
+             frame_state::gamepad_button_index(button_press.gamepad,
+                                               button_press.button),
+             gamepad::action::press == button_press.action);
+  }
+
+  auto apply(const gamepad::events::axis_motion &axis_motion) -> void {
+    if (axis_motion.gamepad >= gamepad::id_count or
+        std::to_underlying(axis_motion.axis) >= gamepad::axis_count)
+        [[unlikely]] {
+      return;
+    }
+    current_.gamepad_axes[axis_motion.gamepad]
+                         [std::to_underlying(axis_motion.axis)] =
+        axis_motion.value;
+  }
+
+public:
+  using duration_type = TTimeDuration;
+  using event_type = input::event<TTimeDuration>;
+
+  auto apply(const event_type &input_event) -> void {
+    std::visit([this](const auto &payload) -> void { apply(payload); },
+               input_event.payload);
+  }
+
+  auto publish() -> void {
+    published_.write(current_);
+    current_.keys_pressed.reset();
+    current_.keys_released.reset();
+    current_.scancodes_pressed.reset();
+    current_.scancodes_released.reset();
+    current_.buttons_pressed.reset();
+    current_.buttons_released.reset();
+    current_.gamepad_buttons_pressed.reset();
+    current_.gamepad_buttons_released.reset();
+    current_.scroll_x = 0.0;
+    current_.scroll_y = 0.0;
+    current_.motion_x = 0.0;
+    current_.motion_y = 0.0;
+    ++current_.frame;
+  }
+
+  // The frame being built. Only the thread applying events may read it.
+  [[nodiscard]] auto current() const noexcept -> const frame_state & {
+    return current_;
+  }
+
+  // The last published frame, safe to call from any thread.
+  [[nodiscard]] auto read() const -> frame_state { return published_.read(); }
+};
+} // namespace jage::engine::input::internal
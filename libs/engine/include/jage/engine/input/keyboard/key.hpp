@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string_view>
+#include <utility>
 
 namespace jage::engine::input::keyboard {
 enum class key : std::uint8_t {
@@ -130,6 +131,8 @@ enum class key : std::uint8_t {
   END = escape,
 };
 
+static constexpr auto key_count = std::to_underlying(key::END) + 1UZ;
+
 [[nodiscard]] constexpr auto
 serialize(const key input_key) -> std::string_view {
   switch (input_key) {
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string_view>
+#include <utility>
 
 namespace jage::engine::input::keyboard {
 enum class scancode : std::uint16_t {
@@ -128,6 +129,9 @@ enum class scancode : std::uint16_t {
   right_super = 0xE7,
 };
 
+static constexpr auto scancode_count =
+    std::to_underlying(scancode::right_super) + 1UZ;
+
 [[nodiscard]] constexpr auto
 serialize(const scancode input_scancode) -> std::string_view {
   switch (input_scancode) {
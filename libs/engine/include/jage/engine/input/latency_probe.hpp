@@ -0,0 +1,28 @@
+#pragma once
+
+#include <jage/engine/concurrency/double_buffer.hpp>
+#include <jage/engine/input/latency_statistics.hpp>
+
+#include <jage/engine/input/internal/latency_probe.hpp>
+
+#include <atomic>
+
+namespace jage::engine::input {
+#if defined(JAGE_ENABLE_INPUT_LATENCY) and JAGE_ENABLE_INPUT_LATENCY == 1
+inline constexpr auto latency_probes_enabled = true;
+#else
+inline constexpr auto latency_probes_enabled = false;
+#endif
+
+// Measures how old input events are when one consumer handles them. Give
+// each consumer its own probe: start_drain(), record() and publish() belong
+// to the consumer's thread, and read() returns the last published
+// statistics to any thread without locking.
+//
+// Probes only measure in builds with JAGE_ENABLE_INPUT_LATENCY=1. Otherwise
+// they are empty and their calls compile to nothing.
+template <class TEvent>
+using latency_probe =
+    internal::latency_probe<TEvent, latency_probes_enabled,
+                            concurrency::double_buffer, std::atomic>;
+} // namespace jage::engine::input
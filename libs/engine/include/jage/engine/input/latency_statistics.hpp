@@ -0,0 +1,28 @@
+#pragma once
+
+#include <array>
+#include <compare> // IWYU pragma: keep
+#include <cstddef>
+#include <cstdint>
+
+namespace jage::engine::input {
+template <class TValue> struct percentile_summary {
+  std::uint64_t count{};
+  TValue p50{};
+  TValue p95{};
+  TValue p99{};
+  TValue max{};
+  auto operator<=>(const percentile_summary &) const = default;
+};
+
+// What a latency_probe has seen: how old events were when the consumer got
+// to them, one summary per payload type in the event's payload order, and
+// how many events were waiting in the ring each time it started draining.
+template <class TDuration, std::size_t PayloadCount>
+struct latency_statistics {
+  using duration = TDuration;
+  std::array<percentile_summary<TDuration>, PayloadCount> payloads{};
+  percentile_summary<std::uint64_t> depth{};
+  auto operator<=>(const latency_statistics &) const = default;
+};
+} // namespace jage::engine::input
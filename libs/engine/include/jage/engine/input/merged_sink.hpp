@@ -0,0 +1,53 @@
+#pragma once
+
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/window_id.hpp>
+
+#include <jage/engine/input/internal/concepts/event_sink.hpp>
+#include <jage/engine/input/internal/cursor_coalescer.hpp>
+#include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+
+#include <functional>
+#include <utility>
+
+namespace jage::engine::input {
+// Lets several windows publish into one ring: give each window a
+// contexts::glfw with its own window_id and coalescing::none, all pushing
+// here. Cursor runs are folded here instead, once for the whole ring, so a
+// run from one window ends as soon as another window pushes. Every event
+// then reaches the ring in the order it was stamped, and consumers read one
+// ordered stream, filtering on event.window where they care, with no merge
+// step. Gamepad events are window-less and always reach the ring with the
+// default window.
+//
+// Like the contexts, it is meant for the thread that polls the windows.
+template <time::internal::concepts::real_number_duration TTimeDuration,
+          class TEventSink>
+  requires internal::concepts::event_sink<TEventSink, event<TTimeDuration>>
+class merged_sink {
+  using event_type_ = event<TTimeDuration>;
+
+  std::reference_wrapper<TEventSink> event_sink_;
+  internal::cursor_coalescer<event_type_> coalescer_{};
+
+public:
+  using event_type = event_type_;
+
+  explicit merged_sink(TEventSink &event_sink) : event_sink_{event_sink} {}
+
+  auto push(event_type &&event) -> void {
+    if (is_window_less(event)) {
+      event.window = window_id{};
+    }
+    if (not coalescer_.coalesce(event, event_sink_.get())) {
+      event_sink_.get().push(std::move(event));
+    }
+  }
+
+  auto push(const event_type &event) -> void { push(event_type{event}); }
+
+  // Forwards the pending cursor run, if any. Call once per frame, after
+  // every window has been polled.
+  auto flush() -> void { coalescer_.flush(event_sink_.get()); }
+};
+} // namespace jage::engine::input
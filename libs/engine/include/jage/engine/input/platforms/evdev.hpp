@@ -0,0 +1,283 @@
+#pragma once
+
+#if !defined(__linux__)
+#error "evdev input is only available on Linux"
+#endif
+
+#include <jage/engine/input/event.hpp>
+
+#include <jage/engine/input/internal/concepts/event_sink.hpp>
+#include <jage/engine/input/internal/evdev_decoder.hpp>
+#include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <fcntl.h>
+#include <linux/input.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace jage::engine::input::platforms {
+// Linux only. Reads input_event records from evdev device nodes, or from any
+// descriptor carrying them such as a pipe, and pushes engine events into
+// TEventSink. start() moves the reading onto its own thread, blocked in
+// epoll until a device has data, so the sink gets a producer of its own: an
+// spmc ring works as long as nothing else pushes to it.
+//
+// Events keep the kernel's timestamps. Device nodes are switched to
+// CLOCK_MONOTONIC, the clock behind std::chrono::steady_clock on Linux, so
+// they line up with time::clock snapshots.
+template <time::internal::concepts::real_number_duration TTimeDuration,
+          class TEventSink>
+  requires internal::concepts::event_sink<TEventSink, event<TTimeDuration>>
+class evdev {
+  using event_type_ = event<TTimeDuration>;
+  using decoder_type_ = internal::evdev_decoder<TTimeDuration, event_type_>;
+
+  static constexpr auto batch_size_ = 64UZ;
+  static constexpr auto record_size_ = sizeof(::input_event);
+  static constexpr auto wake_key_ = std::numeric_limits<std::uint64_t>::max();
+
+  struct device_ {
+    int descriptor{-1};
+    decoder_type_ decoder{};
+    std::array<std::byte, record_size_> partial{};
+    std::size_t partial_size{};
+  };
+
+  std::reference_wrapper<TEventSink> sink_;
+  int epoll_{-1};
+  int wake_{-1};
+  std::vector<device_> devices_{};
+  std::atomic<std::uint64_t> pushed_events_{};
+  std::atomic<std::uint64_t> dropped_reports_{};
+  std::atomic<std::size_t> open_devices_{};
+  std::jthread thread_{};
+
+  auto close_device(device_ &device) -> void {
+    ::epoll_ctl(epoll_, EPOLL_CTL_DEL, device.descriptor, nullptr);
+    ::close(device.descriptor);
+    device.descriptor = -1;
+    open_devices_.fetch_sub(1UZ, std::memory_order::relaxed);
+  }
+
+  // Reads the device's key and LED state after a SYN_DROPPED, as the kernel
+  // documentation asks. Descriptors that are not device nodes, such as pipes,
+  // answer neither query; everything is then treated as released.
+  auto resync(device_ &device) -> std::size_t {
+    auto key_bits = std::array<unsigned char, (KEY_CNT + 7) / 8>{};
+    auto led_bits = std::array<unsigned char, (LED_CNT + 7) / 8>{};
+    if (::ioctl(device.descriptor, EVIOCGKEY(sizeof(key_bits)),
+                std::data(key_bits)) < 0) {
+      key_bits.fill(0U);
+    }
+    if (::ioctl(device.descriptor, EVIOCGLED(sizeof(led_bits)),
+                std::data(led_bits)) < 0) {
+      led_bits.fill(0U);
+    }
+    const auto to_bits = [](auto &bits, const auto &bytes) {
+      for (auto code = 0UZ; code < std::size(bits); ++code) {
+        bits.set(code, 0U != ((bytes[code / 8UZ] >> (code % 8UZ)) & 1U));
+      }
+    };
+    auto keys = typename decoder_type_::key_state{};
+    auto leds = typename decoder_type_::led_state{};
+    to_bits(keys, key_bits);
+    to_bits(leds, led_bits);
+    return device.decoder.resync(keys, leds, sink_.get());
+  }
+
+  // Reads until the descriptor runs dry. A record split across reads is
+  // kept until the rest arrives; end of file or an unplugged device closes
+  // the descriptor.
+  auto read_device(device_ &device) -> std::size_t {
+    auto pushed = 0UZ;
+    auto buffer = std::array<std::byte, (batch_size_ + 1UZ) * record_size_>{};
+    while (-1 != device.descriptor) {
+      std::memcpy(std::data(buffer), std::data(device.partial),
+                  device.partial_size);
+      const auto wanted = std::size(buffer) - device.partial_size;
+      const auto count = ::read(
+          device.descriptor, std::data(buffer) + device.partial_size, wanted);
+      if (count < 0 and EINTR == errno) {
+        continue;
+      }
+      if (count < 0 and (EAGAIN == errno or EWOULDBLOCK == errno)) {
+        break;
+      }
+      if (count <= 0) {
+        close_device(device);
+        break;
+      }
+      const auto available =
+          device.partial_size + static_cast<std::size_t>(count);
+      auto offset = 0UZ;
+      for (; offset + record_size_ <= available; offset += record_size_) {
+        auto input = ::input_event{};
+        std::memcpy(&input, std::data(buffer) + offset, record_size_);
+        pushed += device.decoder.decode(input, sink_.get());
+        if (device.decoder.resync_pending()) [[unlikely]] {
+          pushed += resync(device);
+        }
+      }
+      device.partial_size = available - offset;
+      std::memcpy(std::data(device.partial), std::data(buffer) + offset,
+                  device.partial_size);
+      if (static_cast<std::size_t>(count) < wanted) {
+        break;
+      }
+    }
+    return pushed;
+  }
+
+public:
+  using duration_type = TTimeDuration;
+  using event_type = event_type_;
+
+  explicit evdev(TEventSink &sink)
+      : sink_{sink}, epoll_{::epoll_create1(EPOLL_CLOEXEC)},
+        wake_{::eventfd(0U, EFD_CLOEXEC | EFD_NONBLOCK)} {
+    auto wake = ::epoll_event{.events = EPOLLIN, .data = {.u64 = wake_key_}};
+    if (epoll_ < 0 or wake_ < 0 or
+        ::epoll_ctl(epoll_, EPOLL_CTL_ADD, wake_, &wake) < 0) [[unlikely]] {
+      const auto error = errno;
+      ::close(epoll_);
+      ::close(wake_);
+      throw std::system_error{error, std::generic_category(),
+                              "Unable to set up epoll for evdev input"};
+    }
+  }
+
+  evdev(const evdev &) = delete;
+  auto operator=(const evdev &) -> evdev & = delete;
+
+  ~evdev() {
+    stop();
+    for (auto &device : devices_) {
+      if (-1 != device.descriptor) {
+        ::close(device.descriptor);
+      }
+    }
+    ::close(wake_);
+    ::close(epoll_);
+  }
+
+  // Opens a device node such as /dev/input/event3. Reading it usually needs
+  // membership of the input group; without it this throws a system_error
+  // holding EACCES.
+  auto add_device(const std::filesystem::path &path) -> std::size_t {
+    const auto descriptor =
+        ::open(path.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (descriptor < 0) [[unlikely]] {
+      throw std::system_error{errno, std::generic_category(),
+                              "Unable to open input device " + path.string()};
+    }
+    auto clock = CLOCK_MONOTONIC;
+    ::ioctl(descriptor, EVIOCSCLOCKID, &clock);
+    return add_device(descriptor);
+  }
+
+  // Takes ownership of descriptor. Devices can only be added while stopped.
+  auto add_device(const int descriptor) -> std::size_t {
+    if (is_running()) [[unlikely]] {
+      ::close(descriptor);
+      throw std::invalid_argument{
+          "Input devices cannot be added while evdev is running"};
+    }
+    const auto index = std::size(devices_);
+    auto registration =
+        ::epoll_event{.events = EPOLLIN, .data = {.u64 = index}};
+    if (::fcntl(descriptor, F_SETFL,
+                ::fcntl(descriptor, F_GETFL) | O_NONBLOCK) < 0 or
+        ::epoll_ctl(epoll_, EPOLL_CTL_ADD, descriptor, &registration) < 0)
+        [[unlikely]] {
+      const auto error = errno;
+      ::close(descriptor);
+      throw std::system_error{error, std::generic_category(),
+                              "Unable to watch input descriptor"};
+    }
+    devices_.push_back(device_{.descriptor = descriptor});
+    open_devices_.fetch_add(1UZ, std::memory_order::relaxed);
+    return index;
+  }
+
+  // Waits up to timeout_ms for input (-1 waits indefinitely, 0 not at all)
+  // and decodes whatever is ready. Returns the number of events pushed.
+  auto poll(const int timeout_ms = 0) -> std::size_t {
+    auto ready = std::array<::epoll_event, 16UZ>{};
+    const auto count =
+        ::epoll_wait(epoll_, std::data(ready),
+                     static_cast<int>(std::size(ready)), timeout_ms);
+    auto pushed = 0UZ;
+    for (auto index = 0; index < count; ++index) {
+      const auto key = ready[static_cast<std::size_t>(index)].data.u64;
+      if (wake_key_ == key) {
+        auto value = std::uint64_t{};
+        std::ignore = ::read(wake_, &value, sizeof(value));
+        continue;
+      }
+      pushed += read_device(devices_[key]);
+    }
+    auto dropped = std::uint64_t{};
+    for (const auto &device : devices_) {
+      dropped += device.decoder.dropped_reports();
+    }
+    pushed_events_.fetch_add(pushed, std::memory_order::relaxed);
+    dropped_reports_.store(dropped, std::memory_order::relaxed);
+    return pushed;
+  }
+
+  auto start() -> void {
+    stop();
+    thread_ = std::jthread{[this](const std::stop_token stop) {
+      while (not stop.stop_requested()) {
+        poll(-1);
+      }
+    }};
+  }
+
+  auto stop() -> void {
+    if (thread_.joinable()) {
+      thread_.request_stop();
+      const auto value = std::uint64_t{1U};
+      std::ignore = ::write(wake_, &value, sizeof(value));
+      thread_.join();
+    }
+  }
+
+  [[nodiscard]] auto is_running() const noexcept -> bool {
+    return thread_.joinable();
+  }
+
+  [[nodiscard]] auto pushed_events() const -> std::uint64_t {
+    return pushed_events_.load(std::memory_order::relaxed);
+  }
+
+  // SYN_DROPPED reports: the kernel's buffer overflowed and events were lost.
+  [[nodiscard]] auto dropped_reports() const -> std::uint64_t {
+    return dropped_reports_.load(std::memory_order::relaxed);
+  }
+
+  [[nodiscard]] auto open_devices() const -> std::size_t {
+    return open_devices_.load(std::memory_order::relaxed);
+  }
+};
+} // namespace jage::engine::input::platforms
@@ -14,6 +14,7 @@ template <class TContext> struct glfw {
   using user_pointer_type = void *;
   using monitor_pointer_type = GLFWmonitor *;
   using video_mode_pointer_type = const GLFWvidmode *;
+  using gamepad_state_type = GLFWgamepadstate;
 
   static auto set_window_user_pointer(window_handle_pointer_type window,
                                       user_pointer_type user_pointer) -> void {
@@ -59,12 +60,11 @@ template <class TContext> struct glfw {
     return glfwGetKeyScancode(key);
   }
 
-  [[nodiscard]] static auto get_seconds_since_init() -> duration_type {
-    return duration_type{glfwGetTime()};
-  }
-
-  static auto set_seconds_since_init(const duration_type seconds) -> void {
-    glfwSetTime(seconds.count());
+  // False when no gamepad is connected as jid or it has no gamepad mapping.
+  [[nodiscard]] static auto get_gamepad_state(int jid,
+                                              gamepad_state_type &state)
+      -> bool {
+    return GLFW_TRUE == glfwGetGamepadState(jid, &state);
   }
 
   [[nodiscard]] static auto initialize() -> int { return glfwInit(); }
@@ -0,0 +1,198 @@
+#pragma once
+
+#include <jage/engine/input/encoded_event.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/recording.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+
+#include <jage/engine/input/internal/concepts/event_sink.hpp>
+#include <jage/engine/input/internal/mapped_file.hpp>
+#include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+#include <jage/engine/time/internal/concepts/real_number_time_source.hpp>
+#include <jage/engine/time/internal/steady_clock.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace jage::engine::input::platforms {
+// Plays a recording made by input::recorder back into an event sink, usually
+// a context or the ring itself. Events keep their recorded timestamps.
+// poll_events paces them against TTimeSource, starting from the first call;
+// replay_all pushes everything as fast as the sink accepts it.
+template <time::internal::concepts::real_number_duration TTimeDuration,
+          time::internal::concepts::real_number_time_source TTimeSource =
+              time::internal::steady_clock<TTimeDuration>>
+  requires std::same_as<TTimeDuration, typename TTimeSource::duration>
+class replay {
+  using event_type_ = event<TTimeDuration>;
+  using snapshot_type_ = time::events::snapshot<TTimeDuration>;
+
+  internal::mapped_file file_;
+  std::span<const std::byte> records_{};
+  std::size_t offset_{};
+  TTimeDuration origin_{};
+  std::optional<TTimeDuration> start_{};
+  std::uint64_t replayed_events_{};
+  std::uint64_t dropped_events_{};
+  std::optional<snapshot_type_> snapshot_{};
+  [[no_unique_address]] TTimeSource time_source_{};
+
+  template <class TRecord>
+  [[nodiscard]] auto load(const std::size_t offset) const -> TRecord {
+    auto record = TRecord{};
+    std::memcpy(&record, std::data(records_) + offset, sizeof(TRecord));
+    return record;
+  }
+
+  [[nodiscard]] auto time_of(const recording::record_kind kind,
+                             const std::size_t offset) const -> TTimeDuration {
+    switch (kind) {
+    case recording::record_kind::event:
+      return decode_timestamp<TTimeDuration>(
+          load<encoded_event>(offset).timestamp);
+    case recording::record_kind::snapshot:
+      return TTimeDuration{load<recording::snapshot_record>(offset).real_time};
+    case recording::record_kind::dropped:
+      break;
+    }
+    return TTimeDuration::min();
+  }
+
+  [[nodiscard]] auto first_timestamp() const -> TTimeDuration {
+    for (auto offset = 0UZ;
+         offset + sizeof(recording::record_header) <= std::size(records_);) {
+      const auto header = load<recording::record_header>(offset);
+      const auto body = offset + sizeof(header);
+      if (body + recording::size_of(header.kind) > std::size(records_)) {
+        break;
+      }
+      if (recording::record_kind::dropped != header.kind) {
+        return time_of(header.kind, body);
+      }
+      offset = body + recording::size_of(header.kind);
+    }
+    return {};
+  }
+
+public:
+  using duration_type = TTimeDuration;
+  using event_type = event_type_;
+  using time_source_type = TTimeSource;
+
+  explicit replay(const std::filesystem::path &path)
+      : replay(path, TTimeSource{}) {}
+
+  replay(const std::filesystem::path &path, TTimeSource time_source)
+      : file_{path}, time_source_{std::move(time_source)} {
+    const auto bytes = file_.bytes();
+    auto header = recording::file_header{};
+    if (std::size(bytes) < sizeof(header)) [[unlikely]] {
+      throw std::invalid_argument{"Recording is missing its file header."};
+    }
+    std::memcpy(&header, std::data(bytes), sizeof(header));
+    if (header.magic != recording::magic or
+        header.version != recording::version) [[unlikely]] {
+      throw std::invalid_argument{"File is not a recording of input events."};
+    }
+    if (header != recording::header<TTimeDuration>()) [[unlikely]] {
+      throw std::invalid_argument{
+          "Recording was made with a different duration type."};
+    }
+    records_ = bytes.subspan(sizeof(header));
+    origin_ = first_timestamp();
+  }
+
+  // Pushes every record up to and including recorded_time. A record cut
+  // short by the end of the file ends the replay.
+  auto replay_until(
+      internal::concepts::event_sink<event_type_> auto &sink,
+      const TTimeDuration recorded_time) -> std::size_t {
+    auto pushed = 0UZ;
+    while (offset_ + sizeof(recording::record_header) <= std::size(records_)) {
+      const auto header = load<recording::record_header>(offset_);
+      if (header.kind > recording::record_kind::dropped) [[unlikely]] {
+        throw std::invalid_argument{"Recording contains an unknown record."};
+      }
+      const auto body = offset_ + sizeof(header);
+      if (body + recording::size_of(header.kind) > std::size(records_))
+          [[unlikely]] {
+        offset_ = std::size(records_);
+        break;
+      }
+      if (time_of(header.kind, body) > recorded_time) {
+        break;
+      }
+      switch (header.kind) {
+      case recording::record_kind::event:
+        sink.push(decode<TTimeDuration>(load<encoded_event>(body)));
+        ++pushed;
+        break;
+      case recording::record_kind::snapshot:
+        snapshot_ = recording::decode<TTimeDuration>(
+            load<recording::snapshot_record>(body));
+        break;
+      case recording::record_kind::dropped:
+        dropped_events_ += load<recording::dropped_record>(body).count;
+        break;
+      }
+      offset_ = body + recording::size_of(header.kind);
+    }
+    replayed_events_ += pushed;
+    return pushed;
+  }
+
+  auto replay_all(internal::concepts::event_sink<event_type_> auto &sink)
+      -> std::size_t {
+    return replay_until(sink, TTimeDuration::max());
+  }
+
+  auto poll_events(internal::concepts::event_sink<event_type_> auto &sink)
+      -> std::size_t {
+    const auto now = time_source_.now().time_since_epoch();
+    if (not start_) {
+      start_ = now;
+    }
+    return replay_until(sink, origin_ + (now - *start_));
+  }
+
+  auto rewind() -> void {
+    offset_ = 0UZ;
+    start_.reset();
+    replayed_events_ = 0U;
+    dropped_events_ = 0U;
+    snapshot_.reset();
+  }
+
+  [[nodiscard]] auto is_finished() const noexcept -> bool {
+    return offset_ >= std::size(records_);
+  }
+
+  [[nodiscard]] auto replayed_events() const noexcept -> std::uint64_t {
+    return replayed_events_;
+  }
+
+  [[nodiscard]] auto dropped_events() const noexcept -> std::uint64_t {
+    return dropped_events_;
+  }
+
+  [[nodiscard]] auto
+  latest_snapshot() const noexcept -> const std::optional<snapshot_type_> & {
+    return snapshot_;
+  }
+
+  [[nodiscard]] auto origin() const noexcept -> TTimeDuration {
+    return origin_;
+  }
+
+  [[nodiscard]] constexpr auto time_source() noexcept -> TTimeSource & {
+    return time_source_;
+  }
+};
+} // namespace jage::engine::input::platforms
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <jage/engine/input/recording_file.hpp>
+
+#include <jage/engine/input/internal/recorder.hpp>
+
+namespace jage::engine::input {
+template <class TRing, class TSnapshotCache>
+using recorder = internal::recorder<TRing, TSnapshotCache, recording_file>;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <jage/engine/input/encoded_event.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+
+#include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace jage::engine::input::recording {
+// A recording is a file_header followed by records. Every record is a
+// record_header and the body its kind names, all multiples of 8 bytes, so
+// records stay aligned when the file is mapped.
+inline constexpr auto magic =
+    std::array<char, 8UZ>{'J', 'A', 'G', 'E', 'I', 'N', 'P', 'T'};
+inline constexpr auto version = std::uint32_t{1U};
+
+struct file_header {
+  std::array<char, 8UZ> magic{recording::magic};
+  std::uint32_t version{recording::version};
+  std::uint32_t reserved{};
+  std::int64_t period_numerator{};
+  std::int64_t period_denominator{};
+
+  [[nodiscard]] friend constexpr auto
+  operator==(const file_header &, const file_header &) -> bool = default;
+};
+
+enum class record_kind : std::uint8_t {
+  event,
+  snapshot,
+  dropped,
+};
+
+struct record_header {
+  record_kind kind{};
+  std::array<std::uint8_t, 7UZ> reserved{};
+};
+
+struct snapshot_record {
+  double real_time{};
+  double tick_duration{};
+  double time_scale{};
+  double elapsed_time{};
+  std::uint64_t elapsed_frames{};
+  std::uint64_t frame{};
+  double accumulated_time{};
+
+  [[nodiscard]] friend constexpr auto
+  operator==(const snapshot_record &, const snapshot_record &)
+      -> bool = default;
+};
+
+struct dropped_record {
+  std::uint64_t count{};
+};
+
+static_assert(sizeof(file_header) == 32UZ);
+static_assert(sizeof(record_header) == 8UZ);
+static_assert(sizeof(snapshot_record) == 56UZ);
+static_assert(sizeof(dropped_record) == 8UZ);
+static_assert(std::is_trivially_copyable_v<snapshot_record>);
+
+template <time::internal::concepts::real_number_duration TTimeDuration>
+[[nodiscard]] constexpr auto header() -> file_header {
+  return {
+      .period_numerator = TTimeDuration::period::num,
+      .period_denominator = TTimeDuration::period::den,
+  };
+}
+
+[[nodiscard]] constexpr auto size_of(const record_kind kind) -> std::size_t {
+  switch (kind) {
+  case record_kind::event:
+    return sizeof(encoded_event);
+  case record_kind::snapshot:
+    return sizeof(snapshot_record);
+  case record_kind::dropped:
+    return sizeof(dropped_record);
+  }
+  return 0UZ;
+}
+
+template <time::internal::concepts::real_number_duration TTimeDuration>
+[[nodiscard]] constexpr auto
+encode(const time::events::snapshot<TTimeDuration> &snapshot)
+    -> snapshot_record {
+  return {
+      .real_time = snapshot.real_time.count(),
+      .tick_duration = snapshot.tick_duration.count(),
+      .time_scale = snapshot.time_scale,
+      .elapsed_time = snapshot.elapsed_time.count(),
+      .elapsed_frames = snapshot.elapsed_frames,
+      .frame = snapshot.frame,
+      .accumulated_time = snapshot.accumulated_time.count(),
+  };
+}
+
+template <time::internal::concepts::real_number_duration TTimeDuration>
+[[nodiscard]] constexpr auto decode(const snapshot_record &record)
+    -> time::events::snapshot<TTimeDuration> {
+  return {
+      .real_time = TTimeDuration{record.real_time},
+      .tick_duration = TTimeDuration{record.tick_duration},
+      .time_scale = record.time_scale,
+      .elapsed_time = TTimeDuration{record.elapsed_time},
+      .elapsed_frames = record.elapsed_frames,
+      .frame = record.frame,
+      .accumulated_time = TTimeDuration{record.accumulated_time},
+  };
+}
+} // namespace jage::engine::input::recording
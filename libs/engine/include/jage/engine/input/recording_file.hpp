@@ -0,0 +1,48 @@
+#pragma once
+
+#include <jage/engine/internal/output_file.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <system_error>
+
+namespace jage::engine::input {
+// Append-only sink for recorder blocks. Writes are unbuffered because the
+// recorder already hands over whole blocks. They happen on the recorder's own
+// thread, so a failed write, such as on a full disk, is not thrown: the file
+// stops writing and reports it through failed().
+class recording_file {
+  engine::internal::output_file file_;
+  std::atomic<bool> failed_{};
+
+public:
+  explicit recording_file(const std::filesystem::path &path)
+      : file_{engine::internal::open_output_file(path)} {
+    if (nullptr == file_) [[unlikely]] {
+      throw std::system_error{errno, std::generic_category(),
+                              "Unable to open recording file " +
+                                  path.string()};
+    }
+    std::setvbuf(file_.get(), nullptr, _IONBF, 0UZ);
+  }
+
+  auto write(const std::span<const std::byte> bytes) -> void {
+    if (failed_.load(std::memory_order::relaxed)) [[unlikely]] {
+      return;
+    }
+    if (std::fwrite(std::data(bytes), 1UZ, std::size(bytes), file_.get()) !=
+        std::size(bytes)) [[unlikely]] {
+      failed_.store(true, std::memory_order::relaxed);
+    }
+  }
+
+  [[nodiscard]] auto failed() const noexcept -> bool {
+    return failed_.load(std::memory_order::relaxed);
+  }
+};
+} // namespace jage::engine::input
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <jage/engine/concurrency/double_buffer.hpp>
+
+#include <jage/engine/input/internal/state.hpp>
+#include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+
+#include <atomic>
+
+namespace jage::engine::input {
+template <time::internal::concepts::real_number_duration TTimeDuration>
+using state = internal::state<TTimeDuration, concurrency::double_buffer,
+                              std::atomic>;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+
+namespace jage::engine::input {
+// Which window an event came through. Contexts stamp their own id, so
+// contexts sharing one ring need distinct ids; a single window can keep the
+// default. Gamepad events always keep the default.
+using window_id = std::uint8_t;
+} // namespace jage::engine::input
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+
+namespace jage::engine::internal {
+struct output_file_closer {
+  auto operator()(std::FILE *file) const noexcept -> void { std::fclose(file); }
+};
+
+using output_file = std::unique_ptr<std::FILE, output_file_closer>;
+
+// Creates or truncates path for binary writing. Returns null when the file
+// cannot be opened. path::c_str() is a wide string on Windows, so the wide
+// open is used there.
+[[nodiscard]] inline auto
+open_output_file(const std::filesystem::path &path) -> output_file {
+#if defined(_WIN32)
+  std::FILE *file = nullptr;
+  ::_wfopen_s(&file, path.c_str(), L"wb");
+  return output_file{file};
+#else
+  return output_file{std::fopen(path.c_str(), "wb")};
+#endif
+}
+} // namespace jage::engine::internal
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <jage/engine/internal/output_file.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+namespace jage::engine::logging {
+// Destination for the logger's formatted batches: a file it owns, or
+// standard output. Each batch is flushed as soon as it is written. Failed
+// writes are ignored because they happen on the logger's own thread, where
+// there is nobody to report them to.
+class file_sink {
+  engine::internal::output_file owned_{};
+  std::FILE *file_;
+
+  explicit file_sink(std::FILE *file) : file_{file} {}
+
+public:
+  explicit file_sink(const std::filesystem::path &path)
+      : owned_{engine::internal::open_output_file(path)}, file_{owned_.get()} {
+    if (nullptr == file_) [[unlikely]] {
+      throw std::invalid_argument{"Unable to open log file " + path.string()};
+    }
+  }
+
+  [[nodiscard]] static auto standard_output() -> file_sink {
+    return file_sink{stdout};
+  }
+
+  auto write(const std::span<const std::byte> bytes) -> void {
+    std::fwrite(std::data(bytes), 1UZ, std::size(bytes), file_);
+    std::fflush(file_);
+  }
+};
+} // namespace jage::engine::logging
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+
+namespace jage::engine::logging::internal::concepts {
+// Arguments are copied bitwise into the record and formatted later on another
+// thread, so anything that points elsewhere could be gone or changed by then.
+template <class TArgument>
+concept loggable_argument =
+    std::is_trivially_copyable_v<TArgument> and
+    not std::is_array_v<TArgument> and not std::is_pointer_v<TArgument> and
+    not std::is_same_v<TArgument, std::string_view>;
+} // namespace jage::engine::logging::internal::concepts
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <jage/engine/containers/spsc/queue.hpp>
+
+#include <jage/engine/logging/internal/concepts/loggable_argument.hpp>
+#include <jage/engine/logging/internal/record.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fmt/format.h>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+namespace jage::engine::logging::internal {
+// A log call copies its arguments into a fixed-size record and pushes it onto
+// an spsc queue belonging to the calling thread. A background thread formats
+// the records and hands them to TWriter in batches, so the caller never waits
+// on formatting or I/O. When a thread's queue is full the record is dropped
+// and counted instead, and the formatter writes a line saying how many were
+// lost.
+//
+// Format strings are kept by reference and read on the formatter thread, so
+// they must be string literals or otherwise outlive the logger.
+template <class TWriter, std::size_t Capacity = 1024UZ,
+          std::size_t MaxThreads = 16UZ>
+  requires requires(TWriter &writer, std::span<const std::byte> bytes) {
+    writer.write(bytes);
+  }
+class logger {
+  struct channel_ {
+    containers::spsc::queue<record, Capacity> queue{};
+    std::atomic<std::uint64_t> dropped{};
+    std::uint64_t reported_dropped{};
+    std::thread::id owner{};
+  };
+
+  struct cached_channel_ {
+    std::uint64_t logger{};
+    channel_ *channel{};
+  };
+
+  static constexpr auto batch_size_ = 64UZ * 1024UZ;
+  static constexpr auto cached_channel_count_ = 8UZ;
+  inline static std::atomic<std::uint64_t> next_id_{1U};
+
+  const std::uint64_t id_{next_id_.fetch_add(1U, std::memory_order::relaxed)};
+  TWriter writer_;
+  std::array<std::unique_ptr<channel_>, MaxThreads> channels_{};
+  std::atomic<std::size_t> channel_count_{};
+  std::mutex registration_{};
+  std::atomic<std::uint64_t> unregistered_dropped_{};
+  std::uint64_t reported_unregistered_dropped_{};
+  fmt::memory_buffer buffer_{};
+  std::atomic<std::uint64_t> written_messages_{};
+  std::atomic<std::uint64_t> dropped_messages_{};
+  std::jthread thread_{};
+
+  // Runs on a thread's first log call, and again only if another logger has
+  // since taken its cache slot. Threads beyond MaxThreads get no queue and
+  // everything they log is dropped.
+  auto register_channel() -> channel_ * {
+    const auto lock = std::scoped_lock{registration_};
+    const auto count = channel_count_.load(std::memory_order::relaxed);
+    const auto self = std::this_thread::get_id();
+    for (auto index = 0UZ; index < count; ++index) {
+      if (self == channels_[index]->owner) {
+        return channels_[index].get();
+      }
+    }
+    if (MaxThreads == count) [[unlikely]] {
+      return nullptr;
+    }
+    channels_[count] = std::make_unique<channel_>();
+    channels_[count]->owner = self;
+    channel_count_.store(count + 1UZ, std::memory_order::release);
+    return channels_[count].get();
+  }
+
+  // Each thread caches its channels in a small table indexed by logger id.
+  // Ids are handed out in sequence, so a thread logging to up to
+  // cached_channel_count_ loggers in turn only registers once with each.
+  [[nodiscard]] auto channel() -> channel_ * {
+    thread_local auto cached =
+        std::array<cached_channel_, cached_channel_count_>{};
+    auto &entry = cached[id_ % cached_channel_count_];
+    if (id_ != entry.logger) [[unlikely]] {
+      entry = {.logger = id_, .channel = register_channel()};
+    }
+    return entry.channel;
+  }
+
+  auto report_dropped(const std::uint64_t dropped, std::uint64_t &reported)
+      -> void {
+    if (dropped == reported) {
+      return;
+    }
+    fmt::format_to(fmt::appender{buffer_}, "[log] {} messages dropped\n",
+                   dropped - reported);
+    dropped_messages_.fetch_add(dropped - reported,
+                                std::memory_order::relaxed);
+    reported = dropped;
+  }
+
+public:
+  static constexpr auto default_poll_interval = std::chrono::milliseconds{1};
+
+  explicit logger(auto &&...writer_arguments)
+      : writer_(std::forward<decltype(writer_arguments)>(writer_arguments)...) {
+  }
+
+  logger(const logger &) = delete;
+  logger(logger &&) = delete;
+  auto operator=(const logger &) -> logger & = delete;
+  auto operator=(logger &&) -> logger & = delete;
+
+  ~logger() {
+    stop();
+    poll();
+  }
+
+  // Queues a message for the formatter thread. Returns false, and counts the
+  // message as dropped, if the calling thread's queue is full.
+  template <concepts::loggable_argument... TArguments>
+  auto log(const fmt::format_string<TArguments...> format,
+           const TArguments &...arguments) -> bool {
+    auto *const target = channel();
+    if (nullptr == target) [[unlikely]] {
+      unregistered_dropped_.fetch_add(1U, std::memory_order::relaxed);
+      return false;
+    }
+    const auto view = static_cast<fmt::string_view>(format);
+    const auto text = std::string_view{std::data(view), std::size(view)};
+    if (not target->queue.try_push(encode(text, arguments...))) [[unlikely]] {
+      const auto dropped = target->dropped.load(std::memory_order::relaxed);
+      target->dropped.store(dropped + 1U, std::memory_order::relaxed);
+      return false;
+    }
+    return true;
+  }
+
+  // Formats and writes everything queued since the last call and returns how
+  // many messages it wrote. The background thread calls this in a loop, so
+  // only call it directly when not running.
+  auto poll() -> std::size_t {
+    auto formatted = 0UZ;
+    const auto count = channel_count_.load(std::memory_order::acquire);
+    for (auto index = 0UZ; index < count; ++index) {
+      auto &source = *channels_[index];
+      for (auto pending = std::size(source.queue); pending > 0UZ;
+           --pending, ++formatted) {
+        decode(source.queue.front(), buffer_);
+        source.queue.pop();
+        if (std::size(buffer_) >= batch_size_) {
+          flush();
+        }
+      }
+      report_dropped(source.dropped.load(std::memory_order::relaxed),
+                     source.reported_dropped);
+    }
+    report_dropped(unregistered_dropped_.load(std::memory_order::relaxed),
+                   reported_unregistered_dropped_);
+    written_messages_.fetch_add(formatted, std::memory_order::relaxed);
+    flush();
+    return formatted;
+  }
+
+  auto flush() -> void {
+    if (0UZ == std::size(buffer_)) {
+      return;
+    }
+    writer_.write(
+        std::as_bytes(std::span{std::data(buffer_), std::size(buffer_)}));
+    buffer_.clear();
+  }
+
+  auto start(const std::chrono::nanoseconds poll_interval =
+                 default_poll_interval) -> void {
+    stop();
+    thread_ = std::jthread{[this, poll_interval](const std::stop_token stop) {
+      while (not stop.stop_requested()) {
+        if (0UZ == poll()) {
+          std::this_thread::sleep_for(poll_interval);
+        }
+      }
+      poll();
+    }};
+  }
+
+  auto stop() -> void {
+    if (thread_.joinable()) {
+      thread_.request_stop();
+      thread_.join();
+    }
+  }
+
+  [[nodiscard]] auto is_running() const noexcept -> bool {
+    return thread_.joinable();
+  }
+
+  [[nodiscard]] auto written_messages() const -> std::uint64_t {
+    return written_messages_.load(std::memory_order::relaxed);
+  }
+
+  // Messages lost to full queues, counted once the formatter has reported
+  // them.
+  [[nodiscard]] auto dropped_messages() const -> std::uint64_t {
+    return dropped_messages_.load(std::memory_order::relaxed);
+  }
+
+  [[nodiscard]] auto writer() noexcept -> TWriter & { return writer_; }
+
+  [[nodiscard]] auto writer() const noexcept -> const TWriter & {
+    return writer_;
+  }
+};
+} // namespace jage::engine::logging::internal
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <jage/engine/logging/internal/concepts/loggable_argument.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <fmt/format.h>
+#include <string_view>
+#include <utility>
+
+namespace jage::engine::logging::internal {
+// One log call as it crosses from the logging thread to the formatter: the
+// format string, a function that knows the argument types, and the
+// arguments' bytes. Two cache lines, so the hot path is a fixed-size copy.
+struct record {
+  using format_function = auto (*)(fmt::memory_buffer &, std::string_view,
+                                   const std::byte *) -> void;
+
+  static constexpr auto size = 128UZ;
+  static constexpr auto argument_capacity =
+      size - sizeof(format_function) - sizeof(std::string_view);
+
+  format_function format{};
+  std::string_view text{};
+  std::array<std::byte, argument_capacity> arguments{};
+};
+
+static_assert(record::size == sizeof(record));
+
+[[nodiscard]] constexpr auto align_up(const std::size_t offset,
+                                      const std::size_t alignment)
+    -> std::size_t {
+  return (offset + alignment - 1UZ) / alignment * alignment;
+}
+
+template <class... TArguments>
+[[nodiscard]] consteval auto argument_offsets()
+    -> std::array<std::size_t, sizeof...(TArguments)> {
+  auto offsets = std::array<std::size_t, sizeof...(TArguments)>{};
+  auto offset = 0UZ;
+  auto index = 0UZ;
+  ((offset = align_up(offset, alignof(TArguments)), offsets[index++] = offset,
+    offset += sizeof(TArguments)),
+   ...);
+  return offsets;
+}
+
+template <class... TArguments>
+[[nodiscard]] consteval auto arguments_size() -> std::size_t {
+  auto offset = 0UZ;
+  ((offset = align_up(offset, alignof(TArguments)) + sizeof(TArguments)), ...);
+  return offset;
+}
+
+template <class TArgument>
+[[nodiscard]] auto load(const std::byte *bytes) -> TArgument {
+  auto copy = std::array<std::byte, sizeof(TArgument)>{};
+  std::memcpy(std::data(copy), bytes, sizeof(TArgument));
+  return std::bit_cast<TArgument>(copy);
+}
+
+template <concepts::loggable_argument... TArguments>
+auto format_arguments(fmt::memory_buffer &buffer, const std::string_view text,
+                      const std::byte *arguments) -> void {
+  [[maybe_unused]] static constexpr auto offsets =
+      argument_offsets<TArguments...>();
+  [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+    fmt::format_to(fmt::appender{buffer}, fmt::runtime(text),
+                   load<TArguments>(arguments + offsets[Index])...);
+  }(std::index_sequence_for<TArguments...>{});
+}
+
+template <concepts::loggable_argument... TArguments>
+  requires(arguments_size<TArguments...>() <= record::argument_capacity)
+[[nodiscard]] auto encode(const std::string_view text,
+                          const TArguments &...arguments) -> record {
+  [[maybe_unused]] static constexpr auto offsets =
+      argument_offsets<TArguments...>();
+  auto encoded = record{.format = &format_arguments<TArguments...>,
+                        .text = text};
+  [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+    (std::memcpy(std::data(encoded.arguments) + offsets[Index], &arguments,
+                 sizeof(TArguments)),
+     ...);
+  }(std::index_sequence_for<TArguments...>{});
+  return encoded;
+}
+
+inline auto decode(const record &encoded, fmt::memory_buffer &buffer) -> void {
+  encoded.format(buffer, encoded.text, std::data(encoded.arguments));
+}
+} // namespace jage::engine::logging::internal
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <jage/engine/logging/file_sink.hpp>
+
+#include <jage/engine/logging/internal/logger.hpp>
+
+#include <cstddef>
+
+namespace jage::engine::logging {
+template <std::size_t Capacity = 1024UZ>
+using logger = internal::logger<file_sink, Capacity>;
+}
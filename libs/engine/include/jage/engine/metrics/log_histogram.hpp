@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace jage::engine::metrics {
+
+template <std::uint8_t SubBucketBits, std::uint8_t MagnitudeBits,
+          class TCount = std::uint32_t>
+  requires(SubBucketBits > 0U and SubBucketBits < MagnitudeBits and
+           MagnitudeBits < 64U)
+class log_histogram {
+  static constexpr auto sub_bucket_count_ = std::uint64_t{1U} << SubBucketBits;
+  static constexpr auto half_sub_bucket_count_ = sub_bucket_count_ >> 1U;
+  static constexpr auto max_value_ = (std::uint64_t{1U} << MagnitudeBits) - 1U;
+
+  std::array<TCount, sub_bucket_count_ + (MagnitudeBits - SubBucketBits) *
+                                             half_sub_bucket_count_>
+      counts_{};
+  std::uint64_t total_count_{};
+
+public:
+  using count_type = TCount;
+
+  [[nodiscard]] static constexpr auto bucket_count() noexcept -> std::size_t {
+    return sub_bucket_count_ +
+           (MagnitudeBits - SubBucketBits) * half_sub_bucket_count_;
+  }
+
+  [[nodiscard]] static constexpr auto max_value() noexcept -> std::uint64_t {
+    return max_value_;
+  }
+
+  [[nodiscard]] static constexpr auto
+  bucket_index(const std::uint64_t value) noexcept -> std::size_t {
+    const auto clamped = std::min(value, max_value_);
+    if (clamped < sub_bucket_count_) {
+      return static_cast<std::size_t>(clamped);
+    }
+    const auto group = static_cast<std::uint64_t>(std::bit_width(clamped)) -
+                       SubBucketBits;
+    const auto sub_bucket = clamped >> group;
+    return static_cast<std::size_t>(sub_bucket_count_ +
+                                    (group - 1U) * half_sub_bucket_count_ +
+                                    sub_bucket - half_sub_bucket_count_);
+  }
+
+  [[nodiscard]] static constexpr auto
+  bucket_lower_bound(const std::size_t index) noexcept -> std::uint64_t {
+    if (index < sub_bucket_count_) {
+      return index;
+    }
+    const auto offset = index - sub_bucket_count_;
+    const auto group = offset / half_sub_bucket_count_ + 1U;
+    const auto sub_bucket =
+        offset % half_sub_bucket_count_ + half_sub_bucket_count_;
+    return sub_bucket << group;
+  }
+
+  [[nodiscard]] static constexpr auto
+  bucket_upper_bound(const std::size_t index) noexcept -> std::uint64_t {
+    if (index + 1UZ >= bucket_count()) {
+      return max_value_;
+    }
+    return bucket_lower_bound(index + 1UZ) - 1U;
+  }
+
+  constexpr auto record(const std::uint64_t value) noexcept -> void {
+    ++counts_[bucket_index(value)];
+    ++total_count_;
+  }
+
+  constexpr auto erase(const std::uint64_t value) noexcept -> void {
+    --counts_[bucket_index(value)];
+    --total_count_;
+  }
+
+  constexpr auto reset() noexcept -> void {
+    counts_.fill(TCount{});
+    total_count_ = 0U;
+  }
+
+  [[nodiscard]] constexpr auto count() const noexcept -> std::uint64_t {
+    return total_count_;
+  }
+
+  [[nodiscard]] constexpr auto
+  count(const std::size_t index) const noexcept -> TCount {
+    return counts_[index];
+  }
+
+  template <std::size_t Count>
+  [[nodiscard]] constexpr auto
+  values_at_percentiles(const std::array<double, Count> &percentiles) const
+      noexcept -> std::array<std::uint64_t, Count> {
+    auto values = std::array<std::uint64_t, Count>{};
+    if (0U == total_count_) [[unlikely]] {
+      return values;
+    }
+    auto ranks = std::array<std::uint64_t, Count>{};
+    for (auto index = 0UZ; index < Count; ++index) {
+      ranks[index] = std::clamp(
+          static_cast<std::uint64_t>(
+              std::ceil(std::clamp(percentiles[index], 0.0, 100.0) / 100.0 *
+                        static_cast<double>(total_count_))),
+          std::uint64_t{1U}, total_count_);
+      values[index] = max_value_;
+    }
+    auto resolved = 0UZ;
+    auto cumulative = std::uint64_t{};
+    for (auto bucket = 0UZ; bucket < bucket_count() and resolved < Count;
+         ++bucket) {
+      if (TCount{} == counts_[bucket]) {
+        continue;
+      }
+      cumulative += counts_[bucket];
+      for (auto index = 0UZ; index < Count; ++index) {
+        if (0U != ranks[index] and cumulative >= ranks[index]) {
+          values[index] = bucket_upper_bound(bucket);
+          ranks[index] = 0U;
+          ++resolved;
+        }
+      }
+    }
+    return values;
+  }
+
+  [[nodiscard]] constexpr auto
+  value_at_percentile(const double percentile) const noexcept
+      -> std::uint64_t {
+    return values_at_percentiles(std::array{percentile})[0UZ];
+  }
+
+  [[nodiscard]] constexpr auto max() const noexcept -> std::uint64_t {
+    for (auto index = bucket_count(); index > 0UZ; --index) {
+      if (TCount{} != counts_[index - 1UZ]) {
+        return bucket_upper_bound(index - 1UZ);
+      }
+    }
+    return 0U;
+  }
+};
+
+} // namespace jage::engine::metrics
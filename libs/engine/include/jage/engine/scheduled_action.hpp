@@ -19,7 +19,8 @@ public:
       : nanoseconds_to_wait_(nanoseconds_to_wait) {}
   scheduled_action(const std::chrono::nanoseconds nanoseconds_to_wait,
                    TAction &&action)
-      : nanoseconds_to_wait_(nanoseconds_to_wait), action_(action) {}
+      : nanoseconds_to_wait_(nanoseconds_to_wait),
+        action_(std::forward<TAction>(action)) {}
 
   [[gnu::pure, nodiscard]] auto
   status() const noexcept -> const scheduled_action_status & {
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <jage/engine/no_op.hpp>
+#include <jage/engine/scheduled_action_status.hpp>
+
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX2__) or defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+namespace jage::engine {
+template <class TAction = no_op> class scheduled_action_batch {
+  using rep_ = std::chrono::nanoseconds::rep;
+
+  std::vector<rep_> nanoseconds_to_wait_{};
+  std::vector<scheduled_action_status> statuses_{};
+  std::vector<TAction> actions_{};
+  std::vector<std::uint32_t> completed_{};
+
+  static_assert(sizeof(scheduled_action_status) == sizeof(std::uint8_t));
+
+  auto complete(const std::size_t index) -> void {
+    statuses_[index] = scheduled_action_status::complete;
+    completed_.push_back(static_cast<std::uint32_t>(index));
+  }
+
+  auto update_scalar(const std::size_t first, const rep_ elapsed) -> void {
+    for (auto index = first; index < size(); ++index) {
+      if (scheduled_action_status::active != statuses_[index]) {
+        continue;
+      }
+      auto &nanoseconds_to_wait = nanoseconds_to_wait_[index];
+      if (nanoseconds_to_wait > elapsed) {
+        nanoseconds_to_wait -= elapsed;
+      } else {
+        nanoseconds_to_wait = 0;
+        complete(index);
+      }
+    }
+  }
+
+  [[nodiscard]] auto update_vectorized(const rep_ elapsed) -> std::size_t {
+#if defined(__AVX2__)
+    static constexpr auto lanes = 4UZ;
+    const auto elapsed_lanes = _mm256_set1_epi64x(elapsed);
+    const auto active_lanes = _mm256_set1_epi64x(
+        static_cast<std::int64_t>(scheduled_action_status::active));
+    auto index = 0UZ;
+    for (; index + lanes <= size(); index += lanes) {
+      auto packed_statuses = std::int32_t{};
+      std::memcpy(&packed_statuses, &statuses_[index], lanes);
+      const auto active = _mm256_cmpeq_epi64(
+          _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packed_statuses)),
+          active_lanes);
+      auto *waits =
+          reinterpret_cast<__m256i *>(std::data(nanoseconds_to_wait_) + index);
+      const auto wait = _mm256_loadu_si256(waits);
+      const auto pending = _mm256_cmpgt_epi64(wait, elapsed_lanes);
+      const auto remaining =
+          _mm256_and_si256(pending, _mm256_sub_epi64(wait, elapsed_lanes));
+      _mm256_storeu_si256(waits, _mm256_blendv_epi8(wait, remaining, active));
+      if (auto completed = static_cast<unsigned>(_mm256_movemask_pd(
+              _mm256_castsi256_pd(_mm256_andnot_si256(pending, active))));
+          0U != completed) [[unlikely]] {
+        for (; 0U != completed; completed &= completed - 1U) {
+          complete(index +
+                   static_cast<std::size_t>(std::countr_zero(completed)));
+        }
+      }
+    }
+    return index;
+#elif defined(__SSE4_2__)
+    static constexpr auto lanes = 2UZ;
+    const auto elapsed_lanes = _mm_set1_epi64x(elapsed);
+    const auto active_lanes = _mm_set1_epi64x(
+        static_cast<std::int64_t>(scheduled_action_status::active));
+    auto index = 0UZ;
+    for (; index + lanes <= size(); index += lanes) {
+      auto packed_statuses = std::int16_t{};
+      std::memcpy(&packed_statuses, &statuses_[index], lanes);
+      const auto active = _mm_cmpeq_epi64(
+          _mm_cvtepu8_epi64(_mm_cvtsi32_si128(packed_statuses)), active_lanes);
+      auto *waits =
+          reinterpret_cast<__m128i *>(std::data(nanoseconds_to_wait_) + index);
+      const auto wait = _mm_loadu_si128(waits);
+      const auto pending = _mm_cmpgt_epi64(wait, elapsed_lanes);
+      const auto remaining =
+          _mm_and_si128(pending, _mm_sub_epi64(wait, elapsed_lanes));
+      _mm_storeu_si128(waits, _mm_blendv_epi8(wait, remaining, active));
+      if (auto completed = static_cast<unsigned>(_mm_movemask_pd(
+              _mm_castsi128_pd(_mm_andnot_si128(pending, active))));
+          0U != completed) [[unlikely]] {
+        for (; 0U != completed; completed &= completed - 1U) {
+          complete(index +
+                   static_cast<std::size_t>(std::countr_zero(completed)));
+        }
+      }
+    }
+    return index;
+#else
+    static_cast<void>(elapsed);
+    return 0UZ;
+#endif
+  }
+
+public:
+  scheduled_action_batch() = default;
+
+  explicit scheduled_action_batch(const std::size_t capacity) {
+    reserve(capacity);
+  }
+
+  auto reserve(const std::size_t capacity) -> void {
+    nanoseconds_to_wait_.reserve(capacity);
+    statuses_.reserve(capacity);
+    actions_.reserve(capacity);
+    completed_.reserve(capacity);
+  }
+
+  auto push_back(const std::chrono::nanoseconds nanoseconds_to_wait,
+                 TAction action = TAction{}) -> std::size_t {
+    nanoseconds_to_wait_.push_back(nanoseconds_to_wait.count());
+    statuses_.push_back(scheduled_action_status::active);
+    actions_.push_back(std::move(action));
+    if (completed_.capacity() < actions_.capacity()) {
+      completed_.reserve(actions_.capacity());
+    }
+    return size() - 1UZ;
+  }
+
+  auto clear() noexcept -> void {
+    nanoseconds_to_wait_.clear();
+    statuses_.clear();
+    actions_.clear();
+    completed_.clear();
+  }
+
+  [[nodiscard]] auto size() const noexcept -> std::size_t {
+    return std::size(statuses_);
+  }
+
+  [[nodiscard]] auto
+  status(const std::size_t index) const noexcept -> scheduled_action_status {
+    return statuses_[index];
+  }
+
+  [[nodiscard]] auto nanoseconds_to_wait(const std::size_t index) const noexcept
+      -> std::chrono::nanoseconds {
+    return std::chrono::nanoseconds{nanoseconds_to_wait_[index]};
+  }
+
+  [[nodiscard]] auto is_complete(const std::size_t index) const noexcept
+      -> bool {
+    return scheduled_action_status::complete == statuses_[index] or
+           scheduled_action_status::canceled == statuses_[index];
+  }
+
+  auto pause(const std::size_t index) noexcept -> void {
+    if (statuses_[index] != scheduled_action_status::canceled) {
+      statuses_[index] = scheduled_action_status::paused;
+    }
+  }
+
+  auto resume(const std::size_t index) noexcept -> void {
+    if (statuses_[index] != scheduled_action_status::canceled) {
+      statuses_[index] = scheduled_action_status::active;
+    }
+  }
+
+  auto cancel(const std::size_t index) noexcept -> void {
+    if (statuses_[index] != scheduled_action_status::complete) {
+      statuses_[index] = scheduled_action_status::canceled;
+    }
+  }
+
+  auto reset(const std::size_t index,
+             const std::chrono::nanoseconds nanoseconds_to_wait) noexcept
+      -> void {
+    statuses_[index] = scheduled_action_status::active;
+    nanoseconds_to_wait_[index] = nanoseconds_to_wait.count();
+  }
+
+  auto extend(const std::size_t index,
+              const std::chrono::nanoseconds additional_nanoseconds) noexcept
+      -> void {
+    nanoseconds_to_wait_[index] += additional_nanoseconds.count();
+  }
+
+  auto update(const std::chrono::nanoseconds nanoseconds_elapsed) -> void {
+    completed_.clear();
+    const auto elapsed = nanoseconds_elapsed.count();
+    update_scalar(update_vectorized(elapsed), elapsed);
+    for (const auto index : completed_) {
+      actions_[index]();
+    }
+  }
+
+  [[nodiscard]] auto
+  completed() const noexcept -> const std::vector<std::uint32_t> & {
+    return completed_;
+  }
+};
+} // namespace jage::engine
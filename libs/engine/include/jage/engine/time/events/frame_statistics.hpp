@@ -0,0 +1,17 @@
+#pragma once
+
+#include <compare> // IWYU pragma: keep
+#include <cstdint>
+
+namespace jage::engine::time::events {
+template <class TDuration> struct frame_statistics {
+  using duration = TDuration;
+  std::uint64_t frame_count{};
+  TDuration mean{};
+  TDuration p50{};
+  TDuration p95{};
+  TDuration p99{};
+  TDuration max{};
+  auto operator<=>(const frame_statistics &) const = default;
+};
+} // namespace jage::engine::time::events
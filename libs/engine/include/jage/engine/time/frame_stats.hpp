@@ -0,0 +1,17 @@
+#pragma once
+
+#include <jage/engine/concurrency/double_buffer.hpp>
+#include <jage/engine/time/events/frame_statistics.hpp>
+
+#include <jage/engine/time/internal/frame_stats.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace jage::engine::time {
+template <std::size_t WindowSize,
+          internal::concepts::real_number_duration TDuration>
+using frame_stats = internal::frame_stats<WindowSize, TDuration,
+                                          concurrency::double_buffer,
+                                          std::atomic>;
+}
@@ -5,14 +5,18 @@
 #include <jage/engine/time/hertz.hpp>
 
 #include <jage/engine/time/internal/concepts/real_number_time_source.hpp>
+#include <jage/engine/time/internal/epoch_ring.hpp>
 
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <stdexcept>
+#include <utility>
 
 namespace jage::engine::time::internal {
 
-template <internal::concepts::real_number_time_source TTimeSource>
+template <internal::concepts::real_number_time_source TTimeSource,
+          template <class> class TAtomic = std::atomic>
   requires(TTimeSource::is_steady)
 class clock {
   using duration_ = typename TTimeSource::duration;
@@ -20,17 +24,24 @@ class clock {
   static_assert(memory::cacheline_size >= sizeof(snapshot_));
   static_assert(alignof(snapshot_) == memory::cacheline_size);
   static_assert(sizeof(snapshot_) % memory::cacheline_size == 0);
-  duration_ elapsed_time_{};
+
+  struct epoch_ {
+    duration_ elapsed_time{};
+    std::uint64_t elapsed_ticks{};
+    double time_scale{1.0};
+  };
+
   duration_ tick_duration_{};
-  std::uint64_t elapsed_ticks_{};
-  double time_scale_{1.0};
-
-  [[nodiscard]] auto
-  ticks(const duration_ current_time) const -> std::uint64_t {
-    const auto accumulated_time = current_time - elapsed_time_;
-    return static_cast<std::uint64_t>(
-               std::floor(accumulated_time.count() / tick_duration_.count())) +
-           elapsed_ticks_;
+  [[no_unique_address]] TTimeSource time_source_{};
+  epoch_ring<epoch_, TAtomic> epochs_{};
+
+  [[nodiscard]] auto ticks(const epoch_ &epoch,
+                           const duration_ current_time) const
+      -> std::uint64_t {
+    return static_cast<std::uint64_t>(std::floor(
+               accumulated_since(epoch, current_time).count() /
+               tick_duration_.count())) +
+           epoch.elapsed_ticks;
   }
 
 public:
@@ -40,12 +51,26 @@ public:
   constexpr clock(const hertz &cycles)
       : tick_duration_{static_cast<duration_type>(cycles)} {};
 
+  constexpr clock(const hertz &cycles, TTimeSource time_source)
+      : tick_duration_{static_cast<duration_type>(cycles)},
+        time_source_{std::move(time_source)} {};
+
   [[nodiscard]] auto real_time() const -> duration_type {
-    return TTimeSource::now().time_since_epoch();
+    return time_source_.now().time_since_epoch();
+  }
+
+  [[nodiscard]] constexpr auto time_source() noexcept -> TTimeSource & {
+    return time_source_;
+  }
+
+  [[nodiscard]] constexpr auto
+  time_source() const noexcept -> const TTimeSource & {
+    return time_source_;
   }
 
   [[nodiscard]] auto ticks() const -> std::uint64_t {
-    return ticks(real_time() * time_scale_);
+    const auto current_time = real_time();
+    return ticks(epochs_.load(), current_time);
   }
 
   [[nodiscard]] auto game_time() const -> duration_type {
@@ -62,26 +87,29 @@ public:
       throw std::invalid_argument(
           "Refusing to set time scale to a negative value.");
     }
-    elapsed_ticks_ = ticks();
-    elapsed_time_ = real_time() * scale;
-
-    time_scale_ = scale;
+    const auto current_time = real_time();
+    epochs_.publish([&](const epoch_ &previous) {
+      return epoch_{
+          .elapsed_time = current_time * scale,
+          .elapsed_ticks = ticks(previous, current_time),
+          .time_scale = scale,
+      };
+    });
   }
 
   [[nodiscard]] auto snapshot() const -> snapshot_type {
     const auto current_real_time = real_time();
-    const auto scaled_real_time = current_real_time * time_scale_;
-    const auto accumulated_time = scaled_real_time - elapsed_time_;
+    const auto epoch = epochs_.load();
+    const auto accumulated_time = accumulated_since(epoch, current_real_time);
     const auto accumulated_ticks =
         std::floor(accumulated_time / tick_duration_);
-    const auto current_ticks = ticks(scaled_real_time);
     return {
         .real_time = current_real_time,
         .tick_duration = tick_duration_,
-        .time_scale = time_scale_,
-        .elapsed_time = elapsed_time_,
-        .elapsed_frames = elapsed_ticks_,
-        .frame = current_ticks,
+        .time_scale = epoch.time_scale,
+        .elapsed_time = epoch.elapsed_time,
+        .elapsed_frames = epoch.elapsed_ticks,
+        .frame = ticks(epoch, current_real_time),
         .accumulated_time =
             accumulated_time - accumulated_ticks * tick_duration_,
     };
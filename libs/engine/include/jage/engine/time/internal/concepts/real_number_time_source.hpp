@@ -2,12 +2,18 @@
 
 #include <jage/engine/time/internal/concepts/real_number_duration.hpp>
 
-#include <chrono>
+#include <concepts>
 
 namespace jage::engine::time::internal::concepts {
 template <class TTimeSource>
-concept real_number_time_source = requires {
+concept real_number_time_source = requires(const TTimeSource &source) {
   requires real_number_duration<typename TTimeSource::duration>;
-} and std::chrono::is_clock_v<TTimeSource>;
+  typename TTimeSource::time_point;
+  { TTimeSource::is_steady } -> std::convertible_to<bool>;
+  { source.now() } -> std::same_as<typename TTimeSource::time_point>;
+  {
+    source.now().time_since_epoch()
+  } -> std::same_as<typename TTimeSource::duration>;
+};
 
-} // namespace jage::engine::time::internal::concepts
\ No newline at end of file
+} // namespace jage::engine::time::internal::concepts
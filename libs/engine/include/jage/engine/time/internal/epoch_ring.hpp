@@ -0,0 +1,88 @@
+#pragma once
+
+#include <jage/engine/memory/cacheline_size.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace jage::engine::time::internal {
+
+// Publishes a clock's epoch, the state that changes with the time scale,
+// so readers never block. One writer fills the slot after the current one
+// and then advances the index. A reader can only observe a torn epoch if the
+// writer laps the ring while it is loading a slot, in which case it retries.
+//
+// Epochs are stored as 64-bit words, so TEpoch must be trivially copyable
+// and made of 8-byte members.
+template <class TEpoch, template <class> class TAtomic = std::atomic>
+  requires(std::is_trivially_copyable_v<TEpoch> and
+           sizeof(TEpoch) % sizeof(std::uint64_t) == 0UZ)
+class epoch_ring {
+  static constexpr auto word_count_ = sizeof(TEpoch) / sizeof(std::uint64_t);
+  static constexpr auto slot_count_ = 4UZ;
+
+  using words_ = std::array<std::uint64_t, word_count_>;
+  using slot_ = std::array<TAtomic<std::uint64_t>, word_count_>;
+
+  alignas(memory::cacheline_size) TAtomic<std::uint64_t> index_{0UZ};
+  std::array<slot_, slot_count_> slots_{};
+
+  auto store(const std::uint64_t index, const TEpoch &epoch) -> void {
+    const auto words = std::bit_cast<words_>(epoch);
+    auto &slot = slots_[index % slot_count_];
+    for (auto word = 0UZ; word < word_count_; ++word) {
+      slot[word].store(words[word], std::memory_order::release);
+    }
+  }
+
+public:
+  using epoch_type = TEpoch;
+
+  explicit epoch_ring(const TEpoch &initial = {}) { store(0UZ, initial); }
+
+  [[nodiscard]] auto load(const std::uint64_t index) const -> TEpoch {
+    const auto &slot = slots_[index % slot_count_];
+    auto words = words_{};
+    for (auto word = 0UZ; word < word_count_; ++word) {
+      words[word] = slot[word].load(std::memory_order::acquire);
+    }
+    return std::bit_cast<TEpoch>(words);
+  }
+
+  [[nodiscard]] auto load() const -> TEpoch {
+    while (true) {
+      const auto index = index_.load(std::memory_order::acquire);
+      const auto epoch = load(index);
+      if (index_.load(std::memory_order::relaxed) - index <
+          slot_count_ - 1UZ) [[likely]] {
+        return epoch;
+      }
+    }
+  }
+
+  // Publishes next(current epoch). Only one thread may publish at a time.
+  template <class TNext> auto publish(TNext &&next) -> void {
+    const auto index = index_.load(std::memory_order::relaxed);
+    store(index + 1UZ, std::forward<TNext>(next)(load(index)));
+    index_.store(index + 1UZ, std::memory_order::release);
+  }
+};
+
+// Scaled time gathered since epoch was published, for epochs carrying
+// elapsed_time and time_scale. Clamped to non-negative so that truncation
+// matches floor.
+template <class TEpoch, class TDuration>
+[[nodiscard]] constexpr auto
+accumulated_since(const TEpoch &epoch,
+                  const TDuration current_time) -> TDuration {
+  return std::max(current_time * epoch.time_scale - epoch.elapsed_time,
+                  TDuration{});
+}
+
+} // namespace jage::engine::time::internal
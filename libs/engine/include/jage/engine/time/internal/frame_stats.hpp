@@ -0,0 +1,95 @@
+#pragma once
+
+#include <jage/engine/metrics/log_histogram.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/frame_statistics.hpp>
+
+#include <jage/engine/time/internal/concepts/cache_snapshot.hpp>
+#include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace jage::engine::time::internal {
+template <std::size_t WindowSize, concepts::real_number_duration TDuration,
+          template <class, template <class> class> class TBuffer,
+          template <class> class TAtomic>
+  requires(WindowSize > 0UZ)
+class frame_stats {
+  using statistics_type_ = events::frame_statistics<TDuration>;
+  using histogram_type_ = metrics::log_histogram<7U, 22U>;
+
+  histogram_type_ histogram_{};
+  std::array<TDuration, WindowSize + 1UZ> real_times_{};
+  std::uint64_t push_count_{};
+  TBuffer<statistics_type_, TAtomic> statistics_{};
+
+  [[nodiscard]] static auto
+  to_histogram_value(const TDuration &frame_time) -> std::uint64_t {
+    return static_cast<std::uint64_t>(
+        std::max(cast<microseconds>(frame_time).count(), 0.0));
+  }
+
+  [[nodiscard]] static auto
+  from_histogram_value(const std::uint64_t value) -> TDuration {
+    return cast<TDuration>(microseconds{static_cast<double>(value)});
+  }
+
+  [[nodiscard]] auto frame_time(const std::uint64_t push_index) const
+      -> TDuration {
+    return real_times_[push_index % std::size(real_times_)] -
+           real_times_[(push_index - 1U) % std::size(real_times_)];
+  }
+
+public:
+  using statistics_type = statistics_type_;
+
+  [[nodiscard]] static constexpr auto window_size() noexcept -> std::size_t {
+    return WindowSize;
+  }
+
+  [[nodiscard]] auto frame_count() const noexcept -> std::uint64_t {
+    return histogram_.count();
+  }
+
+  auto push(const concepts::cache_snapshot auto &snapshot) -> void {
+    if (push_count_ > WindowSize) {
+      histogram_.erase(
+          to_histogram_value(frame_time(push_count_ - WindowSize)));
+    }
+    real_times_[push_count_ % std::size(real_times_)] = snapshot.real_time;
+    if (push_count_ > 0U) {
+      histogram_.record(to_histogram_value(frame_time(push_count_)));
+    }
+    ++push_count_;
+  }
+
+  auto publish() -> void {
+    const auto frames = histogram_.count();
+    if (0U == frames) [[unlikely]] {
+      statistics_.write(statistics_type_{});
+      return;
+    }
+    const auto newest = push_count_ - 1U;
+    const auto oldest = newest - frames;
+    const auto [p50, p95, p99] =
+        histogram_.values_at_percentiles(std::array{50.0, 95.0, 99.0});
+    statistics_.write(statistics_type_{
+        .frame_count = frames,
+        .mean = (real_times_[newest % std::size(real_times_)] -
+                 real_times_[oldest % std::size(real_times_)]) /
+                static_cast<double>(frames),
+        .p50 = from_histogram_value(p50),
+        .p95 = from_histogram_value(p95),
+        .p99 = from_histogram_value(p99),
+        .max = from_histogram_value(histogram_.max()),
+    });
+  }
+
+  [[nodiscard]] auto read() const -> statistics_type_ {
+    return statistics_.read();
+  }
+};
+} // namespace jage::engine::time::internal
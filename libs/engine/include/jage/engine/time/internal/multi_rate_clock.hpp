@@ -0,0 +1,141 @@
+#pragma once
+
+#include <jage/engine/time/events/snapshot.hpp>
+#include <jage/engine/time/hertz.hpp>
+
+#include <jage/engine/time/internal/concepts/real_number_time_source.hpp>
+#include <jage/engine/time/internal/epoch_ring.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace jage::engine::time::internal {
+
+template <internal::concepts::real_number_time_source TTimeSource,
+          template <class> class TAtomic, hertz::value_type... Rates>
+  requires(TTimeSource::is_steady and sizeof...(Rates) > 0UZ)
+class multi_rate_clock {
+  using duration_ = typename TTimeSource::duration;
+  using snapshot_ = events::snapshot<duration_>;
+  static constexpr auto rate_count_ = sizeof...(Rates);
+  using snapshots_ = std::array<snapshot_, rate_count_>;
+  using ticks_ = std::array<std::uint64_t, rate_count_>;
+
+  static constexpr auto tick_durations_ = std::array<duration_, rate_count_>{
+      static_cast<duration_>(hertz{Rates})...};
+
+  struct epoch_ {
+    duration_ elapsed_time{};
+    ticks_ elapsed_ticks{};
+    double time_scale{1.0};
+  };
+
+  [[no_unique_address]] TTimeSource time_source_{};
+  epoch_ring<epoch_, TAtomic> epochs_{};
+
+  // accumulated_since() never goes negative, so truncation matches floor and
+  // the per-rate tick count needs no libm call.
+  [[nodiscard]] static auto ticks(const epoch_ &epoch,
+                                  const duration_ current_time) -> ticks_ {
+    const auto accumulated_time = accumulated_since(epoch, current_time);
+    auto current_ticks = ticks_{};
+    for (auto rate = 0UZ; rate < rate_count_; ++rate) {
+      current_ticks[rate] =
+          static_cast<std::uint64_t>(accumulated_time / tick_durations_[rate]) +
+          epoch.elapsed_ticks[rate];
+    }
+    return current_ticks;
+  }
+
+public:
+  using duration_type = duration_;
+  using snapshot_type = snapshot_;
+  using snapshots_type = snapshots_;
+  using ticks_type = ticks_;
+
+  constexpr multi_rate_clock() = default;
+
+  constexpr explicit multi_rate_clock(TTimeSource time_source)
+      : time_source_{std::move(time_source)} {}
+
+  [[nodiscard]] static constexpr auto rate_count() noexcept -> std::size_t {
+    return rate_count_;
+  }
+
+  [[nodiscard]] static constexpr auto
+  tick_durations() noexcept -> const std::array<duration_type, rate_count_> & {
+    return tick_durations_;
+  }
+
+  [[nodiscard]] auto real_time() const -> duration_type {
+    return time_source_.now().time_since_epoch();
+  }
+
+  [[nodiscard]] constexpr auto time_source() noexcept -> TTimeSource & {
+    return time_source_;
+  }
+
+  [[nodiscard]] constexpr auto
+  time_source() const noexcept -> const TTimeSource & {
+    return time_source_;
+  }
+
+  [[nodiscard]] auto ticks() const -> ticks_type {
+    const auto current_time = real_time();
+    return ticks(epochs_.load(), current_time);
+  }
+
+  auto set_time_scale(const double scale) -> void {
+    if (scale < 0.0) [[unlikely]] {
+      throw std::invalid_argument(
+          "Refusing to set time scale to a negative value.");
+    }
+    const auto current_time = real_time();
+    epochs_.publish([&](const epoch_ &previous) {
+      return epoch_{
+          .elapsed_time = current_time * scale,
+          .elapsed_ticks = ticks(previous, current_time),
+          .time_scale = scale,
+      };
+    });
+  }
+
+  [[nodiscard]] auto snapshot() const -> snapshots_type {
+    const auto current_real_time = real_time();
+    const auto epoch = epochs_.load();
+    const auto accumulated_time = accumulated_since(epoch, current_real_time);
+    auto snapshots = snapshots_type{};
+    for (auto rate = 0UZ; rate < rate_count_; ++rate) {
+      const auto &tick_duration = tick_durations_[rate];
+      const auto accumulated_ticks =
+          static_cast<std::uint64_t>(accumulated_time / tick_duration);
+      snapshots[rate] = {
+          .real_time = current_real_time,
+          .tick_duration = tick_duration,
+          .time_scale = epoch.time_scale,
+          .elapsed_time = epoch.elapsed_time,
+          .elapsed_frames = epoch.elapsed_ticks[rate],
+          .frame = accumulated_ticks + epoch.elapsed_ticks[rate],
+          .accumulated_time =
+              accumulated_time -
+              static_cast<double>(accumulated_ticks) * tick_duration,
+      };
+    }
+    return snapshots;
+  }
+
+  template <class... TCaches>
+    requires(sizeof...(TCaches) == rate_count_)
+  auto push(TCaches &...caches) const -> snapshots_type {
+    const auto snapshots = snapshot();
+    [&]<std::size_t... Rate>(std::index_sequence<Rate...>) {
+      (caches.push(snapshots[Rate]), ...);
+    }(std::make_index_sequence<rate_count_>{});
+    return snapshots;
+  }
+};
+
+} // namespace jage::engine::time::internal
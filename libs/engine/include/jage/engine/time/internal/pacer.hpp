@@ -0,0 +1,113 @@
+#pragma once
+
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+#include <jage/engine/time/hertz.hpp>
+
+#include <jage/engine/time/internal/concepts/real_number_time_source.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+
+namespace jage::engine::time::internal {
+
+template <internal::concepts::real_number_time_source TTimeSource,
+          class TSleeper>
+  requires(TTimeSource::is_steady and std::chrono::is_clock_v<TTimeSource>)
+class pacer {
+  using duration_ = typename TTimeSource::duration;
+  using snapshot_ = events::snapshot<duration_>;
+
+  // Jacobson/Karels style estimator: the spin margin tracks the mean wake-up
+  // lateness plus a multiple of its mean deviation.
+  static constexpr auto lateness_gain_ = 0.125;
+  static constexpr auto deviation_gain_ = 0.25;
+  static constexpr auto deviation_multiplier_ = 4.0;
+
+  duration_ period_;
+  // Kept below the period so every on-time frame sleeps for part of it.
+  duration_ maximum_margin_;
+  duration_ minimum_margin_;
+  duration_ margin_;
+  duration_ mean_lateness_{};
+  duration_ lateness_deviation_{};
+  duration_ next_deadline_{
+      std::numeric_limits<typename duration_::rep>::lowest()};
+
+  [[nodiscard]] static auto now() -> duration_ {
+    return TTimeSource::now().time_since_epoch();
+  }
+
+  auto observe_lateness(const duration_ lateness) -> void {
+    const auto error = lateness - mean_lateness_;
+    mean_lateness_ += error * lateness_gain_;
+    lateness_deviation_ +=
+        (duration_{std::abs(error.count())} - lateness_deviation_) *
+        deviation_gain_;
+    margin_ = std::clamp(mean_lateness_ +
+                             lateness_deviation_ * deviation_multiplier_,
+                         minimum_margin_, maximum_margin_);
+  }
+
+public:
+  using duration_type = duration_;
+  using snapshot_type = snapshot_;
+
+  explicit pacer(const hertz &cycles,
+                 const duration_type initial_margin =
+                     time::cast<duration_>(milliseconds{1.0}),
+                 const duration_type minimum_margin = duration_type{})
+      : period_{static_cast<duration_type>(cycles)},
+        maximum_margin_{period_ / 2},
+        minimum_margin_{std::min(minimum_margin, maximum_margin_)},
+        margin_{std::clamp(initial_margin, minimum_margin_, maximum_margin_)} {
+  }
+
+  [[nodiscard]] constexpr auto
+  period() const noexcept -> const duration_type & {
+    return period_;
+  }
+
+  [[nodiscard]] constexpr auto
+  margin() const noexcept -> const duration_type & {
+    return margin_;
+  }
+
+  [[nodiscard]] constexpr auto
+  next_deadline() const noexcept -> const duration_type & {
+    return next_deadline_;
+  }
+
+  auto wait(const snapshot_type &snapshot) -> duration_type {
+    const auto &current_time = snapshot.real_time;
+    if (next_deadline_ + period_ <= current_time) [[unlikely]] {
+      next_deadline_ = current_time + period_;
+    } else if (next_deadline_ <= current_time) [[unlikely]] {
+      const auto missed_deadline = next_deadline_;
+      next_deadline_ += period_;
+      return missed_deadline;
+    }
+
+    if (const auto sleep_target = next_deadline_ - margin_;
+        current_time < sleep_target) {
+      TSleeper::sleep_until(sleep_target);
+      observe_lateness(now() - sleep_target);
+    } else {
+      // Without a sleep there is no lateness to measure; decay toward zero so
+      // one outlier cannot keep every later frame inside the margin.
+      observe_lateness(duration_type{});
+    }
+
+    while (now() < next_deadline_) {
+      TSleeper::relax();
+    }
+
+    const auto reached_deadline = next_deadline_;
+    next_deadline_ += period_;
+    return reached_deadline;
+  }
+};
+
+} // namespace jage::engine::time::internal
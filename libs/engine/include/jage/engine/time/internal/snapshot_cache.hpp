@@ -7,6 +7,7 @@
 
 #include <jage/engine/time/internal/concepts/cache_snapshot.hpp>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstdint>
@@ -31,6 +32,34 @@ public:
     const auto write_index = write_index_.load(std::memory_order::acquire);
     buffer_[write_index % Capacity].write(input_snapshot);
     write_index_.store(write_index + 1, std::memory_order::release);
+    write_index_.notify_all();
+  }
+
+  [[nodiscard]] auto write_index() const -> std::uint64_t {
+    return write_index_.load(std::memory_order::acquire);
+  }
+
+  [[nodiscard]] auto read(const std::uint64_t index) const -> TSnapshot {
+    return buffer_[index % Capacity].read();
+  }
+
+  [[nodiscard]] auto latest() const -> TSnapshot {
+    const auto write_index = write_index_.load(std::memory_order::acquire);
+    return buffer_[(write_index - 1UZ) % Capacity].read();
+  }
+
+  // Blocks until a snapshot for frame_index or a later frame is published.
+  // Frames are compared, not pushes: the cache may start mid-run, and a
+  // clock can skip or repeat frames.
+  [[nodiscard]] auto wait_for_frame(const std::uint64_t frame_index)
+      -> std::pair<TSnapshot, cache_match_status> {
+    for (auto write_index = write_index_.load(std::memory_order::acquire);
+         0UZ == write_index or
+         buffer_[(write_index - 1UZ) % Capacity].read().frame < frame_index;
+         write_index = write_index_.load(std::memory_order::acquire)) {
+      write_index_.wait(write_index, std::memory_order::acquire);
+    }
+    return find(frame_index);
   }
 
   [[nodiscard]] auto find(const typename TSnapshot::duration &event_real_time)
@@ -55,22 +84,28 @@ public:
     };
   }
 
+  // Returns the newest snapshot at or before frame_index. Slots are searched
+  // rather than indexed by frame, since frame numbers need not match pushes.
   [[nodiscard]] auto find(const std::uint64_t frame_index)
       -> std::pair<TSnapshot, cache_match_status> {
     const auto write_index = write_index_.load(std::memory_order::acquire);
     const auto newest_index = (write_index + Capacity - 1UZ) % Capacity;
-    const auto oldest_index = write_index % Capacity;
+    const auto stored = std::min<std::uint64_t>(write_index, Capacity);
 
     if (const auto newest_snap = buffer_[newest_index].read();
         newest_snap.frame < frame_index) [[unlikely]] {
       return {newest_snap, cache_match_status::ahead};
-    } else if (const auto oldest_snap = buffer_[oldest_index].read();
-               oldest_snap.frame > frame_index) [[unlikely]] {
-      return {oldest_snap, cache_match_status::evicted};
+    }
+    for (auto offset = 0UZ; offset < stored; ++offset) {
+      const auto snap =
+          buffer_[(newest_index + Capacity - offset) % Capacity].read();
+      if (snap.frame <= frame_index) {
+        return {snap, cache_match_status::matched};
+      }
     }
     return {
-        buffer_[frame_index % Capacity].read(),
-        cache_match_status::matched,
+        buffer_[(write_index - stored) % Capacity].read(),
+        cache_match_status::evicted,
     };
   }
 };
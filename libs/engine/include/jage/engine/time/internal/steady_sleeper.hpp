@@ -0,0 +1,51 @@
+#pragma once
+
+#include <jage/engine/time/durations.hpp>
+
+#include <chrono>
+#include <thread>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <ctime>
+#endif
+
+#if defined(__x86_64__) or defined(__i386__) or defined(_M_X64) or            \
+    defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
+namespace jage::engine::time::internal {
+template <class TDuration> struct steady_sleeper {
+  using duration = TDuration;
+
+  static auto sleep_until(const duration time_since_epoch) -> void {
+#if defined(__linux__)
+    const auto nanoseconds_since_epoch =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(time_since_epoch)
+            .count();
+    const auto deadline = timespec{
+        .tv_sec = static_cast<std::time_t>(nanoseconds_since_epoch /
+                                           1'000'000'000),
+        .tv_nsec = static_cast<long>(nanoseconds_since_epoch % 1'000'000'000),
+    };
+    while (EINTR ==
+           clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, nullptr)) {
+    }
+#else
+    std::this_thread::sleep_until(std::chrono::steady_clock::time_point{
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            time_since_epoch)});
+#endif
+  }
+
+  static auto relax() -> void {
+#if defined(__x86_64__) or defined(__i386__) or defined(_M_X64) or            \
+    defined(_M_IX86)
+    _mm_pause();
+#else
+    std::this_thread::yield();
+#endif
+  }
+};
+} // namespace jage::engine::time::internal
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <jage/engine/time/internal/concepts/real_number_duration.hpp>
+
+#include <chrono>
+#include <stdexcept>
+
+namespace jage::engine::time::internal {
+template <concepts::real_number_duration TDuration> class virtual_time_source {
+  TDuration current_time_{};
+
+public:
+  using rep = typename TDuration::rep;
+  using period = typename TDuration::period;
+  using duration = TDuration;
+  using time_point = std::chrono::time_point<virtual_time_source>;
+  static constexpr auto is_steady = true;
+
+  constexpr virtual_time_source() = default;
+
+  constexpr explicit virtual_time_source(const duration &start_time)
+      : current_time_{start_time} {}
+
+  [[nodiscard]] constexpr auto now() const noexcept -> time_point {
+    return time_point{current_time_};
+  }
+
+  constexpr auto advance(const duration &step) -> void {
+    if (step < duration{}) [[unlikely]] {
+      throw std::invalid_argument(
+          "Refusing to move a steady time source backwards.");
+    }
+    current_time_ += step;
+  }
+};
+} // namespace jage::engine::time::internal
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <jage/engine/time/hertz.hpp>
+#include <jage/engine/time/internal/multi_rate_clock.hpp>
+#include <jage/engine/time/internal/steady_clock.hpp>
+
+#include <atomic>
+
+namespace jage::engine::time {
+
+template <class TDuration, hertz::value_type... Rates>
+using multi_rate_clock =
+    internal::multi_rate_clock<internal::steady_clock<TDuration>, std::atomic,
+                               Rates...>;
+
+}
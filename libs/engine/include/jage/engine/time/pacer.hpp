@@ -0,0 +1,13 @@
+#pragma once
+
+#include <jage/engine/time/internal/pacer.hpp>
+#include <jage/engine/time/internal/steady_clock.hpp>
+#include <jage/engine/time/internal/steady_sleeper.hpp>
+
+namespace jage::engine::time {
+
+template <class TDuration>
+using pacer = internal::pacer<internal::steady_clock<TDuration>,
+                              internal::steady_sleeper<TDuration>>;
+
+}
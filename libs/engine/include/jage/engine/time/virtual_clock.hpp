@@ -0,0 +1,14 @@
+#pragma once
+
+#include <jage/engine/time/internal/clock.hpp>
+#include <jage/engine/time/internal/virtual_time_source.hpp>
+
+namespace jage::engine::time {
+
+template <class TDuration>
+using virtual_time_source = internal::virtual_time_source<TDuration>;
+
+template <class TDuration>
+using virtual_clock = internal::clock<virtual_time_source<TDuration>>;
+
+}
@@ -0,0 +1,190 @@
+#include <jage/engine/input/action_map.hpp>
+#include <jage/engine/input/binding.hpp>
+#include <jage/engine/input/chord.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/modifier.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+namespace keyboard = jage::engine::input::keyboard;
+using jage::engine::input::chord;
+using jage::engine::input::modifier;
+using jage::engine::input::modifier_count;
+using keyboard::scancode;
+using keyboard::events::key_press;
+
+enum class command : std::uint8_t {
+  forward,
+  back,
+  left,
+  right,
+  jump,
+  crouch,
+  reload,
+  interact,
+  save,
+  load,
+  quit,
+  pause,
+};
+
+using binding_type = jage::engine::input::binding<command>;
+
+constexpr auto bindings = std::array{
+    binding_type{.input = scancode::w, .target = command::forward},
+    binding_type{.input = scancode::s, .target = command::back},
+    binding_type{.input = scancode::a, .target = command::left},
+    binding_type{.input = scancode::d, .target = command::right},
+    binding_type{.input = scancode::spacebar, .target = command::jump},
+    binding_type{.input = scancode::c, .target = command::crouch},
+    binding_type{.input = scancode::r, .target = command::reload},
+    binding_type{.input = scancode::e,
+                 .action = keyboard::action::release,
+                 .target = command::interact},
+    binding_type{
+        .input = scancode::s, .chord = chord::control, .target = command::save},
+    binding_type{
+        .input = scancode::l, .chord = chord::control, .target = command::load},
+    binding_type{.input = scancode::escape, .target = command::quit},
+    binding_type{.input = scancode::p,
+                 .action = keyboard::action::release,
+                 .target = command::pause},
+};
+
+constexpr auto action_map = jage::engine::input::action_map{bindings};
+
+constexpr auto event_count = 10'000UZ;
+
+// Half the events hit a binding, the rest are other keys, repeats and
+// releases, with Control held on one in eight.
+auto make_events() -> std::vector<key_press> {
+  static constexpr auto scancodes = std::array{
+      scancode::w, scancode::s, scancode::a,      scancode::d,
+      scancode::spacebar, scancode::c, scancode::r, scancode::e,
+      scancode::l, scancode::escape, scancode::p, scancode::q,
+      scancode::f, scancode::_1, scancode::tab,   scancode::left_shift,
+  };
+  static constexpr auto actions = std::array{
+      keyboard::action::press,
+      keyboard::action::press,
+      keyboard::action::release,
+      keyboard::action::repeat,
+  };
+  auto generator = std::mt19937{42U};
+  auto pick_scancode =
+      std::uniform_int_distribution<std::size_t>{0UZ, std::size(scancodes) - 1UZ};
+  auto pick_action =
+      std::uniform_int_distribution<std::size_t>{0UZ, std::size(actions) - 1UZ};
+  auto pick_control = std::uniform_int_distribution<int>{0, 7};
+  auto events = std::vector<key_press>{};
+  for (auto index = 0UZ; index < event_count; ++index) {
+    auto modifiers = std::bitset<modifier_count>{};
+    if (0 == pick_control(generator)) {
+      modifiers.set(std::to_underlying(modifier::left_control));
+      modifiers.set(std::to_underlying(modifier::right_control));
+    }
+    events.push_back({
+        .key = keyboard::key::unidentified,
+        .scancode = scancodes[pick_scancode(generator)],
+        .action = actions[pick_action(generator)],
+        .modifiers = modifiers,
+    });
+  }
+  return events;
+}
+
+// The hand-written translation consumers wrote before action_map, checking
+// action and modifiers case by case.
+auto resolve_with_switch(const key_press &event) -> std::optional<command> {
+  const auto control =
+      event.modifiers[std::to_underlying(modifier::left_control)] or
+      event.modifiers[std::to_underlying(modifier::right_control)];
+  const auto pressed = keyboard::action::press == event.action;
+  switch (event.scancode) {
+  case scancode::w:
+    return pressed ? std::optional{command::forward} : std::nullopt;
+  case scancode::s:
+    if (not pressed) {
+      return std::nullopt;
+    }
+    return control ? command::save : command::back;
+  case scancode::a:
+    return pressed ? std::optional{command::left} : std::nullopt;
+  case scancode::d:
+    return pressed ? std::optional{command::right} : std::nullopt;
+  case scancode::spacebar:
+    return pressed ? std::optional{command::jump} : std::nullopt;
+  case scancode::c:
+    return pressed ? std::optional{command::crouch} : std::nullopt;
+  case scancode::r:
+    return pressed ? std::optional{command::reload} : std::nullopt;
+  case scancode::e:
+    return keyboard::action::release == event.action
+               ? std::optional{command::interact}
+               : std::nullopt;
+  case scancode::l:
+    return pressed and control ? std::optional{command::load} : std::nullopt;
+  case scancode::escape:
+    return pressed ? std::optional{command::quit} : std::nullopt;
+  case scancode::p:
+    return keyboard::action::release == event.action
+               ? std::optional{command::pause}
+               : std::nullopt;
+  default:
+    return std::nullopt;
+  }
+}
+
+auto resolve_switch(benchmark::State &state) -> void {
+  const auto events = make_events();
+  for (auto _ : state) {
+    auto sum = 0UZ;
+    for (const auto &event : events) {
+      if (const auto resolved = resolve_with_switch(event)) {
+        sum += std::to_underlying(*resolved) + 1UZ;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * event_count);
+}
+
+auto resolve_action_map(benchmark::State &state) -> void {
+  const auto events = make_events();
+  for (auto _ : state) {
+    auto sum = 0UZ;
+    for (const auto &event : events) {
+      if (const auto resolved = action_map.resolve(event)) {
+        sum += std::to_underlying(*resolved) + 1UZ;
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * event_count);
+}
+
+auto reload_action_map(benchmark::State &state) -> void {
+  auto map = jage::engine::input::action_map<command, 64UZ>{};
+  for (auto _ : state) {
+    map.reload(bindings);
+    benchmark::DoNotOptimize(map);
+  }
+}
+} // namespace
+
+BENCHMARK(resolve_switch)->Name("action_map/resolve_10k/switch");
+BENCHMARK(resolve_action_map)->Name("action_map/resolve_10k/action_map");
+BENCHMARK(reload_action_map)->Name("action_map/reload_12_bindings");
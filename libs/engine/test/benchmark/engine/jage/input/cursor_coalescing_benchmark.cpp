@@ -0,0 +1,109 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/contexts/coalescing.hpp>
+#include <jage/engine/input/contexts/glfw.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <jage/engine/time/internal/steady_clock.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <variant>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using buffer_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 256UZ>;
+using motion_type = jage::engine::input::mouse::events::cursor::motion;
+namespace coalescing = jage::engine::input::contexts::coalescing;
+
+template <class TCoalescingPolicy>
+using context_type = jage::engine::input::contexts::glfw<
+    duration_type, buffer_type,
+    jage::engine::time::internal::steady_clock<duration_type>,
+    TCoalescingPolicy>;
+
+constexpr auto frame_rate = 60;
+
+template <class TCoalescingPolicy>
+auto produce_frame(context_type<TCoalescingPolicy> &context,
+                   const std::int64_t report_rate) -> void {
+  const auto reports_per_frame = report_rate / frame_rate;
+  const auto report_interval = 1e+9 / static_cast<double>(report_rate);
+  for (auto report = 0; report < reports_per_frame; ++report) {
+    context.push(event_type{
+        .timestamp = duration_type{report * report_interval},
+        .payload = motion_type{.delta_x = 1.0, .delta_y = -1.0},
+    });
+  }
+  context.flush();
+}
+
+auto drain(const buffer_type &buffer, std::size_t &read_index)
+    -> motion_type {
+  auto total = motion_type{};
+  const auto write_index = buffer.write_head();
+  for (; read_index < write_index; ++read_index) {
+    const auto event = buffer.read(read_index % buffer.capacity());
+    if (const auto *motion = std::get_if<motion_type>(&event.payload)) {
+      total.delta_x += motion->delta_x;
+      total.delta_y += motion->delta_y;
+    }
+  }
+  return total;
+}
+
+template <class TCoalescingPolicy>
+auto produce_cursor_frame(benchmark::State &state) -> void {
+  auto buffer = buffer_type{};
+  auto context = context_type<TCoalescingPolicy>{buffer};
+  for (auto _ : state) {
+    produce_frame(context, state.range(0));
+  }
+  benchmark::DoNotOptimize(buffer.write_head());
+  state.counters["events_per_frame"] =
+      static_cast<double>(buffer.write_head()) /
+      static_cast<double>(state.iterations());
+  state.counters["ring_occupancy"] =
+      static_cast<double>(buffer.write_head()) /
+      static_cast<double>(state.iterations() * buffer.capacity());
+}
+
+template <class TCoalescingPolicy>
+auto drain_cursor_frame(benchmark::State &state) -> void {
+  auto buffer = buffer_type{};
+  auto context = context_type<TCoalescingPolicy>{buffer};
+  auto read_index = 0UZ;
+  for (auto _ : state) {
+    produce_frame(context, state.range(0));
+    const auto start = std::chrono::steady_clock::now();
+    benchmark::DoNotOptimize(drain(buffer, read_index));
+    state.SetIterationTime(
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+            .count());
+  }
+}
+} // namespace
+
+BENCHMARK(produce_cursor_frame<coalescing::none>)
+    ->Name("cursor_coalescing/produce_frame/none")
+    ->Arg(1000)
+    ->Arg(8000);
+BENCHMARK(produce_cursor_frame<coalescing::cursor>)
+    ->Name("cursor_coalescing/produce_frame/cursor")
+    ->Arg(1000)
+    ->Arg(8000);
+BENCHMARK(drain_cursor_frame<coalescing::none>)
+    ->Name("cursor_coalescing/drain_frame/none")
+    ->UseManualTime()
+    ->Arg(1000)
+    ->Arg(8000);
+BENCHMARK(drain_cursor_frame<coalescing::cursor>)
+    ->Name("cursor_coalescing/drain_frame/cursor")
+    ->UseManualTime()
+    ->Arg(1000)
+    ->Arg(8000);
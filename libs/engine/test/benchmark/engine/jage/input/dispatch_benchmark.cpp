@@ -0,0 +1,159 @@
+#include <jage/engine/input/dispatch.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/mouse/action.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/cursor/position.hpp>
+#include <jage/engine/input/mouse/events/horizontal_scroll.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/stdx/overloaded.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+namespace keyboard = jage::engine::input::keyboard;
+namespace mouse = jage::engine::input::mouse;
+
+constexpr auto event_count = 10'000UZ;
+
+auto make_events() -> std::vector<event_type> {
+  auto generator = std::mt19937{42U};
+  auto pick = std::uniform_int_distribution<int>{0, 5};
+  auto events = std::vector<event_type>{};
+  for (auto index = 0UZ; index < event_count; ++index) {
+    const auto timestamp = duration_type{static_cast<double>(index)};
+    const auto value = static_cast<double>(index % 7UZ);
+    switch (pick(generator)) {
+    case 0:
+      events.push_back({
+          .timestamp = timestamp,
+          .payload =
+              keyboard::events::key_press{
+                  .key = keyboard::key::w,
+                  .scancode = keyboard::scancode::w,
+                  .action = index % 2UZ == 0UZ ? keyboard::action::press
+                                               : keyboard::action::release,
+                  .modifiers = {},
+              },
+      });
+      break;
+    case 1:
+      events.push_back({
+          .timestamp = timestamp,
+          .payload =
+              mouse::events::click{
+                  .button = mouse::button::left,
+                  .action = mouse::action::press,
+                  .modifiers = {},
+              },
+      });
+      break;
+    case 2:
+      events.push_back({
+          .timestamp = timestamp,
+          .payload = mouse::events::cursor::position{.x = value, .y = value},
+      });
+      break;
+    case 3:
+      events.push_back({
+          .timestamp = timestamp,
+          .payload = mouse::events::cursor::motion{.delta_x = value,
+                                                   .delta_y = -value},
+      });
+      break;
+    case 4:
+      events.push_back({
+          .timestamp = timestamp,
+          .payload = mouse::events::horizontal_scroll{.offset = value},
+      });
+      break;
+    default:
+      events.push_back({
+          .timestamp = timestamp,
+          .payload = mouse::events::vertical_scroll{.offset = value},
+      });
+      break;
+    }
+  }
+  return events;
+}
+
+// Folds the drained events into the kind of per-frame totals a game loop
+// keeps, so every payload type does a little work.
+struct totals {
+  std::size_t presses{};
+  std::size_t clicks{};
+  double cursor_x{};
+  double motion_x{};
+  double motion_y{};
+  double scroll{};
+  double latest{};
+
+  auto handler() {
+    return jage::stdx::overloaded{
+        [this](const keyboard::events::key_press &key_press,
+               const duration_type timestamp) {
+          presses += keyboard::action::press == key_press.action ? 1UZ : 0UZ;
+          latest = timestamp.count();
+        },
+        [this](const mouse::events::click &, const duration_type) {
+          ++clicks;
+        },
+        [this](const mouse::events::cursor::position &position,
+               const duration_type) { cursor_x = position.x; },
+        [this](const mouse::events::cursor::motion &motion,
+               const duration_type) {
+          motion_x += motion.delta_x;
+          motion_y += motion.delta_y;
+        },
+        [this](const mouse::events::horizontal_scroll &horizontal,
+               const duration_type) { scroll += horizontal.offset; },
+        [this](const mouse::events::vertical_scroll &vertical,
+               const duration_type) { scroll -= vertical.offset; },
+        [](const auto &, const duration_type) {},
+    };
+  }
+};
+
+auto drain_visit(benchmark::State &state) -> void {
+  const auto events = make_events();
+  for (auto _ : state) {
+    auto frame = totals{};
+    auto handler = frame.handler();
+    for (const auto &input_event : events) {
+      std::visit(
+          [&](const auto &payload) { handler(payload, input_event.timestamp); },
+          input_event.payload);
+    }
+    benchmark::DoNotOptimize(frame);
+  }
+  state.SetItemsProcessed(state.iterations() * event_count);
+}
+
+auto drain_dispatch(benchmark::State &state) -> void {
+  const auto events = make_events();
+  for (auto _ : state) {
+    auto frame = totals{};
+    jage::engine::input::dispatch(events, frame.handler());
+    benchmark::DoNotOptimize(frame);
+  }
+  state.SetItemsProcessed(state.iterations() * event_count);
+}
+} // namespace
+
+BENCHMARK(drain_visit)->Name("dispatch/drain_10k_mixed/visit");
+BENCHMARK(drain_dispatch)->Name("dispatch/drain_10k_mixed/dispatch");
@@ -0,0 +1,74 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/encoded_event.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <variant>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using motion_type = jage::engine::input::mouse::events::cursor::motion;
+
+constexpr auto capacity = 4096UZ;
+
+auto make_event(const std::size_t index) -> event_type {
+  return {
+      .timestamp = duration_type{static_cast<double>(index)},
+      .payload = motion_type{.delta_x = 1.0, .delta_y = -1.0},
+  };
+}
+
+auto sum_motion(const event_type &input_event, motion_type &total) -> void {
+  if (const auto *motion = std::get_if<motion_type>(&input_event.payload)) {
+    total.delta_x += motion->delta_x;
+    total.delta_y += motion->delta_y;
+  }
+}
+
+auto drain_event_ring(benchmark::State &state) -> void {
+  using buffer_type =
+      jage::engine::containers::spmc::ring_buffer<event_type, capacity>;
+  auto buffer = std::make_unique<buffer_type>();
+  for (auto index = 0UZ; index < capacity; ++index) {
+    buffer->push(make_event(index));
+  }
+  for (auto _ : state) {
+    auto total = motion_type{};
+    for (auto index = 0UZ; index < capacity; ++index) {
+      sum_motion(buffer->read(index), total);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * capacity);
+  state.counters["ring_bytes"] = static_cast<double>(sizeof(buffer_type));
+}
+
+auto drain_encoded_event_ring(benchmark::State &state) -> void {
+  using buffer_type =
+      jage::engine::containers::spmc::packed_ring_buffer<
+          jage::engine::input::encoded_event, capacity>;
+  auto buffer = std::make_unique<buffer_type>();
+  for (auto index = 0UZ; index < capacity; ++index) {
+    buffer->push(jage::engine::input::encode(make_event(index)));
+  }
+  for (auto _ : state) {
+    auto total = motion_type{};
+    for (auto index = 0UZ; index < capacity; ++index) {
+      sum_motion(
+          jage::engine::input::decode<duration_type>(buffer->read(index)),
+          total);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * capacity);
+  state.counters["ring_bytes"] = static_cast<double>(sizeof(buffer_type));
+}
+} // namespace
+
+BENCHMARK(drain_event_ring)->Name("input_ring/drain/event");
+BENCHMARK(drain_encoded_event_ring)->Name("input_ring/drain/encoded_event");
@@ -0,0 +1,138 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/platforms/evdev.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <thread>
+
+#include <linux/input.h>
+#include <unistd.h>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using ring_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 1024UZ>;
+using std::chrono::steady_clock;
+
+constexpr auto frame_period = std::chrono::microseconds{16'667};
+
+auto now() -> duration_type {
+  return std::chrono::duration_cast<duration_type>(
+      steady_clock::now().time_since_epoch());
+}
+
+// Stands in for the kernel: stamps the record with CLOCK_MONOTONIC, as a
+// device switched with EVIOCSCLOCKID would.
+auto write_key(const int descriptor, const duration_type timestamp) -> void {
+  const auto microseconds = static_cast<long>(timestamp.count() / 1'000.0);
+  auto records = std::array<::input_event, 2UZ>{};
+  records[0].input_event_sec = microseconds / 1'000'000L;
+  records[0].input_event_usec = microseconds % 1'000'000L;
+  records[0].type = EV_KEY;
+  records[0].code = KEY_SPACE;
+  records[0].value = 1;
+  records[1].input_event_sec = records[0].input_event_sec;
+  records[1].input_event_usec = records[0].input_event_usec;
+  records[1].type = EV_SYN;
+  records[1].code = SYN_REPORT;
+  benchmark::DoNotOptimize(::write(descriptor, &records, sizeof(records)));
+}
+
+// What the GLFW path does: events surface when the main loop polls, and are
+// stamped at that moment.
+struct stamp_on_poll_sink {
+  ring_type &ring;
+
+  auto push(event_type &&input_event) -> void {
+    input_event.timestamp = now();
+    ring.push(std::move(input_event));
+  }
+
+  auto push(const event_type &input_event) -> void {
+    auto stamped = input_event;
+    stamped.timestamp = now();
+    ring.push(std::move(stamped));
+  }
+};
+
+auto report(benchmark::State &state, const double total_latency,
+            const double total_error) -> void {
+  const auto iterations = static_cast<double>(state.iterations());
+  state.counters["mean_latency_us"] = total_latency / iterations / 1'000.0;
+  state.counters["mean_timestamp_error_us"] =
+      total_error / iterations / 1'000.0;
+}
+
+auto evdev_thread(benchmark::State &state) -> void {
+  auto ring = ring_type{};
+  auto reader =
+      jage::engine::input::platforms::evdev<duration_type, ring_type>{ring};
+  auto ends = std::array<int, 2UZ>{};
+  if (0 != ::pipe(std::data(ends))) {
+    state.SkipWithError("pipe failed");
+    return;
+  }
+  reader.add_device(ends[0]);
+  reader.start();
+  auto total_latency = 0.0;
+  auto total_error = 0.0;
+  for (auto _ : state) {
+    const auto expected = ring.write_head() + 1UZ;
+    const auto written = now();
+    write_key(ends[1], written);
+    while (ring.write_head() < expected) {
+    }
+    total_latency += (now() - written).count();
+    total_error += std::abs(
+        (ring.read((expected - 1UZ) % ring.capacity()).timestamp - written)
+            .count());
+  }
+  reader.stop();
+  ::close(ends[1]);
+  report(state, total_latency, total_error);
+}
+
+auto poll_per_frame(benchmark::State &state) -> void {
+  auto ring = ring_type{};
+  auto sink = stamp_on_poll_sink{ring};
+  auto reader = jage::engine::input::platforms::evdev<duration_type,
+                                                      stamp_on_poll_sink>{sink};
+  auto ends = std::array<int, 2UZ>{};
+  if (0 != ::pipe(std::data(ends))) {
+    state.SkipWithError("pipe failed");
+    return;
+  }
+  reader.add_device(ends[0]);
+  auto generator = std::mt19937{42U};
+  auto phase = std::uniform_int_distribution<long>{0L, frame_period.count()};
+  auto total_latency = 0.0;
+  auto total_error = 0.0;
+  for (auto _ : state) {
+    const auto frame_start = steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::microseconds{phase(generator)});
+    const auto written = now();
+    write_key(ends[1], written);
+    std::this_thread::sleep_until(frame_start + frame_period);
+    reader.poll();
+    total_latency += (now() - written).count();
+    total_error +=
+        (ring.read((ring.write_head() - 1UZ) % ring.capacity()).timestamp -
+         written)
+            .count();
+  }
+  ::close(ends[1]);
+  report(state, total_latency, total_error);
+}
+} // namespace
+
+BENCHMARK(evdev_thread)->Name("evdev/key_to_consumer/evdev_thread");
+BENCHMARK(poll_per_frame)
+    ->Name("evdev/key_to_consumer/poll_per_60hz_frame")
+    ->Iterations(120);
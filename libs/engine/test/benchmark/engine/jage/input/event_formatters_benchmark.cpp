@@ -0,0 +1,138 @@
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/event_formatters.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/mouse/action.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/cursor/position.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fmt/format.h>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+std::atomic<std::uint64_t> allocations{};
+} // namespace
+
+[[gnu::noinline]] auto operator new(const std::size_t size) -> void * {
+  allocations.fetch_add(1U, std::memory_order::relaxed);
+  if (auto *memory = std::malloc(size == 0UZ ? 1UZ : size)) {
+    return memory;
+  }
+  throw std::bad_alloc{};
+}
+
+[[gnu::noinline]] auto operator delete(void *memory) noexcept -> void { std::free(memory); }
+
+[[gnu::noinline]] auto operator delete(void *memory, std::size_t) noexcept -> void {
+  std::free(memory);
+}
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+namespace keyboard = jage::engine::input::keyboard;
+namespace mouse = jage::engine::input::mouse;
+
+constexpr auto event_count = 1'000UZ;
+
+auto make_events() -> std::vector<event_type> {
+  auto generator = std::mt19937{42U};
+  auto pick = std::uniform_int_distribution<int>{0, 3};
+  auto events = std::vector<event_type>{};
+  for (auto index = 0UZ; index < event_count; ++index) {
+    const auto timestamp = duration_type{1.7e18 + static_cast<double>(index)};
+    const auto value = static_cast<double>(index % 7UZ) + 0.5;
+    switch (pick(generator)) {
+    case 0:
+      events.push_back({.timestamp = timestamp,
+                        .payload = keyboard::events::key_press{
+                            .key = keyboard::key::w,
+                            .scancode = keyboard::scancode::w,
+                            .action = keyboard::action::press,
+                            .modifiers = {},
+                        }});
+      break;
+    case 1:
+      events.push_back({.timestamp = timestamp,
+                        .payload = mouse::events::click{
+                            .button = mouse::button::left,
+                            .action = mouse::action::release,
+                            .modifiers = {},
+                        }});
+      break;
+    case 2:
+      events.push_back(
+          {.timestamp = timestamp,
+           .payload = mouse::events::cursor::motion{.delta_x = value,
+                                                    .delta_y = -value}});
+      break;
+    default:
+      events.push_back(
+          {.timestamp = timestamp,
+           .payload = mouse::events::vertical_scroll{.offset = value}});
+      break;
+    }
+  }
+  return events;
+}
+
+auto report(benchmark::State &state, const std::uint64_t allocated) -> void {
+  const auto formatted = state.iterations() * event_count;
+  state.SetItemsProcessed(static_cast<std::int64_t>(formatted));
+  state.counters["allocations_per_event"] =
+      static_cast<double>(allocated) / static_cast<double>(formatted);
+}
+
+// What the apps did: a fresh std::string per event.
+auto format_to_string(benchmark::State &state) -> void {
+  const auto events = make_events();
+  const auto before = allocations.load(std::memory_order::relaxed);
+  for (auto _ : state) {
+    for (const auto &input_event : events) {
+      auto text = fmt::format("{}", input_event);
+      benchmark::DoNotOptimize(text);
+    }
+  }
+  report(state, allocations.load(std::memory_order::relaxed) - before);
+}
+
+template <bool Compact>
+auto format_to_buffer(benchmark::State &state) -> void {
+  const auto events = make_events();
+  auto buffer = fmt::memory_buffer{};
+  const auto before = allocations.load(std::memory_order::relaxed);
+  for (auto _ : state) {
+    for (const auto &input_event : events) {
+      buffer.clear();
+      if constexpr (Compact) {
+        fmt::format_to(fmt::appender{buffer}, "{:c}\n", input_event);
+      } else {
+        fmt::format_to(fmt::appender{buffer}, "{}\n", input_event);
+      }
+      benchmark::DoNotOptimize(buffer.data());
+    }
+  }
+  report(state, allocations.load(std::memory_order::relaxed) - before);
+}
+} // namespace
+
+BENCHMARK(format_to_string)->Name("event_formatters/1000_mixed/to_string");
+BENCHMARK(format_to_buffer<false>)
+    ->Name("event_formatters/1000_mixed/to_buffer");
+BENCHMARK(format_to_buffer<true>)
+    ->Name("event_formatters/1000_mixed/to_buffer_compact");
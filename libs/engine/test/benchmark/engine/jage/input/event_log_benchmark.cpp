@@ -0,0 +1,116 @@
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/event_formatters.hpp>
+#include <jage/engine/input/event_log.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <fmt/format.h>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+namespace keyboard = jage::engine::input::keyboard;
+namespace mouse = jage::engine::input::mouse;
+
+constexpr auto events_per_frame = 8UZ;
+constexpr auto visible_rows = 40UZ;
+
+auto make_event(const std::size_t index) -> event_type {
+  const auto timestamp = duration_type{1.7e18 + static_cast<double>(index)};
+  if (0UZ == index % 2UZ) {
+    return {.timestamp = timestamp,
+            .payload = mouse::events::cursor::motion{
+                .delta_x = static_cast<double>(index % 7UZ),
+                .delta_y = 1.0}};
+  }
+  return {.timestamp = timestamp,
+          .payload = keyboard::events::key_press{
+              .key = keyboard::key::w,
+              .scancode = keyboard::scancode::w,
+              .action = keyboard::action::press,
+              .modifiers = {},
+          }};
+}
+
+// The editor's previous panel: every event formatted on arrival, and every
+// stored line formatted again and submitted each frame.
+class eager_log {
+  std::size_t next_write_index_{};
+  std::vector<std::optional<std::string>> lines_;
+
+public:
+  explicit eager_log(const std::size_t capacity) : lines_(capacity) {}
+
+  auto push(const event_type &input_event) -> void {
+    lines_[next_write_index_++ % std::size(lines_)] =
+        fmt::format("{}", input_event);
+  }
+
+  auto draw() const -> void {
+    for (auto index = 0UZ; index < std::size(lines_); ++index) {
+      if (const auto &text = lines_[index]) {
+        auto line = fmt::format("[{}]: {}", index, *text);
+        benchmark::DoNotOptimize(line);
+      }
+    }
+  }
+};
+
+auto eager_frame(benchmark::State &state) -> void {
+  const auto history = static_cast<std::size_t>(state.range(0));
+  auto log = eager_log{history};
+  auto index = 0UZ;
+  for (; index < history; ++index) {
+    log.push(make_event(index));
+  }
+  for (auto _ : state) {
+    for (auto event = 0UZ; event < events_per_frame; ++event) {
+      log.push(make_event(index++));
+    }
+    log.draw();
+  }
+}
+
+// Scrolled to the bottom, as the editor keeps it: each frame formats only
+// the rows that arrived since the last one.
+auto lazy_frame(benchmark::State &state) -> void {
+  const auto history = static_cast<std::size_t>(state.range(0));
+  auto log = jage::engine::input::event_log<event_type>{history};
+  auto index = 0UZ;
+  for (; index < history; ++index) {
+    log.push(make_event(index));
+  }
+  for (auto _ : state) {
+    for (auto event = 0UZ; event < events_per_frame; ++event) {
+      log.push(make_event(index++));
+    }
+    for (auto row = log.size() - visible_rows; row < log.size(); ++row) {
+      benchmark::DoNotOptimize(log.text(row));
+    }
+  }
+  state.counters["formatted_rows_per_frame"] =
+      benchmark::Counter(static_cast<double>(log.formatted_rows()),
+                         benchmark::Counter::kAvgIterations);
+}
+} // namespace
+
+BENCHMARK(eager_frame)
+    ->Name("event_log/frame/eager")
+    ->Arg(500)
+    ->Arg(100'000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(lazy_frame)
+    ->Name("event_log/frame/lazy")
+    ->Arg(500)
+    ->Arg(100'000)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,120 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/filtered_reader.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/mouse/action.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/cursor/position.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <variant>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using ring_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 4096UZ>;
+namespace keyboard = jage::engine::input::keyboard;
+namespace mouse = jage::engine::input::mouse;
+
+// One ring's worth of mixed traffic in which one event in ten is relative
+// motion, the rest keys, clicks, cursor positions and scrolling.
+auto make_ring() -> std::unique_ptr<ring_type> {
+  auto ring = std::make_unique<ring_type>();
+  auto generator = std::mt19937{42U};
+  auto pick = std::uniform_int_distribution<int>{0, 9};
+  for (auto index = 0UZ; index + 1UZ < ring_type::capacity(); ++index) {
+    const auto timestamp = duration_type{static_cast<double>(index)};
+    const auto value = static_cast<double>(index % 7UZ);
+    switch (pick(generator)) {
+    case 0:
+      ring->push({.timestamp = timestamp,
+                  .payload = mouse::events::cursor::motion{
+                      .delta_x = value, .delta_y = -value}});
+      break;
+    case 1:
+    case 2:
+      ring->push({.timestamp = timestamp,
+                  .payload = keyboard::events::key_press{
+                      .key = keyboard::key::w,
+                      .scancode = keyboard::scancode::w,
+                      .action = keyboard::action::press,
+                      .modifiers = {},
+                  }});
+      break;
+    case 3:
+      ring->push({.timestamp = timestamp,
+                  .payload = mouse::events::click{
+                      .button = mouse::button::left,
+                      .action = mouse::action::press,
+                      .modifiers = {},
+                  }});
+      break;
+    case 4:
+      ring->push({.timestamp = timestamp,
+                  .payload = mouse::events::vertical_scroll{.offset = value}});
+      break;
+    default:
+      ring->push({.timestamp = timestamp,
+                  .payload = mouse::events::cursor::position{.x = value,
+                                                             .y = value}});
+      break;
+    }
+  }
+  return ring;
+}
+
+struct camera {
+  double yaw{};
+  double pitch{};
+};
+
+auto camera_full_drain(benchmark::State &state) -> void {
+  const auto ring = make_ring();
+  for (auto _ : state) {
+    auto view = camera{};
+    for (auto index = 0UZ; index < ring->write_head(); ++index) {
+      const auto input_event = ring->read(index % ring->capacity());
+      if (const auto *motion =
+              std::get_if<mouse::events::cursor::motion>(&input_event.payload)) {
+        view.yaw += motion->delta_x;
+        view.pitch += motion->delta_y;
+      }
+    }
+    benchmark::DoNotOptimize(view);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(ring->write_head()));
+}
+
+auto camera_filtered_reader(benchmark::State &state) -> void {
+  const auto ring = make_ring();
+  for (auto _ : state) {
+    auto view = camera{};
+    auto reader =
+        jage::engine::input::filtered_reader<mouse::events::cursor::motion>{};
+    reader.drain(*ring, [&](const mouse::events::cursor::motion &motion) {
+      view.yaw += motion.delta_x;
+      view.pitch += motion.delta_y;
+    });
+    benchmark::DoNotOptimize(view);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(ring->write_head()));
+}
+} // namespace
+
+BENCHMARK(camera_full_drain)->Name("filtered_reader/camera_4095_mixed/full");
+BENCHMARK(camera_filtered_reader)
+    ->Name("filtered_reader/camera_4095_mixed/filtered");
@@ -0,0 +1,171 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/adapters/glfw_gamepads.hpp>
+#include <jage/engine/input/contexts/coalescing.hpp>
+#include <jage/engine/input/contexts/glfw.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/gamepad/action.hpp>
+#include <jage/engine/input/gamepad/axis.hpp>
+#include <jage/engine/input/gamepad/button.hpp>
+#include <jage/engine/input/gamepad/events/axis_motion.hpp>
+#include <jage/engine/input/gamepad/events/button_press.hpp>
+#include <jage/engine/input/gamepad/id.hpp>
+#include <jage/engine/test/fakes/input/platforms/glfw.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <jage/engine/time/internal/steady_clock.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using buffer_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 1024UZ>;
+using context_type = jage::engine::input::contexts::glfw<
+    duration_type, buffer_type,
+    jage::engine::time::internal::steady_clock<duration_type>,
+    jage::engine::input::contexts::coalescing::none>;
+using platform_type =
+    jage::engine::test::fakes::input::platforms::glfw<context_type>;
+using gamepad_state_type = platform_type::gamepad_state_type;
+namespace gamepad = jage::engine::input::gamepad;
+
+constexpr auto connected_gamepads = 4;
+constexpr auto recorded_frames = 600UZ;
+
+// Sensor noise of a few percent around rest, as idle sticks report.
+auto idle_frames() -> std::vector<gamepad_state_type> {
+  auto generator = std::mt19937{42U};
+  auto noise = std::uniform_real_distribution<float>{-0.05F, 0.05F};
+  auto frames = std::vector<gamepad_state_type>(recorded_frames);
+  for (auto &frame : frames) {
+    for (auto &axis : frame.axes) {
+      axis = noise(generator);
+    }
+    frame.axes[std::to_underlying(gamepad::axis::left_trigger)] = -1.0F;
+    frame.axes[std::to_underlying(gamepad::axis::right_trigger)] = -1.0F;
+  }
+  return frames;
+}
+
+// Both sticks circling once a second at 60 Hz, a trigger squeezed and let go,
+// and a button tapped every ten frames, all with the same noise on top.
+auto active_frames() -> std::vector<gamepad_state_type> {
+  auto frames = idle_frames();
+  for (auto index = 0UZ; index < std::size(frames); ++index) {
+    const auto angle =
+        2.0 * std::numbers::pi * static_cast<double>(index) / 60.0;
+    auto &axes = frames[index].axes;
+    axes[std::to_underlying(gamepad::axis::left_x)] +=
+        static_cast<float>(std::cos(angle) * 0.9);
+    axes[std::to_underlying(gamepad::axis::left_y)] +=
+        static_cast<float>(std::sin(angle) * 0.9);
+    axes[std::to_underlying(gamepad::axis::right_x)] +=
+        static_cast<float>(std::sin(angle) * 0.9);
+    axes[std::to_underlying(gamepad::axis::right_y)] +=
+        static_cast<float>(std::cos(angle) * 0.9);
+    axes[std::to_underlying(gamepad::axis::right_trigger)] =
+        static_cast<float>(-std::cos(angle));
+    frames[index].buttons[std::to_underlying(gamepad::button::a)] =
+        static_cast<unsigned char>((index / 10UZ) % 2UZ);
+  }
+  return frames;
+}
+
+// What pushing the full state every frame would cost.
+auto push_full_state(platform_type &platform, context_type &context)
+    -> std::size_t {
+  auto pushed = 0UZ;
+  for (auto jid = 0; jid < static_cast<int>(gamepad::id_count); ++jid) {
+    auto state = gamepad_state_type{};
+    if (not platform.get_gamepad_state(jid, state)) {
+      continue;
+    }
+    const auto timestamp = context.timestamp();
+    const auto id = static_cast<gamepad::id>(jid);
+    for (auto index = 0UZ; index < gamepad::button_count; ++index) {
+      context.push(event_type{
+          .timestamp = timestamp,
+          .payload =
+              gamepad::events::button_press{
+                  .gamepad = id,
+                  .button = static_cast<gamepad::button>(index),
+                  .action = 0U != state.buttons[index]
+                                ? gamepad::action::press
+                                : gamepad::action::release,
+              },
+      });
+    }
+    for (auto index = 0UZ; index < gamepad::axis_count; ++index) {
+      context.push(event_type{
+          .timestamp = timestamp,
+          .payload =
+              gamepad::events::axis_motion{
+                  .gamepad = id,
+                  .axis = static_cast<gamepad::axis>(index),
+                  .value = state.axes[index],
+              },
+      });
+    }
+    pushed += gamepad::button_count + gamepad::axis_count;
+  }
+  return pushed;
+}
+
+template <bool Delta>
+auto poll(benchmark::State &state,
+          const std::vector<gamepad_state_type> &frames) -> void {
+  auto buffer = buffer_type{};
+  auto context = context_type{buffer};
+  auto platform = platform_type{};
+  platform.set_window_user_pointer(nullptr, &context);
+  auto gamepads =
+      jage::engine::input::adapters::glfw_gamepads<platform_type>{};
+  auto frame = 0UZ;
+  auto pushed = 0UZ;
+  for (auto _ : state) {
+    for (auto jid = 0; jid < connected_gamepads; ++jid) {
+      platform_type::gamepads[jid] =
+          frames[(frame + static_cast<std::size_t>(jid) * 7UZ) %
+                 std::size(frames)];
+    }
+    ++frame;
+    if constexpr (Delta) {
+      pushed += gamepads.poll(nullptr, platform);
+    } else {
+      pushed += push_full_state(platform, context);
+    }
+  }
+  state.counters["events_per_frame"] =
+      static_cast<double>(pushed) / static_cast<double>(state.iterations());
+  platform.reset();
+}
+
+auto full_state_idle(benchmark::State &state) -> void {
+  poll<false>(state, idle_frames());
+}
+
+auto full_state_active(benchmark::State &state) -> void {
+  poll<false>(state, active_frames());
+}
+
+auto delta_idle(benchmark::State &state) -> void {
+  poll<true>(state, idle_frames());
+}
+
+auto delta_active(benchmark::State &state) -> void {
+  poll<true>(state, active_frames());
+}
+} // namespace
+
+BENCHMARK(full_state_idle)->Name("gamepad/4_pads/full_state/idle");
+BENCHMARK(full_state_active)->Name("gamepad/4_pads/full_state/active");
+BENCHMARK(delta_idle)->Name("gamepad/4_pads/delta/idle");
+BENCHMARK(delta_active)->Name("gamepad/4_pads/delta/active");
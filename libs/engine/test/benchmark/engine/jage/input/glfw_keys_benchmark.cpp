@@ -0,0 +1,90 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/adapters/glfw.hpp>
+#include <jage/engine/input/contexts/coalescing.hpp>
+#include <jage/engine/input/contexts/glfw.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/test/fakes/input/platforms/glfw.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/interop/glfw_glad.hpp>
+
+#include <jage/engine/time/internal/steady_clock.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using buffer_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 256UZ>;
+using context_type = jage::engine::input::contexts::glfw<
+    duration_type, buffer_type,
+    jage::engine::time::internal::steady_clock<duration_type>,
+    jage::engine::input::contexts::coalescing::none>;
+using platform_type =
+    jage::engine::test::fakes::input::platforms::glfw<context_type>;
+using adapter_type = jage::engine::input::adapters::glfw<platform_type>;
+
+// A Linux-like layout: letters and digits, with X11 keycodes (evdev + 8).
+constexpr auto glfw_keys = [] {
+  auto keys = std::array<int, 36UZ>{};
+  for (auto index = 0UZ; index < 26UZ; ++index) {
+    keys[index] = GLFW_KEY_A + static_cast<int>(index);
+  }
+  for (auto index = 0UZ; index < 10UZ; ++index) {
+    keys[26UZ + index] = GLFW_KEY_0 + static_cast<int>(index);
+  }
+  return keys;
+}();
+
+auto os_scancode_of(const int glfw_key) -> int { return glfw_key - 20 + 8; }
+
+auto set_up(platform_type &platform, context_type &context) -> void {
+  platform.set_window_user_pointer(nullptr, &context);
+  for (const auto glfw_key : glfw_keys) {
+    platform_type::key_to_scancode[glfw_key] = os_scancode_of(glfw_key);
+  }
+}
+
+auto initialize_cost(benchmark::State &state) -> void {
+  auto buffer = buffer_type{};
+  auto context = context_type{buffer};
+  auto platform = platform_type{};
+  set_up(platform, context);
+  for (auto _ : state) {
+    adapter_type::initialize(nullptr, platform);
+  }
+  platform.reset();
+}
+
+auto key_callback_cost(benchmark::State &state) -> void {
+  auto buffer = buffer_type{};
+  auto context = context_type{buffer};
+  auto platform = platform_type{};
+  set_up(platform, context);
+  adapter_type::initialize(nullptr, platform);
+  auto generator = std::mt19937{42U};
+  auto pick = std::uniform_int_distribution<std::size_t>{
+      0UZ, std::size(glfw_keys) - 1UZ};
+  auto presses = std::vector<int>(4096UZ);
+  for (auto &press : presses) {
+    press = glfw_keys[pick(generator)];
+  }
+  auto index = 0UZ;
+  for (auto _ : state) {
+    const auto glfw_key = presses[index++ % std::size(presses)];
+    platform.trigger_key_callback(glfw_key, os_scancode_of(glfw_key),
+                                  GLFW_PRESS, 0);
+  }
+  benchmark::DoNotOptimize(buffer.write_head());
+  state.SetItemsProcessed(state.iterations());
+  platform.reset();
+}
+} // namespace
+
+BENCHMARK(initialize_cost)->Name("glfw_adapter/initialize");
+BENCHMARK(key_callback_cost)->Name("glfw_adapter/key_callback");
@@ -0,0 +1,78 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/adapters/glfw.hpp>
+#include <jage/engine/input/contexts/coalescing.hpp>
+#include <jage/engine/input/contexts/glfw.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/test/fakes/input/platforms/glfw.hpp>
+#include <jage/engine/time/clock.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/hertz.hpp>
+
+#include <jage/engine/time/internal/steady_clock.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using buffer_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 256UZ>;
+using context_type = jage::engine::input::contexts::glfw<
+    duration_type, buffer_type,
+    jage::engine::time::internal::steady_clock<duration_type>,
+    jage::engine::input::contexts::coalescing::none>;
+using platform_type =
+    jage::engine::test::fakes::input::platforms::glfw<context_type>;
+using adapter_type = jage::engine::input::adapters::glfw<platform_type>;
+using jage::engine::time::operator""_Hz;
+
+auto cursor_callback_cost(benchmark::State &state) -> void {
+  auto buffer = buffer_type{};
+  auto context = context_type{buffer};
+  auto platform = platform_type{};
+  platform.set_window_user_pointer(nullptr, &context);
+  adapter_type::initialize(nullptr, platform);
+  auto position = 0.0;
+  for (auto _ : state) {
+    position += 1.0;
+    platform.trigger_cursor_position_callback(position, position);
+  }
+  benchmark::DoNotOptimize(buffer.write_head());
+  state.SetItemsProcessed(state.iterations());
+  platform.reset();
+}
+
+auto clock_correlation_error(benchmark::State &state) -> void {
+  auto buffer = buffer_type{};
+  auto context = context_type{buffer};
+  auto platform = platform_type{};
+  platform.set_window_user_pointer(nullptr, &context);
+  adapter_type::initialize(nullptr, platform);
+  const auto clock = jage::engine::time::clock<duration_type>{60_Hz};
+  auto position = 0.0;
+  auto total_error = 0.0;
+  auto max_error = 0.0;
+  for (auto _ : state) {
+    position += 1.0;
+    const auto before = clock.real_time();
+    platform.trigger_cursor_position_callback(position, position);
+    const auto after = clock.real_time();
+    const auto timestamp =
+        buffer.read((buffer.write_head() - 1UZ) % buffer.capacity()).timestamp;
+    const auto error =
+        std::max({before - timestamp, timestamp - after, duration_type{}});
+    total_error += error.count();
+    max_error = std::max(max_error, error.count());
+  }
+  state.counters["mean_error_ns"] =
+      total_error / static_cast<double>(state.iterations());
+  state.counters["max_error_ns"] = max_error;
+  platform.reset();
+}
+} // namespace
+
+BENCHMARK(cursor_callback_cost)->Name("glfw_adapter/cursor_callback");
+BENCHMARK(clock_correlation_error)->Name("glfw_adapter/clock_correlation");
@@ -0,0 +1,93 @@
+#include <jage/engine/concurrency/double_buffer.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <jage/engine/input/internal/latency_probe.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+namespace keyboard = jage::engine::input::keyboard;
+namespace mouse = jage::engine::input::mouse;
+
+template <bool Enabled>
+using probe_type = jage::engine::input::internal::latency_probe<
+    event_type, Enabled, jage::engine::concurrency::double_buffer,
+    std::atomic>;
+
+constexpr auto batch_size = 64UZ;
+
+auto make_batch() -> std::array<event_type, batch_size> {
+  auto events = std::array<event_type, batch_size>{};
+  for (auto index = 0UZ; index < batch_size; ++index) {
+    const auto timestamp = duration_type{static_cast<double>(index * 997UZ)};
+    switch (index % 3UZ) {
+    case 0UZ:
+      events[index] = {.timestamp = timestamp,
+                       .payload = mouse::events::cursor::motion{}};
+      break;
+    case 1UZ:
+      events[index] = {.timestamp = timestamp,
+                       .payload = keyboard::events::key_press{}};
+      break;
+    default:
+      events[index] = {.timestamp = timestamp,
+                       .payload = mouse::events::click{}};
+      break;
+    }
+  }
+  return events;
+}
+
+// One drain of a 64-event batch: a clock read and a depth sample, then one
+// record per event. Counters report the cost per event.
+template <bool Enabled> auto drain(benchmark::State &state) -> void {
+  auto probe = probe_type<Enabled>{};
+  auto events = make_batch();
+  benchmark::DoNotOptimize(events);
+  const auto now = [] {
+    return std::chrono::duration_cast<duration_type>(
+        std::chrono::steady_clock::now().time_since_epoch());
+  };
+  for (auto _ : state) {
+    probe.start_drain(now, batch_size);
+    for (const auto &input_event : events) {
+      probe.record(input_event);
+    }
+    benchmark::ClobberMemory();
+  }
+  probe.publish();
+  benchmark::DoNotOptimize(probe.read());
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(batch_size));
+}
+
+auto publish(benchmark::State &state) -> void {
+  auto probe = probe_type<true>{};
+  probe.start_drain([] { return duration_type{1e9}; }, batch_size);
+  for (const auto &input_event : make_batch()) {
+    probe.record(input_event);
+  }
+  for (auto _ : state) {
+    probe.publish();
+    benchmark::ClobberMemory();
+  }
+}
+} // namespace
+
+BENCHMARK(drain<false>)->Name("latency_probe/drain/disabled");
+BENCHMARK(drain<true>)->Name("latency_probe/drain/enabled");
+BENCHMARK(publish)
+    ->Name("latency_probe/publish")
+    ->Unit(benchmark::kMicrosecond);
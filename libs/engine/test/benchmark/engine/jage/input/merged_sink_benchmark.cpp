@@ -0,0 +1,134 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/window_id.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <variant>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using ring_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 4096UZ>;
+using jage::engine::input::window_id;
+namespace mouse = jage::engine::input::mouse;
+
+constexpr auto window_count = 4UZ;
+constexpr auto event_count = 2048UZ;
+
+// The same traffic twice: once in a single ring with each event tagged by
+// window, once split into a ring per window. Windows are picked at random so
+// the per-window rings interleave unevenly.
+struct traffic {
+  std::unique_ptr<ring_type> merged = std::make_unique<ring_type>();
+  std::array<std::unique_ptr<ring_type>, window_count> windows{
+      std::make_unique<ring_type>(), std::make_unique<ring_type>(),
+      std::make_unique<ring_type>(), std::make_unique<ring_type>()};
+
+  traffic() {
+    auto generator = std::mt19937{42U};
+    auto pick =
+        std::uniform_int_distribution<std::size_t>{0UZ, window_count - 1UZ};
+    for (auto index = 0UZ; index < event_count; ++index) {
+      const auto window = pick(generator);
+      const auto input_event = event_type{
+          .timestamp = duration_type{static_cast<double>(index)},
+          .payload =
+              mouse::events::cursor::motion{
+                  .delta_x = static_cast<double>(index % 7UZ),
+                  .delta_y = 1.0},
+          .window = static_cast<window_id>(window),
+      };
+      merged->push(input_event);
+      windows[window]->push(input_event);
+    }
+  }
+};
+
+auto consume(const event_type &input_event, double &total) -> void {
+  total += std::get<mouse::events::cursor::motion>(input_event.payload).delta_x;
+}
+
+auto drain_merged_ring(benchmark::State &state) -> void {
+  const auto rings = traffic{};
+  for (auto _ : state) {
+    auto total = 0.0;
+    for (auto index = 0UZ; index < rings.merged->write_head(); ++index) {
+      consume(rings.merged->read(index % ring_type::capacity()), total);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(event_count));
+}
+
+// A consumer that only wants one window still reads the whole ring and
+// compares a byte per event.
+auto drain_merged_ring_for_one_window(benchmark::State &state) -> void {
+  const auto rings = traffic{};
+  for (auto _ : state) {
+    auto total = 0.0;
+    for (auto index = 0UZ; index < rings.merged->write_head(); ++index) {
+      const auto input_event =
+          rings.merged->read(index % ring_type::capacity());
+      if (window_id{2U} == input_event.window) {
+        consume(input_event, total);
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+}
+
+// Per-window rings merged back into timestamp order by picking the oldest
+// head among the rings for every event.
+auto drain_window_rings_with_merge(benchmark::State &state) -> void {
+  const auto rings = traffic{};
+  for (auto _ : state) {
+    auto total = 0.0;
+    auto read_indices = std::array<std::size_t, window_count>{};
+    auto heads = std::array<event_type, window_count>{};
+    for (auto window = 0UZ; window < window_count; ++window) {
+      if (0UZ < rings.windows[window]->write_head()) {
+        heads[window] = rings.windows[window]->read(0UZ);
+      }
+    }
+    for (auto remaining = event_count; remaining > 0UZ; --remaining) {
+      auto oldest = window_count;
+      for (auto window = 0UZ; window < window_count; ++window) {
+        if (read_indices[window] < rings.windows[window]->write_head() and
+            (window_count == oldest or
+             heads[window].timestamp < heads[oldest].timestamp)) {
+          oldest = window;
+        }
+      }
+      consume(heads[oldest], total);
+      const auto next = ++read_indices[oldest];
+      if (next < rings.windows[oldest]->write_head()) {
+        heads[oldest] =
+            rings.windows[oldest]->read(next % ring_type::capacity());
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) *
+                          static_cast<std::int64_t>(event_count));
+}
+} // namespace
+
+BENCHMARK(drain_merged_ring)
+    ->Name("merged_sink/drain/merged_ring")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(drain_merged_ring_for_one_window)
+    ->Name("merged_sink/drain/merged_ring_one_window")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(drain_window_rings_with_merge)
+    ->Name("merged_sink/drain/window_rings_k_way_merge")
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,114 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/recorder.hpp>
+#include <jage/engine/test/fakes/input/recording/writer.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/snapshot_cache.hpp>
+
+#include <jage/engine/input/internal/recorder.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <memory>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using motion_type = jage::engine::input::mouse::events::cursor::motion;
+using ring_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 4096UZ>;
+using cache_type = jage::engine::time::snapshot_cache<8UZ, duration_type>;
+
+// One producer iteration: a frame's worth of high-rate mouse reports.
+constexpr auto events_per_frame = 64UZ;
+
+auto make_event(const std::size_t index) -> event_type {
+  return {
+      .timestamp = duration_type{static_cast<double>(index)},
+      .payload = motion_type{.delta_x = 1.0, .delta_y = -1.0},
+  };
+}
+
+struct null_writer {
+  std::size_t bytes{};
+
+  auto write(const std::span<const std::byte> block) -> void {
+    bytes += std::size(block);
+    benchmark::DoNotOptimize(std::data(block));
+  }
+};
+
+auto recording_path() -> std::filesystem::path {
+  return std::filesystem::temp_directory_path() / "jage_recorder_benchmark.bin";
+}
+
+template <class TWriter>
+auto record(benchmark::State &state, auto &&...writer_arguments) -> void {
+  auto ring = std::make_unique<ring_type>();
+  auto cache = std::make_unique<cache_type>();
+  auto recorder = jage::engine::input::internal::recorder<ring_type,
+                                                           cache_type, TWriter>{
+      *ring, *cache, writer_arguments...};
+  auto index = 0UZ;
+  for (auto _ : state) {
+    for (auto offset = 0UZ; offset < events_per_frame; ++offset) {
+      ring->push(make_event(index++));
+    }
+    benchmark::DoNotOptimize(recorder.poll());
+  }
+  recorder.flush();
+  state.SetItemsProcessed(state.iterations() * events_per_frame);
+  state.counters["dropped"] = static_cast<double>(recorder.dropped_events());
+}
+
+auto record_to_memory(benchmark::State &state) -> void {
+  record<null_writer>(state);
+}
+
+auto record_to_file(benchmark::State &state) -> void {
+  record<jage::engine::input::recording_file>(state, recording_path());
+  std::filesystem::remove(recording_path());
+}
+
+auto produce_without_recorder(benchmark::State &state) -> void {
+  auto ring = std::make_unique<ring_type>();
+  auto index = 0UZ;
+  for (auto _ : state) {
+    for (auto offset = 0UZ; offset < events_per_frame; ++offset) {
+      ring->push(make_event(index++));
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * events_per_frame);
+}
+
+auto produce_with_recorder_thread(benchmark::State &state) -> void {
+  auto ring = std::make_unique<ring_type>();
+  auto cache = std::make_unique<cache_type>();
+  auto recorder = std::make_unique<
+      jage::engine::input::recorder<ring_type, cache_type>>(*ring, *cache,
+                                                            recording_path());
+  recorder->start();
+  auto index = 0UZ;
+  for (auto _ : state) {
+    for (auto offset = 0UZ; offset < events_per_frame; ++offset) {
+      ring->push(make_event(index++));
+    }
+    benchmark::ClobberMemory();
+  }
+  recorder->stop();
+  state.SetItemsProcessed(state.iterations() * events_per_frame);
+  state.counters["recorded"] =
+      static_cast<double>(recorder->recorded_events());
+  state.counters["dropped"] = static_cast<double>(recorder->dropped_events());
+  recorder.reset();
+  std::filesystem::remove(recording_path());
+}
+} // namespace
+
+BENCHMARK(record_to_memory)->Name("recorder/drain/memory");
+BENCHMARK(record_to_file)->Name("recorder/drain/file");
+BENCHMARK(produce_without_recorder)->Name("recorder/produce/detached");
+BENCHMARK(produce_with_recorder_thread)->Name("recorder/produce/recording");
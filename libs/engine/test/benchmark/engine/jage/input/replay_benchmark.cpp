@@ -0,0 +1,124 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/contexts/coalescing.hpp>
+#include <jage/engine/input/contexts/glfw.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/platforms/replay.hpp>
+#include <jage/engine/input/recorder.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/snapshot_cache.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <memory>
+#include <variant>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using motion_type = jage::engine::input::mouse::events::cursor::motion;
+using ring_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 4096UZ>;
+using cache_type = jage::engine::time::snapshot_cache<8UZ, duration_type>;
+using replay_type = jage::engine::input::platforms::replay<duration_type>;
+
+constexpr auto recorded_events = 1UZ << 20UZ;
+
+auto recording_path() -> std::filesystem::path {
+  return std::filesystem::temp_directory_path() / "jage_replay_benchmark.bin";
+}
+
+// Mouse motion with a key press or click every 8th report, so both the
+// coalesced and the pass-through paths of the context are exercised.
+auto make_event(const std::size_t index) -> event_type {
+  const auto timestamp = duration_type{static_cast<double>(index) * 125'000.0};
+  switch (index % 16UZ) {
+  case 7UZ:
+    return {.timestamp = timestamp,
+            .payload = jage::engine::input::keyboard::events::key_press{}};
+  case 15UZ:
+    return {.timestamp = timestamp,
+            .payload = jage::engine::input::mouse::events::click{}};
+  default:
+    return {.timestamp = timestamp,
+            .payload = motion_type{.delta_x = 1.0, .delta_y = -1.0}};
+  }
+}
+
+auto write_recording() -> void {
+  auto ring = std::make_unique<ring_type>();
+  auto cache = std::make_unique<cache_type>();
+  auto recorder = jage::engine::input::recorder<ring_type, cache_type>{
+      *ring, *cache, recording_path()};
+  for (auto index = 0UZ; index < recorded_events; ++index) {
+    ring->push(make_event(index));
+    if (0UZ == (index + 1UZ) % 1024UZ) {
+      recorder.poll();
+    }
+  }
+  recorder.poll();
+}
+
+struct counting_sink {
+  std::size_t events{};
+  auto push(const event_type &input_event) -> void {
+    ++events;
+    benchmark::DoNotOptimize(input_event);
+  }
+  auto push(event_type &&input_event) -> void { push(input_event); }
+};
+
+auto replay_into_sink(benchmark::State &state) -> void {
+  write_recording();
+  auto subject = replay_type{recording_path()};
+  auto sink = counting_sink{};
+  for (auto _ : state) {
+    subject.rewind();
+    benchmark::DoNotOptimize(subject.replay_all(sink));
+  }
+  state.SetItemsProcessed(state.iterations() * recorded_events);
+  state.counters["file_bytes"] =
+      static_cast<double>(std::filesystem::file_size(recording_path()));
+  std::filesystem::remove(recording_path());
+}
+
+// The whole input path: replay -> context (coalescing) -> ring -> a
+// consumer draining the ring every 64 replayed events.
+auto replay_through_pipeline(benchmark::State &state) -> void {
+  write_recording();
+  auto subject = replay_type{recording_path()};
+  auto ring = std::make_unique<ring_type>();
+  auto context =
+      jage::engine::input::contexts::glfw<duration_type, ring_type>{*ring};
+  auto read_head = 0UZ;
+  auto consumed = 0UZ;
+  auto frame_time = duration_type{};
+  for (auto _ : state) {
+    subject.rewind();
+    frame_time = duration_type{};
+    while (not subject.is_finished()) {
+      frame_time += duration_type{64.0 * 125'000.0};
+      subject.replay_until(context, frame_time);
+      context.flush();
+      for (const auto write_head = ring->write_head(); read_head < write_head;
+           ++read_head) {
+        const auto input_event = ring->read(read_head % ring->capacity());
+        consumed += input_event.payload.index();
+      }
+    }
+  }
+  benchmark::DoNotOptimize(consumed);
+  state.SetItemsProcessed(state.iterations() * recorded_events);
+  std::filesystem::remove(recording_path());
+}
+} // namespace
+
+BENCHMARK(replay_into_sink)
+    ->Name("replay/all/sink")
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(replay_through_pipeline)
+    ->Name("replay/all/context_ring_consumer")
+    ->Unit(benchmark::kMillisecond);
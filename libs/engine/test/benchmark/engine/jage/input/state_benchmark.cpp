@@ -0,0 +1,127 @@
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/state.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/stdx/overloaded.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <random>
+#include <variant>
+#include <vector>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using jage::engine::input::keyboard::scancode;
+namespace keyboard = jage::engine::input::keyboard;
+
+constexpr auto events_per_frame = 64UZ;
+constexpr auto queries_per_frame = 10'000UZ;
+
+// Letters and digits, the keys gameplay code usually asks about.
+constexpr auto queried_scancodes = [] {
+  auto scancodes = std::array<scancode, 36UZ>{};
+  for (auto index = 0UZ; index < std::size(scancodes); ++index) {
+    scancodes[index] = static_cast<scancode>(0x04UZ + index);
+  }
+  return scancodes;
+}();
+
+auto make_frame() -> std::vector<event_type> {
+  auto generator = std::mt19937{42U};
+  auto pick = std::uniform_int_distribution<std::size_t>{
+      0UZ, std::size(queried_scancodes) - 1UZ};
+  auto frame = std::vector<event_type>{};
+  for (auto index = 0UZ; index < events_per_frame; ++index) {
+    if (index % 2UZ == 0UZ) {
+      frame.push_back({
+          .timestamp = duration_type{static_cast<double>(index)},
+          .payload =
+              keyboard::events::key_press{
+                  .key = keyboard::key::unidentified,
+                  .scancode = queried_scancodes[pick(generator)],
+                  .action = index % 4UZ == 0UZ ? keyboard::action::press
+                                               : keyboard::action::release,
+                  .modifiers = {},
+              },
+      });
+    } else {
+      frame.push_back({
+          .timestamp = duration_type{static_cast<double>(index)},
+          .payload = jage::engine::input::mouse::events::cursor::motion{
+              .delta_x = 1.0, .delta_y = 1.0},
+      });
+    }
+  }
+  return frame;
+}
+
+auto make_queries() -> std::vector<scancode> {
+  auto generator = std::mt19937{7U};
+  auto pick = std::uniform_int_distribution<std::size_t>{
+      0UZ, std::size(queried_scancodes) - 1UZ};
+  auto queries = std::vector<scancode>(queries_per_frame);
+  for (auto &query : queries) {
+    query = queried_scancodes[pick(generator)];
+  }
+  return queries;
+}
+
+auto query_state(benchmark::State &state) -> void {
+  const auto frame = make_frame();
+  const auto queries = make_queries();
+  auto input_state = jage::engine::input::state<duration_type>{};
+  for (auto _ : state) {
+    for (const auto &input_event : frame) {
+      input_state.apply(input_event);
+    }
+    input_state.publish();
+    const auto &published = input_state.current();
+    auto held = 0UZ;
+    for (const auto query : queries) {
+      held += published.is_down(query) ? 1UZ : 0UZ;
+    }
+    benchmark::DoNotOptimize(held);
+  }
+  state.SetItemsProcessed(state.iterations() * queries_per_frame);
+}
+
+// What consumers do without a state registry: every question walks the
+// frame's events and visits each payload.
+auto scan_events(benchmark::State &state) -> void {
+  const auto frame = make_frame();
+  const auto queries = make_queries();
+  auto held_before_frame = std::array<bool, keyboard::scancode_count>{};
+  for (auto _ : state) {
+    auto held = 0UZ;
+    for (const auto query : queries) {
+      auto is_down = held_before_frame[static_cast<std::size_t>(query)];
+      for (const auto &input_event : frame) {
+        std::visit(jage::stdx::overloaded{
+                       [&](const keyboard::events::key_press &key_press) {
+                         if (key_press.scancode == query) {
+                           is_down =
+                               keyboard::action::release != key_press.action;
+                         }
+                       },
+                       [](const auto &) {},
+                   },
+                   input_event.payload);
+      }
+      held += is_down ? 1UZ : 0UZ;
+    }
+    benchmark::DoNotOptimize(held);
+  }
+  state.SetItemsProcessed(state.iterations() * queries_per_frame);
+}
+} // namespace
+
+BENCHMARK(query_state)->Name("input_state/10k_queries/state");
+BENCHMARK(scan_events)->Name("input_state/10k_queries/event_scan");
@@ -0,0 +1,131 @@
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/event_formatters.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/logging/file_sink.hpp>
+#include <jage/engine/logging/logger.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fmt/format.h>
+#include <fstream>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+namespace keyboard = jage::engine::input::keyboard;
+namespace mouse = jage::engine::input::mouse;
+using jage::engine::logging::file_sink;
+using logger_type = jage::engine::logging::logger<4096UZ>;
+
+constexpr auto events_per_frame = 256UZ;
+constexpr auto frame_count = 2'000;
+// Stands in for the rest of the frame, when the logger's thread gets to run.
+constexpr auto frame_gap = std::chrono::milliseconds{1};
+const auto null_device = std::filesystem::path{"/dev/null"};
+
+auto make_event(const std::size_t index) -> event_type {
+  const auto timestamp = duration_type{1.7e18 + static_cast<double>(index)};
+  if (0UZ == index % 2UZ) {
+    return {.timestamp = timestamp,
+            .payload = mouse::events::cursor::motion{
+                .delta_x = static_cast<double>(index % 7UZ),
+                .delta_y = 1.0}};
+  }
+  return {.timestamp = timestamp,
+          .payload = keyboard::events::key_press{
+              .key = keyboard::key::w,
+              .scancode = keyboard::scancode::w,
+              .action = keyboard::action::press,
+              .modifiers = {},
+          }};
+}
+
+auto report_frames(benchmark::State &state, std::vector<double> &frame_times)
+    -> void {
+  std::ranges::sort(frame_times);
+  const auto percentile = [&](const double rank) -> double {
+    const auto index = static_cast<std::size_t>(
+        rank * static_cast<double>(std::size(frame_times) - 1UZ));
+    return frame_times[index] / 1'000.0;
+  };
+  state.counters["frame_p50_us"] = percentile(0.50);
+  state.counters["frame_p99_us"] = percentile(0.99);
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(events_per_frame));
+}
+
+// The formatter is polled outside the timed region, so every call measured
+// is a successful push.
+auto log_call(benchmark::State &state) -> void {
+  auto logger = logger_type{file_sink{null_device}};
+  auto index = 0UZ;
+  for (auto _ : state) {
+    logger.log("{}\n", make_event(index++));
+    if (0UZ == index % 1024UZ) {
+      state.PauseTiming();
+      logger.poll();
+      state.ResumeTiming();
+    }
+  }
+  state.counters["dropped"] = static_cast<double>(logger.dropped_messages());
+}
+
+// The demo's old path: format on the frame and write with std::endl.
+auto frame_stream_endl(benchmark::State &state) -> void {
+  auto out = std::ofstream{null_device};
+  auto frame_times = std::vector<double>{};
+  auto index = 0UZ;
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    for (auto event = 0UZ; event < events_per_frame; ++event) {
+      out << fmt::format("{}", make_event(index++)) << std::endl;
+    }
+    frame_times.push_back(std::chrono::duration<double, std::nano>(
+                              std::chrono::steady_clock::now() - start)
+                              .count());
+    std::this_thread::sleep_for(frame_gap);
+  }
+  report_frames(state, frame_times);
+}
+
+auto frame_logger(benchmark::State &state) -> void {
+  auto logger = logger_type{file_sink{null_device}};
+  logger.start();
+  auto frame_times = std::vector<double>{};
+  auto index = 0UZ;
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    for (auto event = 0UZ; event < events_per_frame; ++event) {
+      logger.log("{}\n", make_event(index++));
+    }
+    frame_times.push_back(std::chrono::duration<double, std::nano>(
+                              std::chrono::steady_clock::now() - start)
+                              .count());
+    std::this_thread::sleep_for(frame_gap);
+  }
+  logger.stop();
+  state.counters["dropped"] = static_cast<double>(logger.dropped_messages());
+  report_frames(state, frame_times);
+}
+} // namespace
+
+BENCHMARK(log_call)->Name("logger/log_call");
+BENCHMARK(frame_stream_endl)
+    ->Name("logger/frame_256_events/stream_endl")
+    ->Iterations(frame_count);
+BENCHMARK(frame_logger)
+    ->Name("logger/frame_256_events/logger")
+    ->Iterations(frame_count);
@@ -0,0 +1,72 @@
+#include <jage/engine/inplace_action.hpp>
+#include <jage/engine/scheduled_action.hpp>
+#include <jage/engine/scheduled_action_batch.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+constexpr auto frame_time = 16'666'667ns;
+
+auto wait_for(const std::size_t index) -> std::chrono::nanoseconds {
+  return frame_time * static_cast<std::int64_t>(index % 600UZ + 1UZ);
+}
+
+auto update_batch(benchmark::State &state) -> void {
+  auto fired = std::uint64_t{};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  auto batch = jage::engine::scheduled_action_batch<
+      jage::engine::inplace_action<>>{count};
+  for (auto index = 0UZ; index < count; ++index) {
+    batch.push_back(wait_for(index), [&fired] { ++fired; });
+  }
+  for (auto _ : state) {
+    batch.update(frame_time);
+    for (const auto index : batch.completed()) {
+      batch.reset(index, wait_for(index));
+    }
+    benchmark::DoNotOptimize(fired);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["fired_per_frame"] = benchmark::Counter(
+      static_cast<double>(fired), benchmark::Counter::kAvgIterations);
+}
+
+auto update_vector(benchmark::State &state) -> void {
+  auto fired = std::uint64_t{};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  auto actions = std::vector<
+      jage::engine::scheduled_action<jage::engine::inplace_action<>>>{};
+  actions.reserve(count);
+  for (auto index = 0UZ; index < count; ++index) {
+    actions.emplace_back(wait_for(index), [&fired] { ++fired; });
+  }
+  for (auto _ : state) {
+    for (auto index = 0UZ; index < count; ++index) {
+      auto &action = actions[index];
+      action.update(frame_time);
+      if (action.is_complete()) [[unlikely]] {
+        action.reset(wait_for(index));
+      }
+    }
+    benchmark::DoNotOptimize(fired);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["fired_per_frame"] = benchmark::Counter(
+      static_cast<double>(fired), benchmark::Counter::kAvgIterations);
+}
+} // namespace
+
+BENCHMARK(update_batch)
+    ->Name("scheduled_action_batch/update")
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(update_vector)
+    ->Name("scheduled_action_vector/update")
+    ->Arg(1 << 20)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,94 @@
+#include <jage/engine/inplace_action.hpp>
+#include <jage/engine/scheduled_action.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+struct counters {
+  std::uint64_t fired{};
+  double accumulated{};
+  std::uint32_t toggles{};
+};
+
+template <class TAction>
+auto make_mixed_actions(const std::size_t count, counters &sink)
+    -> std::vector<jage::engine::scheduled_action<TAction>> {
+  auto actions = std::vector<jage::engine::scheduled_action<TAction>>{};
+  actions.reserve(count);
+  for (auto index = 0UZ; index < count; ++index) {
+    const auto wait = std::chrono::nanoseconds{(index % 64UZ) + 1UZ};
+    switch (index % 4UZ) {
+    case 0UZ:
+      actions.emplace_back(wait, TAction{[&sink] { ++sink.fired; }});
+      break;
+    case 1UZ:
+      actions.emplace_back(wait, TAction{[&sink, scale = 0.5 * index] {
+                             sink.accumulated += scale;
+                           }});
+      break;
+    case 2UZ:
+      actions.emplace_back(wait, TAction{[&sink, mask = index & 0xFFU] {
+                             sink.toggles ^= static_cast<std::uint32_t>(mask);
+                           }});
+      break;
+    default:
+      actions.emplace_back(wait, TAction{[&sink, id = index, weight = 2.0] {
+                             sink.fired += id & 1U;
+                             sink.accumulated += weight;
+                           }});
+      break;
+    }
+  }
+  return actions;
+}
+
+template <class TAction> auto update_mixed_actions(benchmark::State &state) {
+  auto sink = counters{};
+  auto actions = make_mixed_actions<TAction>(
+      static_cast<std::size_t>(state.range(0)), sink);
+  for (auto _ : state) {
+    for (auto &action : actions) {
+      action.update(1ns);
+      if (action.is_complete()) [[unlikely]] {
+        action.reset(64ns);
+      }
+    }
+    benchmark::DoNotOptimize(sink);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["bytes_per_action"] = static_cast<double>(
+      sizeof(jage::engine::scheduled_action<TAction>));
+}
+
+template <class TAction> auto construct_mixed_actions(benchmark::State &state) {
+  auto sink = counters{};
+  for (auto _ : state) {
+    auto actions = make_mixed_actions<TAction>(
+        static_cast<std::size_t>(state.range(0)), sink);
+    benchmark::DoNotOptimize(std::data(actions));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(update_mixed_actions<jage::engine::inplace_action<>>)
+    ->Name("scheduled_action/update/inplace_action")
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK(update_mixed_actions<std::function<void()>>)
+    ->Name("scheduled_action/update/std_function")
+    ->RangeMultiplier(16)
+    ->Range(1 << 10, 1 << 18);
+BENCHMARK(construct_mixed_actions<jage::engine::inplace_action<>>)
+    ->Name("scheduled_action/construct/inplace_action")
+    ->Arg(1 << 12);
+BENCHMARK(construct_mixed_actions<std::function<void()>>)
+    ->Name("scheduled_action/construct/std_function")
+    ->Arg(1 << 12);
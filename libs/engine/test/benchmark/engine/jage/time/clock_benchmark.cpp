@@ -0,0 +1,38 @@
+#include <jage/engine/time/clock.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/hertz.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using jage::engine::time::operator""_Hz;
+
+auto shared_clock = jage::engine::time::clock<duration_type>{60_Hz};
+
+auto concurrent_snapshots(benchmark::State &state) -> void {
+  auto rescales = std::uint64_t{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(shared_clock.snapshot());
+    if (0 == state.thread_index() and state.range(0) > 0 and
+        0U == ++rescales % static_cast<std::uint64_t>(state.range(0)))
+        [[unlikely]] {
+      shared_clock.set_time_scale(0U == rescales % 2U ? 1.0 : 0.0);
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(concurrent_snapshots)
+    ->Name("clock/snapshot/no_rescale")
+    ->Arg(0)
+    ->Threads(1)
+    ->Threads(8);
+BENCHMARK(concurrent_snapshots)
+    ->Name("clock/snapshot/rescale_every_1024")
+    ->Arg(1024)
+    ->Threads(1)
+    ->Threads(8);
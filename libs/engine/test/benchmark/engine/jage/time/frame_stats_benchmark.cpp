@@ -0,0 +1,73 @@
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+#include <jage/engine/time/frame_stats.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+using duration_type = jage::engine::time::durations::nanoseconds;
+using snapshot_type = jage::engine::time::events::snapshot<duration_type>;
+using frame_stats_type =
+    jage::engine::time::frame_stats<1024UZ, duration_type>;
+
+auto make_jittery_snapshots(const std::size_t count)
+    -> std::vector<snapshot_type> {
+  auto generator = std::mt19937_64{42U};
+  auto frame_time = std::normal_distribution<double>{16.6, 1.5};
+  auto snapshots = std::vector<snapshot_type>(count);
+  auto real_time = duration_type{};
+  for (auto index = 0UZ; index < count; ++index) {
+    real_time += jage::engine::time::cast<duration_type>(
+        jage::engine::time::durations::milliseconds{
+            std::max(frame_time(generator), 0.1)});
+    snapshots[index] = snapshot_type{.real_time = real_time, .frame = index};
+  }
+  return snapshots;
+}
+
+auto push(benchmark::State &state) -> void {
+  const auto snapshots = make_jittery_snapshots(1UZ << 16U);
+  auto stats = frame_stats_type{};
+  auto index = 0UZ;
+  for (auto _ : state) {
+    stats.push(snapshots[index++ % std::size(snapshots)]);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+auto push_and_publish(benchmark::State &state) -> void {
+  const auto snapshots = make_jittery_snapshots(1UZ << 16U);
+  auto stats = frame_stats_type{};
+  auto index = 0UZ;
+  for (auto _ : state) {
+    stats.push(snapshots[index++ % std::size(snapshots)]);
+    stats.publish();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+auto read(benchmark::State &state) -> void {
+  const auto snapshots =
+      make_jittery_snapshots(frame_stats_type::window_size());
+  auto stats = frame_stats_type{};
+  for (const auto &snapshot : snapshots) {
+    stats.push(snapshot);
+  }
+  stats.publish();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(stats.read());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+} // namespace
+
+BENCHMARK(push)->Name("frame_stats/push");
+BENCHMARK(push_and_publish)->Name("frame_stats/push_and_publish");
+BENCHMARK(read)->Name("frame_stats/read");
@@ -0,0 +1,55 @@
+#include <jage/engine/time/clock.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/hertz.hpp>
+#include <jage/engine/time/multi_rate_clock.hpp>
+#include <jage/engine/time/snapshot_cache.hpp>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using jage::engine::time::operator""_Hz;
+
+auto single_rate_snapshot(benchmark::State &state) -> void {
+  const auto clock = jage::engine::time::clock<duration_type>{60_Hz};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(clock.snapshot());
+  }
+}
+
+auto three_clocks_snapshot(benchmark::State &state) -> void {
+  const auto physics = jage::engine::time::clock<duration_type>{120_Hz};
+  const auto gameplay = jage::engine::time::clock<duration_type>{60_Hz};
+  const auto ai = jage::engine::time::clock<duration_type>{10_Hz};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(physics.snapshot());
+    benchmark::DoNotOptimize(gameplay.snapshot());
+    benchmark::DoNotOptimize(ai.snapshot());
+  }
+}
+
+auto multi_rate_snapshot(benchmark::State &state) -> void {
+  const auto clock =
+      jage::engine::time::multi_rate_clock<duration_type, 120U, 60U, 10U>{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(clock.snapshot());
+  }
+}
+
+auto multi_rate_push(benchmark::State &state) -> void {
+  const auto clock =
+      jage::engine::time::multi_rate_clock<duration_type, 120U, 60U, 10U>{};
+  auto physics = jage::engine::time::snapshot_cache<8UZ, duration_type>{};
+  auto gameplay = jage::engine::time::snapshot_cache<8UZ, duration_type>{};
+  auto ai = jage::engine::time::snapshot_cache<8UZ, duration_type>{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(clock.push(physics, gameplay, ai));
+  }
+}
+} // namespace
+
+BENCHMARK(single_rate_snapshot)->Name("multi_rate_clock/clock_snapshot");
+BENCHMARK(three_clocks_snapshot)
+    ->Name("multi_rate_clock/three_clocks_snapshot");
+BENCHMARK(multi_rate_snapshot)->Name("multi_rate_clock/snapshot");
+BENCHMARK(multi_rate_push)->Name("multi_rate_clock/push_three_caches");
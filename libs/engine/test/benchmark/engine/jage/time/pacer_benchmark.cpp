@@ -0,0 +1,81 @@
+#include <jage/engine/time/clock.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/hertz.hpp>
+#include <jage/engine/time/pacer.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <ctime>
+#include <vector>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using jage::engine::time::hertz;
+
+auto pace_frames(benchmark::State &state, const bool spin_only) -> void {
+  const auto cycles = hertz{state.range(0)};
+  const auto clock = jage::engine::time::clock<duration_type>{cycles};
+  const auto period = static_cast<duration_type>(cycles);
+  auto pacer = spin_only ? jage::engine::time::pacer<duration_type>{cycles,
+                                                                    period,
+                                                                    period}
+                         : jage::engine::time::pacer<duration_type>{cycles};
+
+  auto frame_errors = std::vector<double>{};
+  frame_errors.reserve(static_cast<std::size_t>(state.max_iterations));
+  auto last_frame_time = clock.real_time();
+  const auto cpu_start = std::clock();
+  const auto wall_start = last_frame_time;
+  std::ignore = pacer.wait(clock.snapshot());
+  for (auto _ : state) {
+    std::ignore = pacer.wait(clock.snapshot());
+    const auto frame_time = clock.real_time();
+    frame_errors.push_back(
+        std::abs((frame_time - last_frame_time - period).count()));
+    last_frame_time = frame_time;
+  }
+  const auto cpu_seconds =
+      static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+  const auto wall_seconds =
+      jage::engine::time::cast<jage::engine::time::seconds>(
+          clock.real_time() - wall_start)
+          .count();
+
+  std::ranges::sort(frame_errors);
+  const auto percentile = [&](const double rank) -> double {
+    const auto index = static_cast<std::size_t>(
+        rank * static_cast<double>(std::size(frame_errors) - 1UZ));
+    return frame_errors[index] / 1'000.0;
+  };
+  state.counters["cpu_usage_pct"] = 100.0 * cpu_seconds / wall_seconds;
+  state.counters["jitter_p50_us"] = percentile(0.50);
+  state.counters["jitter_p99_us"] = percentile(0.99);
+  state.counters["margin_us"] = pacer.margin().count() / 1'000.0;
+}
+
+auto hybrid_sleep_spin(benchmark::State &state) -> void {
+  pace_frames(state, false);
+}
+
+auto spin_only(benchmark::State &state) -> void { pace_frames(state, true); }
+} // namespace
+
+BENCHMARK(hybrid_sleep_spin)
+    ->Name("time/pacer/hybrid")
+    ->Arg(60)
+    ->Arg(144)
+    ->Arg(240)
+    ->Iterations(240)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(spin_only)
+    ->Name("time/pacer/spin")
+    ->Arg(60)
+    ->Arg(144)
+    ->Arg(240)
+    ->Iterations(240)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,99 @@
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+#include <jage/engine/time/snapshot_cache.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace {
+using duration_type = jage::engine::time::durations::nanoseconds;
+using snapshot_type = jage::engine::time::events::snapshot<duration_type>;
+using cache_type = jage::engine::time::snapshot_cache<16UZ, duration_type>;
+
+constexpr auto writer_period = std::chrono::nanoseconds{1'000'000'000 / 240};
+
+class writer_240hz {
+  cache_type &cache_;
+  std::jthread thread_;
+
+public:
+  explicit writer_240hz(cache_type &cache)
+      : cache_{cache}, thread_{[this](const std::stop_token &stop) {
+          auto deadline = std::chrono::steady_clock::now();
+          for (auto frame = std::uint64_t{}; not stop.stop_requested();
+               ++frame) {
+            cache_.push(snapshot_type{
+                .real_time = duration_type{static_cast<double>(
+                    std::chrono::steady_clock::now()
+                        .time_since_epoch()
+                        .count())},
+                .frame = frame,
+            });
+            deadline += writer_period;
+            std::this_thread::sleep_until(deadline);
+          }
+        }} {}
+};
+
+auto read_latest(benchmark::State &state) -> void {
+  auto cache = cache_type{};
+  const auto writer = writer_240hz{cache};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache.latest());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+auto find_newest_frame(benchmark::State &state) -> void {
+  auto cache = cache_type{};
+  const auto writer = writer_240hz{cache};
+  auto frame = std::uint64_t{};
+  for (auto _ : state) {
+    const auto [snapshot, status] = cache.find(frame);
+    benchmark::DoNotOptimize(snapshot);
+    frame = snapshot.frame + 1U;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+auto find_newest_timestamp(benchmark::State &state) -> void {
+  auto cache = cache_type{};
+  const auto writer = writer_240hz{cache};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache.find(duration_type{
+        static_cast<double>(std::chrono::steady_clock::now()
+                                .time_since_epoch()
+                                .count())}));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+auto wait_for_next_frame(benchmark::State &state) -> void {
+  auto cache = cache_type{};
+  const auto writer = writer_240hz{cache};
+  auto wake_latency = 0.0;
+  for (auto _ : state) {
+    const auto frame = cache.latest().frame + 1U;
+    const auto [snapshot, status] = cache.wait_for_frame(frame);
+    wake_latency +=
+        static_cast<double>(
+            std::chrono::steady_clock::now().time_since_epoch().count()) -
+        snapshot.real_time.count();
+  }
+  state.counters["wake_latency_us"] =
+      wake_latency / static_cast<double>(state.iterations()) / 1'000.0;
+}
+} // namespace
+
+BENCHMARK(read_latest)->Name("snapshot_cache/240hz_writer/latest");
+BENCHMARK(find_newest_frame)->Name("snapshot_cache/240hz_writer/find_frame");
+BENCHMARK(find_newest_timestamp)
+    ->Name("snapshot_cache/240hz_writer/find_timestamp");
+BENCHMARK(wait_for_next_frame)
+    ->Name("snapshot_cache/240hz_writer/wait_for_frame")
+    ->Iterations(240)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,32 @@
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/hertz.hpp>
+#include <jage/engine/time/snapshot_cache.hpp>
+#include <jage/engine/time/virtual_clock.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+using duration_type = jage::engine::time::nanoseconds;
+using jage::engine::time::hertz;
+
+auto simulate_frames(benchmark::State &state) -> void {
+  const auto cycles = hertz{state.range(0)};
+  auto clock = jage::engine::time::virtual_clock<duration_type>{cycles};
+  auto cache = jage::engine::time::snapshot_cache<16UZ, duration_type>{};
+  for (auto _ : state) {
+    clock.time_source().advance(clock.tick_duration());
+    cache.push(clock.snapshot());
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["simulated_frames_per_wall_second"] = benchmark::Counter(
+      static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+  state.counters["speedup_over_real_time"] = benchmark::Counter(
+      static_cast<double>(state.iterations()) /
+          static_cast<double>(state.range(0)),
+      benchmark::Counter::kIsRate);
+}
+} // namespace
+
+BENCHMARK(simulate_frames)->Name("virtual_clock/simulate")->Arg(60)->Arg(240);
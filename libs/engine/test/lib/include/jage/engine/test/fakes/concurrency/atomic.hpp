@@ -13,6 +13,10 @@ template <class TValue> struct atomic {
 
   auto store(TValue desired, std::memory_order) -> void { value = desired; }
 
+  auto wait(TValue, std::memory_order) const -> void {}
+
+  auto notify_all() -> void {}
+
   [[nodiscard]] auto compare_exchange_weak(TValue &expected, TValue desired,
                                            std::memory_order,
                                            std::memory_order) -> bool {
@@ -19,6 +19,9 @@ struct glfw<TDuration,
   using duration_type = TDuration;
   std::deque<event_type> buffer;
   std::pair<double, double> last_known_cursor_position_{};
+  duration_type current_time{};
+
+  [[nodiscard]] auto timestamp() const -> duration_type { return current_time; }
 
   [[nodiscard]] auto
   last_known_cursor_position() const -> const std::pair<double, double> & {
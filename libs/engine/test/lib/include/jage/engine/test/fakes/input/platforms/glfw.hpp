@@ -3,6 +3,7 @@
 #include <jage/engine/test/fakes/input/context/glfw.hpp>
 #include <jage/engine/time/durations.hpp>
 
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
@@ -31,7 +32,6 @@ template <class TContext> class glfw {
   mouse_button_callback_type_ mouse_button_callback_{nullptr};
   cursor_position_callback_type_ cursor_position_callback_{nullptr};
   scroll_callback_type_ scroll_callback_{nullptr};
-  time::seconds seconds_since_init_{0};
   bool initialized_{false};
   std::unordered_map<int, int> input_modes_;
 
@@ -60,7 +60,14 @@ public:
   using context_type = context_type_;
   using duration_type = time::seconds;
 
+  struct gamepad_state_type {
+    std::array<unsigned char, 15UZ> buttons{};
+    std::array<float, 6UZ> axes{};
+  };
+
   static std::unordered_map<int, int> key_to_scancode;
+  // Connected gamepads by joystick id.
+  static std::unordered_map<int, gamepad_state_type> gamepads;
 
   static auto set_window_user_pointer(window_handle_pointer_type,
                                       user_pointer_type user_pointer) -> void {
@@ -138,12 +145,14 @@ public:
     return -1;
   }
 
-  [[nodiscard]] static auto get_seconds_since_init() -> duration_type {
-    return get_instance().seconds_since_init_;
-  }
-
-  static auto set_seconds_since_init(const duration_type seconds) -> void {
-    get_instance().seconds_since_init_ = seconds;
+  [[nodiscard]] static auto get_gamepad_state(int jid,
+                                              gamepad_state_type &state)
+      -> bool {
+    if (const auto iter = gamepads.find(jid); iter != std::end(gamepads)) {
+      state = iter->second;
+      return true;
+    }
+    return false;
   }
 
   static auto initialize() -> void { get_instance().initialized_ = true; }
@@ -155,10 +164,14 @@ public:
   auto reset() -> void {
     instance_.reset();
     key_to_scancode.clear();
+    gamepads.clear();
   }
 };
 
 template <class T> std::unique_ptr<glfw<T>> glfw<T>::instance_ = nullptr;
 template <class T> std::unordered_map<int, int> glfw<T>::key_to_scancode = {};
+template <class T>
+std::unordered_map<int, typename glfw<T>::gamepad_state_type>
+    glfw<T>::gamepads = {};
 
 } // namespace jage::engine::test::fakes::input::platforms
\ No newline at end of file
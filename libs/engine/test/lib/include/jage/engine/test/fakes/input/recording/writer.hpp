@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace jage::engine::test::fakes::input::recording {
+struct writer {
+  std::vector<std::byte> bytes;
+  std::size_t writes{};
+
+  auto write(const std::span<const std::byte> block) -> void {
+    bytes.insert(std::end(bytes), std::begin(block), std::end(block));
+    ++writes;
+  }
+};
+} // namespace jage::engine::test::fakes::input::recording
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+
+namespace jage::engine::test::fakes::logging {
+struct writer {
+  std::string text;
+  std::size_t writes{};
+
+  auto write(const std::span<const std::byte> batch) -> void {
+    text.append(reinterpret_cast<const char *>(std::data(batch)),
+                std::size(batch));
+    ++writes;
+  }
+};
+} // namespace jage::engine::test::fakes::logging
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+
+namespace jage::engine::test::fakes::time {
+template <class TTimeSource> struct sleeper {
+  using duration = typename TTimeSource::duration;
+
+  static duration wake_up_lateness;
+  static duration relax_step;
+  static duration last_sleep_target;
+  static std::uint64_t sleep_count;
+  static std::uint64_t relax_count;
+
+  static auto sleep_until(const duration time_since_epoch) -> void {
+    ++sleep_count;
+    last_sleep_target = time_since_epoch;
+    TTimeSource::current_time = time_since_epoch + wake_up_lateness;
+  }
+
+  static auto relax() -> void {
+    ++relax_count;
+    TTimeSource::current_time += relax_step;
+  }
+
+  static auto reset() -> void {
+    wake_up_lateness = duration{};
+    relax_step = duration{};
+    last_sleep_target = duration{};
+    sleep_count = 0U;
+    relax_count = 0U;
+  }
+};
+
+template <class TTimeSource>
+typename TTimeSource::duration sleeper<TTimeSource>::wake_up_lateness{};
+template <class TTimeSource>
+typename TTimeSource::duration sleeper<TTimeSource>::relax_step{};
+template <class TTimeSource>
+typename TTimeSource::duration sleeper<TTimeSource>::last_sleep_target{};
+template <class TTimeSource> std::uint64_t sleeper<TTimeSource>::sleep_count{};
+template <class TTimeSource> std::uint64_t sleeper<TTimeSource>::relax_count{};
+
+} // namespace jage::engine::test::fakes::time
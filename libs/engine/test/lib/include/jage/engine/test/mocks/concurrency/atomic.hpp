@@ -18,6 +18,9 @@ template <class T> struct atomic {
 
   MOCK_METHOD(std::uint64_t, mock_load, (std::memory_order), (const noexcept));
   MOCK_METHOD(void, mock_store, (std::uint64_t, std::memory_order), (noexcept));
+  MOCK_METHOD(void, mock_wait, (std::uint64_t, std::memory_order),
+              (const noexcept));
+  MOCK_METHOD(void, mock_notify_all, (), (noexcept));
   MOCK_METHOD(bool, mock_compare_exchange_weak,
               (std::uint64_t &, std::uint64_t, std::memory_order,
                std::memory_order));
@@ -34,6 +37,15 @@ template <class T> struct atomic {
     get_instance()->mock_store(desired, order);
   }
 
+  static auto wait(std::uint64_t old, std::memory_order order) noexcept
+      -> void {
+    get_instance()->mock_wait(old, order);
+  }
+
+  static auto notify_all() noexcept -> void {
+    get_instance()->mock_notify_all();
+  }
+
   [[nodiscard]] static auto
   compare_exchange_weak(std::uint64_t &expected, std::uint64_t desired,
                         std::memory_order success,
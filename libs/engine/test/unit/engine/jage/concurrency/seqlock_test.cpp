@@ -0,0 +1,84 @@
+#include <jage/engine/concurrency/seqlock.hpp>
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/encoded_event.hpp>
+#include <jage/engine/memory/cacheline_size.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using jage::engine::concurrency::seqlock;
+using jage::engine::input::encoded_event;
+using jage::engine::memory::cacheline_size;
+
+namespace {
+struct quad {
+  std::uint64_t first{};
+  std::uint64_t second{};
+  std::uint64_t third{};
+  std::uint64_t fourth{};
+};
+} // namespace
+
+TEST(concurrency_seqlock, Fit_more_than_one_slot_in_a_cache_line) {
+  static_assert(sizeof(seqlock<encoded_event>) < cacheline_size);
+  static_assert(
+      sizeof(jage::engine::containers::spmc::packed_ring_buffer<encoded_event,
+                                                                4096UZ>) <
+      sizeof(jage::engine::containers::spmc::ring_buffer<encoded_event,
+                                                         4096UZ>) /
+          4UZ);
+}
+
+TEST(concurrency_seqlock, Read_value_initialized_value_before_first_write) {
+  const auto slot = seqlock<quad>{};
+  const auto value = slot.read();
+  EXPECT_EQ(0U, value.first);
+  EXPECT_EQ(0U, value.fourth);
+}
+
+TEST(concurrency_seqlock, Read_last_written_value) {
+  auto slot = seqlock<quad>{};
+  slot.write({1U, 2U, 3U, 4U});
+  slot.write({5U, 6U, 7U, 8U});
+  const auto value = slot.read();
+  EXPECT_EQ(5U, value.first);
+  EXPECT_EQ(6U, value.second);
+  EXPECT_EQ(7U, value.third);
+  EXPECT_EQ(8U, value.fourth);
+}
+
+TEST(concurrency_seqlock, Never_return_a_torn_value_to_concurrent_readers) {
+  static constexpr auto write_count = 200'000U;
+  auto slot = seqlock<quad>{};
+  auto done = std::atomic<bool>{false};
+  auto torn_reads = std::atomic<std::uint64_t>{0U};
+  auto reader = std::jthread{[&] {
+    while (not done.load(std::memory_order::acquire)) {
+      const auto value = slot.read();
+      if (value.first != value.second or value.first != value.third or
+          value.first != value.fourth) [[unlikely]] {
+        torn_reads.fetch_add(1U, std::memory_order::relaxed);
+      }
+    }
+  }};
+  for (auto write = 1U; write <= write_count; ++write) {
+    slot.write({write, write, write, write});
+  }
+  done.store(true, std::memory_order::release);
+  reader.join();
+  EXPECT_EQ(0U, torn_reads.load());
+  EXPECT_EQ(write_count, slot.read().first);
+}
+
+TEST(packed_ring_buffer, Store_encoded_events_natively) {
+  auto buffer =
+      jage::engine::containers::spmc::packed_ring_buffer<encoded_event, 4UZ>{};
+  buffer.push(encoded_event{.type = 2U, .timestamp = 42, .x = 1.5});
+  ASSERT_EQ(1UZ, buffer.write_head());
+  EXPECT_EQ((encoded_event{.type = 2U, .timestamp = 42, .x = 1.5}),
+            buffer.read(0UZ));
+}
@@ -12,6 +12,7 @@
 #include <cstdint>
 #include <exception>
 #include <utility>
+#include <variant>
 
 using jage::engine::containers::spmc::internal::ring_buffer;
 
@@ -28,6 +29,11 @@ struct foo {
   std::uint32_t value;
 };
 
+struct tagged_foo {
+  std::uint32_t timestamp;
+  std::variant<std::uint32_t, float, double> payload;
+};
+
 using testing::Return;
 
 TEST(spmc_internal_ring_buffer, Provide_capacity_access) {
@@ -108,6 +114,24 @@ TEST(spmc_internal_ring_buffer, Push_atomically) {
   mocks::atomic<std::size_t>::instance.reset();
 }
 
+TEST(spmc_internal_ring_buffer, Tag_slots_with_payload_index) {
+  auto buffer =
+      ring_buffer<tagged_foo, 2, fakes::atomic, fakes::double_buffer>{};
+  buffer.push(tagged_foo{.timestamp = 1U, .payload = 2.0});
+  buffer.push(tagged_foo{.timestamp = 2U, .payload = 1.0F});
+  EXPECT_EQ(2U, buffer.tag(0));
+  EXPECT_EQ(1U, buffer.tag(1));
+  buffer.push(tagged_foo{.timestamp = 3U, .payload = 7U});
+  EXPECT_EQ(0U, buffer.tag(0));
+}
+
+TEST(spmc_internal_ring_buffer, Tag_only_events_with_variant_payload) {
+  static_assert(not jage::engine::containers::spmc::internal::concepts::
+                    tagged_event<foo>);
+  static_assert(jage::engine::containers::spmc::internal::concepts::
+                    tagged_event<tagged_foo>);
+}
+
 #if defined(JAGE_ENABLE_SANITY_CHECKS) and JAGE_ENABLE_SANITY_CHECKS == 1
 TEST(spmc_internal_ring_buffer,
      Throw_exception_if_read_attempts_to_read_an_out_of_bounds_index) {
@@ -300,3 +300,19 @@ TEST(queue_roll_over_corner_cases, Compare_and_swap_loop_edge_cases) {
   jage::engine::test::mocks::concurrency::atomic<std::uint64_t>::instance
       .reset();
 }
+
+TEST(queue_try_push, Refuse_events_once_full) {
+  auto sut = queue<foo, 2UZ>{};
+
+  EXPECT_TRUE(sut.try_push(foo{.value = 1}));
+  EXPECT_TRUE(sut.try_push(foo{.value = 2}));
+  EXPECT_FALSE(sut.try_push(foo{.value = 3}));
+
+  EXPECT_EQ(2UZ, std::size(sut));
+  EXPECT_EQ(1, sut.front().value);
+  sut.pop();
+  EXPECT_TRUE(sut.try_push(foo{.value = 4}));
+  EXPECT_EQ(2, sut.front().value);
+  sut.pop();
+  EXPECT_EQ(4, sut.front().value);
+}
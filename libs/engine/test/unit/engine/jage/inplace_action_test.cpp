@@ -0,0 +1,163 @@
+#include <jage/engine/inplace_action.hpp>
+#include <jage/engine/scheduled_action.hpp>
+#include <jage/engine/scheduled_action_status.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace std::chrono_literals;
+using jage::engine::inplace_action;
+using jage::engine::scheduled_action;
+
+TEST(inplace_action_layout, Add_only_a_single_pointer_of_overhead) {
+  static_assert(sizeof(inplace_action<>) ==
+                jage::engine::inplace_action_default_capacity + sizeof(void *));
+}
+
+TEST(inplace_action_layout, Pack_scheduled_actions_contiguously) {
+  static_assert(sizeof(scheduled_action<inplace_action<>>) ==
+                sizeof(std::chrono::nanoseconds) + sizeof(void *) +
+                    sizeof(inplace_action<>));
+}
+
+TEST(inplace_action_layout, Report_capacity_used_to_instantiate_template) {
+  static_assert(16UZ == inplace_action<16UZ>::capacity());
+}
+
+TEST(inplace_action, Be_empty_on_default_construction) {
+  const auto action = inplace_action<>{};
+  EXPECT_FALSE(action);
+}
+
+TEST(inplace_action, Do_nothing_when_invoked_while_empty) {
+  auto action = inplace_action<>{};
+  action();
+  EXPECT_FALSE(action);
+}
+
+TEST(inplace_action, Invoke_stored_callable) {
+  auto value = 0;
+  auto action = inplace_action<>{[&] { value = 42; }};
+  EXPECT_TRUE(action);
+  action();
+  EXPECT_EQ(42, value);
+}
+
+TEST(inplace_action, Preserve_state_of_mutable_callable_between_calls) {
+  auto value = 0;
+  auto action =
+      inplace_action<>{[&, count = 0]() mutable { value = ++count; }};
+  action();
+  action();
+  EXPECT_EQ(2, value);
+}
+
+TEST(inplace_action, Store_callable_that_fills_capacity) {
+  auto sum = 0;
+  const auto values = std::array<int, 8>{1, 2, 3, 4, 5, 6, 7, 8};
+  auto action = inplace_action<sizeof(values) + sizeof(&sum)>{
+      [&sum, values] {
+        for (const auto value : values) {
+          sum += value;
+        }
+      }};
+  action();
+  EXPECT_EQ(36, sum);
+}
+
+TEST(inplace_action, Invoke_copy_independently_of_original) {
+  auto value = 0;
+  auto original = inplace_action<>{[&, count = 0]() mutable {
+    value = ++count;
+  }};
+  original();
+  auto copy = original;
+  copy();
+  EXPECT_EQ(2, value);
+  original();
+  EXPECT_EQ(2, value);
+}
+
+TEST(inplace_action, Be_empty_after_being_moved_from) {
+  auto value = 0;
+  auto original = inplace_action<>{[&] { value = 42; }};
+  auto moved = std::move(original);
+  EXPECT_FALSE(original); // NOLINT(bugprone-use-after-move)
+  moved();
+  EXPECT_EQ(42, value);
+}
+
+TEST(inplace_action, Replace_callable_on_assignment) {
+  auto value = 0;
+  auto action = inplace_action<>{[&] { value = 1; }};
+  action = inplace_action<>{[&] { value = 2; }};
+  action();
+  EXPECT_EQ(2, value);
+}
+
+TEST(inplace_action, Replace_callable_on_copy_assignment) {
+  auto value = 0;
+  auto action = inplace_action<>{[&] { value = 1; }};
+  const auto other = inplace_action<>{[&] { value = 2; }};
+  action = other;
+  action();
+  EXPECT_EQ(2, value);
+}
+
+TEST(inplace_action, Destroy_stored_callable_exactly_once) {
+  auto tracker = std::make_shared<int>(0);
+  {
+    auto action = inplace_action<>{[tracker] { ++*tracker; }};
+    auto copy = action;
+    auto moved = std::move(action);
+    EXPECT_EQ(3, tracker.use_count());
+    moved();
+    copy();
+  }
+  EXPECT_EQ(1, tracker.use_count());
+  EXPECT_EQ(2, *tracker);
+}
+
+TEST(inplace_action, Destroy_replaced_callable_on_assignment) {
+  auto tracker = std::make_shared<int>(0);
+  auto action = inplace_action<>{[tracker] {}};
+  EXPECT_EQ(2, tracker.use_count());
+  action = inplace_action<>{};
+  EXPECT_EQ(1, tracker.use_count());
+}
+
+TEST(scheduled_inplace_action, Execute_action_after_time_expires) {
+  auto value = std::uint8_t{0};
+  auto action = scheduled_action<inplace_action<>>{10ns, [&] { value = 42; }};
+  action.update(9ns);
+  EXPECT_EQ(0, value);
+  action.update(1ns);
+  EXPECT_EQ(42, value);
+  EXPECT_EQ(jage::engine::scheduled_action_status::complete, action.status());
+}
+
+TEST(scheduled_inplace_action,
+     Store_heterogeneous_actions_in_a_single_container) {
+  auto first = 0;
+  auto second = 0.0;
+  auto actions = std::vector<scheduled_action<inplace_action<>>>{};
+  actions.emplace_back(1ns, [&] { first = 1; });
+  actions.emplace_back(2ns, [&, offset = 0.5] { second = offset; });
+
+  for (auto &action : actions) {
+    action.update(1ns);
+  }
+  EXPECT_EQ(1, first);
+  EXPECT_EQ(0.0, second);
+
+  for (auto &action : actions) {
+    action.update(1ns);
+  }
+  EXPECT_EQ(0.5, second);
+}
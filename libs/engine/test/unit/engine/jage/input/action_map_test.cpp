@@ -0,0 +1,212 @@
+#include <jage/engine/input/action_map.hpp>
+#include <jage/engine/input/binding.hpp>
+#include <jage/engine/input/chord.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/modifier.hpp>
+#include <jage/engine/input/mouse/action.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+using jage::engine::input::chord;
+using jage::engine::input::modifier;
+using jage::engine::input::modifier_count;
+using jage::engine::input::keyboard::key;
+using jage::engine::input::keyboard::scancode;
+using jage::engine::input::keyboard::events::key_press;
+using jage::engine::input::mouse::button;
+using jage::engine::input::mouse::events::click;
+namespace keyboard = jage::engine::input::keyboard;
+namespace mouse = jage::engine::input::mouse;
+
+namespace {
+enum class command : std::uint8_t {
+  jump,
+  save,
+  save_as,
+  quit,
+  fire,
+  sprint,
+};
+
+using binding_type = jage::engine::input::binding<command>;
+using map_type = jage::engine::input::action_map<command, 8UZ>;
+
+auto make_modifiers(const auto... modifiers) -> std::bitset<modifier_count> {
+  auto bits = std::bitset<modifier_count>{};
+  (bits.set(std::to_underlying(modifiers)), ...);
+  return bits;
+}
+
+auto make_key(const scancode input_scancode,
+              const keyboard::action action = keyboard::action::press,
+              const std::bitset<modifier_count> modifiers = {},
+              const key input_key = key::unidentified) -> key_press {
+  return {
+      .key = input_key,
+      .scancode = input_scancode,
+      .action = action,
+      .modifiers = modifiers,
+  };
+}
+
+constexpr auto default_bindings = std::array{
+    binding_type{.input = scancode::spacebar, .target = command::jump},
+    binding_type{.input = scancode::s,
+                 .chord = chord::control,
+                 .target = command::save},
+    binding_type{.input = scancode::s,
+                 .chord = chord::control | chord::shift,
+                 .target = command::save_as},
+    binding_type{.input = key::escape,
+                 .action = keyboard::action::release,
+                 .target = command::quit},
+    binding_type{.input = button::left, .target = command::fire},
+};
+
+constexpr auto default_map = jage::engine::input::action_map{default_bindings};
+static_assert(default_bindings.size() == default_map.size());
+} // namespace
+
+TEST(action_map, should_resolve_nothing_when_empty) {
+  const auto subject = map_type{};
+  EXPECT_EQ(std::nullopt, subject.resolve(make_key(scancode::spacebar)));
+  EXPECT_EQ(0UZ, subject.size());
+}
+
+TEST(action_map, should_resolve_scancode_binding_for_its_action_only) {
+  EXPECT_EQ(command::jump, default_map.resolve(make_key(scancode::spacebar)));
+  EXPECT_EQ(std::nullopt, default_map.resolve(make_key(
+                              scancode::spacebar, keyboard::action::repeat)));
+  EXPECT_EQ(std::nullopt, default_map.resolve(make_key(
+                              scancode::spacebar, keyboard::action::release)));
+  EXPECT_EQ(std::nullopt, default_map.resolve(make_key(scancode::a)));
+}
+
+TEST(action_map, should_resolve_key_binding_whatever_the_scancode) {
+  EXPECT_EQ(command::quit,
+            default_map.resolve(make_key(scancode::unidentified,
+                                         keyboard::action::release, {},
+                                         key::escape)));
+}
+
+TEST(action_map, should_resolve_chords_exactly) {
+  EXPECT_EQ(std::nullopt, default_map.resolve(make_key(scancode::s)));
+  EXPECT_EQ(command::save,
+            default_map.resolve(make_key(scancode::s, keyboard::action::press,
+                                         make_modifiers(modifier::left_control,
+                                                        modifier::num_lock))));
+  EXPECT_EQ(command::save_as,
+            default_map.resolve(make_key(
+                scancode::s, keyboard::action::press,
+                make_modifiers(modifier::right_control, modifier::left_shift))));
+  EXPECT_EQ(std::nullopt,
+            default_map.resolve(make_key(
+                scancode::s, keyboard::action::press,
+                make_modifiers(modifier::left_control, modifier::left_alt))));
+}
+
+TEST(action_map, should_fall_back_to_binding_without_chord) {
+  EXPECT_EQ(command::jump,
+            default_map.resolve(make_key(scancode::spacebar,
+                                         keyboard::action::press,
+                                         make_modifiers(modifier::left_shift))));
+}
+
+TEST(action_map, should_prefer_scancode_binding_over_key_binding) {
+  const auto subject = map_type{std::array{
+      binding_type{.input = key::w, .target = command::jump},
+      binding_type{.input = scancode::w, .target = command::sprint},
+  }};
+  EXPECT_EQ(command::sprint,
+            subject.resolve(make_key(scancode::w, keyboard::action::press, {},
+                                     key::w)));
+  EXPECT_EQ(command::jump,
+            subject.resolve(make_key(scancode::z, keyboard::action::press, {},
+                                     key::w)));
+}
+
+TEST(action_map, should_resolve_mouse_buttons) {
+  EXPECT_EQ(command::fire, default_map.resolve(click{
+                               .button = button::left,
+                               .action = mouse::action::press,
+                               .modifiers = {},
+                           }));
+  EXPECT_EQ(std::nullopt, default_map.resolve(click{
+                              .button = button::right,
+                              .action = mouse::action::press,
+                              .modifiers = {},
+                          }));
+}
+
+TEST(action_map, should_resolve_events_and_ignore_other_payloads) {
+  using event_type =
+      jage::engine::input::event<jage::engine::time::nanoseconds>;
+  EXPECT_EQ(command::jump, default_map.resolve(event_type{
+                               .timestamp = {},
+                               .payload = make_key(scancode::spacebar),
+                           }));
+  EXPECT_EQ(std::nullopt,
+            default_map.resolve(event_type{
+                .timestamp = {},
+                .payload = mouse::events::cursor::motion{.delta_x = 1.0,
+                                                         .delta_y = 1.0},
+            }));
+}
+
+TEST(action_map, should_ignore_out_of_range_inputs) {
+  EXPECT_EQ(std::nullopt,
+            default_map.resolve(make_key(static_cast<scancode>(0xFFFFU))));
+  EXPECT_EQ(std::nullopt,
+            default_map.resolve(make_key(scancode::spacebar,
+                                         static_cast<keyboard::action>(7U))));
+}
+
+TEST(action_map, should_replace_bindings_on_reload) {
+  auto subject = map_type{default_bindings};
+  const auto loaded = std::vector<binding_type>{
+      {.input = scancode::spacebar, .target = command::sprint},
+  };
+
+  subject.reload(loaded);
+
+  EXPECT_EQ(command::sprint, subject.resolve(make_key(scancode::spacebar)));
+  EXPECT_EQ(std::nullopt, subject.resolve(click{
+                              .button = button::left,
+                              .action = mouse::action::press,
+                              .modifiers = {},
+                          }));
+  EXPECT_EQ(1UZ, subject.size());
+}
+
+TEST(action_map, should_throw_and_clear_when_input_is_bound_twice) {
+  auto subject = map_type{default_bindings};
+  const auto loaded = std::vector<binding_type>{
+      {.input = scancode::w, .target = command::jump},
+      {.input = scancode::w, .target = command::sprint},
+  };
+
+  EXPECT_THROW(subject.reload(loaded), std::invalid_argument);
+  EXPECT_EQ(0UZ, subject.size());
+  EXPECT_EQ(std::nullopt, subject.resolve(make_key(scancode::w)));
+}
+
+TEST(action_map, should_throw_when_bindings_exceed_capacity) {
+  auto subject = jage::engine::input::action_map<command, 1UZ>{};
+  EXPECT_THROW(subject.reload(default_bindings), std::invalid_argument);
+}
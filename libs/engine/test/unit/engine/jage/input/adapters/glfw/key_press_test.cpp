@@ -40,16 +40,14 @@ protected:
 };
 
 TEST_F(glfw_adapter, should_set_keyboard_callback) {
-  adapter_type::initialize(nullptr, platform,
-                           platform_type::context_type::duration_type{});
+  adapter_type::initialize(nullptr, platform);
   platform.trigger_key_callback(GLFW_KEY_ESCAPE, 0x04, GLFW_PRESS, 0);
   EXPECT_FALSE(std::empty(context.buffer));
 }
 
 TEST_F(glfw_adapter,
        should_return_unidentified_for_key_that_is_not_identified) {
-  adapter_type::initialize(nullptr, platform,
-                           platform_type::context_type::duration_type{});
+  adapter_type::initialize(nullptr, platform);
   platform.trigger_key_callback(337, 0x05, GLFW_PRESS, 0);
   ASSERT_FALSE(std::empty(context.buffer));
   ASSERT_TRUE(
@@ -61,8 +59,7 @@ TEST_F(glfw_adapter,
 
 TEST_F(glfw_adapter,
        should_return_unidentified_for_scancode_that_is_not_identified) {
-  adapter_type::initialize(nullptr, platform,
-                           platform_type::context_type::duration_type{});
+  adapter_type::initialize(nullptr, platform);
   platform.trigger_key_callback(GLFW_KEY_ESCAPE, GLFW_KEY_UNKNOWN, GLFW_PRESS,
                                 0);
   platform.trigger_key_callback(GLFW_KEY_UNKNOWN, 0x43, GLFW_PRESS, 0);
@@ -87,8 +84,7 @@ TEST_F(glfw_adapter,
 }
 
 TEST_F(glfw_adapter, should_map_action_appropriately) {
-  adapter_type::initialize(nullptr, platform,
-                           platform_type::context_type::duration_type{});
+  adapter_type::initialize(nullptr, platform);
   platform.trigger_key_callback(GLFW_KEY_ESCAPE, 0x04, GLFW_RELEASE, 0);
   platform.trigger_key_callback(GLFW_KEY_ESCAPE, 0x04, GLFW_PRESS, 0);
   platform.trigger_key_callback(GLFW_KEY_ESCAPE, 0x04, GLFW_REPEAT, 0);
@@ -114,8 +110,7 @@ TEST_F(glfw_adapter, should_map_action_appropriately) {
 }
 
 TEST_F(glfw_adapter, should_map_modifiers) {
-  adapter_type::initialize(nullptr, platform,
-                           platform_type::context_type::duration_type{});
+  adapter_type::initialize(nullptr, platform);
   platform.trigger_key_callback(GLFW_KEY_ESCAPE, 0x04, GLFW_PRESS,
                                 GLFW_MOD_SHIFT);
   {
@@ -202,14 +197,8 @@ TEST_F(glfw_adapter, should_map_modifiers) {
 }
 
 TEST_F(glfw_adapter, should_set_timestamp) {
-  platform.set_seconds_since_init(platform_type::duration_type{11});
-  EXPECT_EQ(platform_type::duration_type{11},
-            platform.get_seconds_since_init());
-  adapter_type::initialize(nullptr, platform,
-                           context_type::duration_type{42e+9});
-  EXPECT_EQ(jage::engine::time::cast<platform_type::duration_type>(
-                context_type::duration_type{42e+9}),
-            platform.get_seconds_since_init());
+  context.current_time = context_type::duration_type{42e+9};
+  adapter_type::initialize(nullptr, platform);
   platform.trigger_key_callback(GLFW_KEY_ESCAPE, 0x04, GLFW_PRESS,
                                 GLFW_MOD_SHIFT);
   {
@@ -220,7 +209,7 @@ TEST_F(glfw_adapter, should_set_timestamp) {
               context.buffer.front().timestamp);
   }
   context.buffer.clear();
-  platform.set_seconds_since_init(context_type::duration_type{99e+9});
+  context.current_time = context_type::duration_type{99e+9};
   platform.trigger_key_callback(GLFW_KEY_ESCAPE, 0x04, GLFW_PRESS,
                                 GLFW_MOD_SHIFT);
   {
@@ -233,14 +222,7 @@ TEST_F(glfw_adapter, should_set_timestamp) {
 }
 
 TEST_F(glfw_adapter, should_map_unknown_to_unidentified) {
-  platform.set_seconds_since_init(platform_type::duration_type{11});
-  EXPECT_EQ(platform_type::duration_type{11},
-            platform.get_seconds_since_init());
-  adapter_type::initialize(nullptr, platform,
-                           context_type::duration_type{42e+9});
-  EXPECT_EQ(jage::engine::time::cast<platform_type::duration_type>(
-                context_type::duration_type{42e+9}),
-            platform.get_seconds_since_init());
+  adapter_type::initialize(nullptr, platform);
   platform.trigger_key_callback(GLFW_KEY_UNKNOWN, 0x04, GLFW_PRESS,
                                 GLFW_MOD_SHIFT);
   ASSERT_FALSE(std::empty(context.buffer));
@@ -286,8 +268,7 @@ protected:
 };
 
 TEST_P(glfw_adapter_key_map, should_map_glfw_keys_and_scan_codes) {
-  adapter_type::initialize(nullptr, platform,
-                           platform_type::context_type::duration_type{});
+  adapter_type::initialize(nullptr, platform);
   const auto &[glfw_key, os_scancode, expected_key, expected_scancode] =
       GetParam();
   platform.trigger_key_callback(glfw_key, os_scancode, GLFW_PRESS, 0);
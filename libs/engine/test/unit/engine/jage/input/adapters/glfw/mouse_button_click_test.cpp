@@ -71,8 +71,7 @@ struct button_param {
 using glfw_adapter_button_click = glfw_adapter_test<button_param>;
 
 TEST_P(glfw_adapter_button_click, should_map_button_click) {
-  adapter_type::initialize(nullptr, platform,
-                           platform_type::context_type::duration_type{});
+  adapter_type::initialize(nullptr, platform);
   const auto &[glfw_button, expected_output_button] = GetParam();
   platform.trigger_mouse_button_callback(glfw_button, GLFW_PRESS, 0);
   ASSERT_FALSE(std::empty(context.buffer));
@@ -92,8 +91,7 @@ struct modifier_param {
 using glfw_adapter_button_click_modifier = glfw_adapter_test<modifier_param>;
 
 TEST_P(glfw_adapter_button_click_modifier, should_map_modifier) {
-  adapter_type::initialize(nullptr, platform,
-                           platform_type::context_type::duration_type{});
+  adapter_type::initialize(nullptr, platform);
   const auto &[glfw_modifier, expected_left, optional_expected_right] =
       GetParam();
   platform.trigger_mouse_button_callback(GLFW_MOUSE_BUTTON_LEFT, GLFW_PRESS,
@@ -119,8 +117,7 @@ struct action_param {
 
 using glfw_adapter_button_click_action = glfw_adapter_test<action_param>;
 TEST_P(glfw_adapter_button_click_action, should_map_action) {
-  adapter_type::initialize(nullptr, platform,
-                           platform_type::context_type::duration_type{});
+  adapter_type::initialize(nullptr, platform);
   const auto &[glfw_action, expected_action] = GetParam();
   platform.trigger_mouse_button_callback(GLFW_MOUSE_BUTTON_LEFT, glfw_action,
                                          0);
@@ -137,7 +134,8 @@ using glfw_adapter_timestamp_test = glfw_adapter_test<no_test_param>;
 TEST_F(glfw_adapter_timestamp_test, should_set_timestamp) {
   const auto initial_duration = context_type::duration_type{42e+9};
 
-  adapter_type::initialize(nullptr, platform, initial_duration);
+  context.current_time = initial_duration;
+  adapter_type::initialize(nullptr, platform);
   platform.trigger_mouse_button_callback(GLFW_MOUSE_BUTTON_LEFT, GLFW_PRESS, 0);
   {
     ASSERT_FALSE(std::empty(context.buffer));
@@ -147,7 +145,7 @@ TEST_F(glfw_adapter_timestamp_test, should_set_timestamp) {
   }
   context.buffer.clear();
   const auto next_duration = context_type::duration_type{99e+9};
-  platform.set_seconds_since_init(next_duration);
+  context.current_time = next_duration;
   platform.trigger_mouse_button_callback(GLFW_MOUSE_BUTTON_LEFT, GLFW_PRESS, 0);
   {
     ASSERT_FALSE(std::empty(context.buffer));
@@ -32,7 +32,8 @@ protected:
 };
 
 TEST_F(glfw_adapter, should_push_vertical_scroll_event_on_y_offset_change) {
-  adapter_type::initialize(nullptr, platform, duration_type{42});
+  context.current_time = duration_type{42};
+  adapter_type::initialize(nullptr, platform);
   platform.trigger_scroll_callback(0.0, 1.75);
   ASSERT_FALSE(std::empty(context.buffer));
   ASSERT_TRUE(std::holds_alternative<vertical_scroll_event>(
@@ -44,7 +45,8 @@ TEST_F(glfw_adapter, should_push_vertical_scroll_event_on_y_offset_change) {
 }
 
 TEST_F(glfw_adapter, should_push_horizontal_scroll_event_on_x_offset_change) {
-  adapter_type::initialize(nullptr, platform, duration_type{100});
+  context.current_time = duration_type{100};
+  adapter_type::initialize(nullptr, platform);
   platform.trigger_scroll_callback(2.5, 0.0);
   ASSERT_FALSE(std::empty(context.buffer));
   ASSERT_TRUE(std::holds_alternative<horizontal_scroll_event>(
@@ -0,0 +1,186 @@
+#include <jage/engine/input/adapters/glfw_gamepads.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/gamepad/action.hpp>
+#include <jage/engine/input/gamepad/axis.hpp>
+#include <jage/engine/input/gamepad/axis_filter.hpp>
+#include <jage/engine/input/gamepad/button.hpp>
+#include <jage/engine/input/gamepad/events/axis_motion.hpp>
+#include <jage/engine/input/gamepad/events/button_press.hpp>
+#include <jage/engine/test/fakes/input/context/glfw.hpp>
+#include <jage/engine/test/fakes/input/platforms/glfw.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <utility>
+#include <variant>
+
+using duration_type = jage::engine::time::durations::nanoseconds;
+using context_type = jage::engine::test::fakes::input::context::glfw<
+    duration_type, jage::engine::input::event<duration_type>>;
+using platform_type =
+    jage::engine::test::fakes::input::platforms::glfw<context_type>;
+using adapter_type =
+    jage::engine::input::adapters::glfw_gamepads<platform_type>;
+using jage::engine::input::gamepad::action;
+using jage::engine::input::gamepad::axis;
+using jage::engine::input::gamepad::button;
+using jage::engine::input::gamepad::events::axis_motion;
+using jage::engine::input::gamepad::events::button_press;
+
+namespace {
+auto at_rest() -> platform_type::gamepad_state_type {
+  auto state = platform_type::gamepad_state_type{};
+  state.axes[std::to_underlying(axis::left_trigger)] = -1.0F;
+  state.axes[std::to_underlying(axis::right_trigger)] = -1.0F;
+  return state;
+}
+} // namespace
+
+class glfw_gamepads : public testing::Test {
+protected:
+  context_type context;
+  platform_type platform;
+  adapter_type subject{};
+
+  auto SetUp() -> void override {
+    platform.set_window_user_pointer(nullptr, static_cast<void *>(&context));
+  }
+
+  auto TearDown() -> void override { platform.reset(); }
+
+  auto poll() -> std::size_t { return subject.poll(nullptr, platform); }
+};
+
+TEST_F(glfw_gamepads, should_push_nothing_without_gamepads) {
+  EXPECT_EQ(0UZ, poll());
+  EXPECT_TRUE(std::empty(context.buffer));
+}
+
+TEST_F(glfw_gamepads, should_push_nothing_for_a_gamepad_at_rest) {
+  platform_type::gamepads[0] = at_rest();
+
+  EXPECT_EQ(0UZ, poll());
+  EXPECT_TRUE(std::empty(context.buffer));
+}
+
+TEST_F(glfw_gamepads, should_push_button_press_once_while_held) {
+  auto state = at_rest();
+  state.buttons[std::to_underlying(button::a)] = 1U;
+  platform_type::gamepads[2] = state;
+  context.current_time = duration_type{42};
+
+  ASSERT_EQ(1UZ, poll());
+  EXPECT_EQ(0UZ, poll());
+
+  ASSERT_EQ(1UZ, std::size(context.buffer));
+  EXPECT_EQ(42, context.buffer.front().timestamp.count());
+  ASSERT_TRUE(
+      std::holds_alternative<button_press>(context.buffer.front().payload));
+  const auto pressed = std::get<button_press>(context.buffer.front().payload);
+  EXPECT_EQ(2U, pressed.gamepad);
+  EXPECT_EQ(button::a, pressed.button);
+  EXPECT_EQ(action::press, pressed.action);
+}
+
+TEST_F(glfw_gamepads, should_push_release_when_button_is_let_go) {
+  auto state = at_rest();
+  state.buttons[std::to_underlying(button::dpad_left)] = 1U;
+  platform_type::gamepads[0] = state;
+  std::ignore = poll();
+  platform_type::gamepads[0] = at_rest();
+
+  ASSERT_EQ(1UZ, poll());
+  const auto released = std::get<button_press>(context.buffer.back().payload);
+  EXPECT_EQ(button::dpad_left, released.button);
+  EXPECT_EQ(action::release, released.action);
+}
+
+TEST_F(glfw_gamepads, should_ignore_stick_noise_inside_dead_zone) {
+  for (const auto noise : {0.02F, -0.05F, 0.09F, -0.01F}) {
+    auto state = at_rest();
+    state.axes[std::to_underlying(axis::left_x)] = noise;
+    state.axes[std::to_underlying(axis::right_y)] = -noise;
+    platform_type::gamepads[0] = state;
+    EXPECT_EQ(0UZ, poll());
+  }
+  EXPECT_TRUE(std::empty(context.buffer));
+}
+
+TEST_F(glfw_gamepads, should_push_axis_motion_only_when_level_changes) {
+  auto state = at_rest();
+  state.axes[std::to_underlying(axis::left_y)] = -1.0F;
+  platform_type::gamepads[0] = state;
+  ASSERT_EQ(1UZ, poll());
+
+  state.axes[std::to_underlying(axis::left_y)] = -0.999F;
+  platform_type::gamepads[0] = state;
+  EXPECT_EQ(0UZ, poll());
+
+  ASSERT_EQ(1UZ, std::size(context.buffer));
+  const auto motion = std::get<axis_motion>(context.buffer.front().payload);
+  EXPECT_EQ(0U, motion.gamepad);
+  EXPECT_EQ(axis::left_y, motion.axis);
+  EXPECT_EQ(-1.0, motion.value);
+}
+
+TEST_F(glfw_gamepads, should_report_triggers_from_zero_at_rest) {
+  auto state = at_rest();
+  state.axes[std::to_underlying(axis::right_trigger)] = 1.0F;
+  platform_type::gamepads[0] = state;
+
+  ASSERT_EQ(1UZ, poll());
+  const auto motion = std::get<axis_motion>(context.buffer.front().payload);
+  EXPECT_EQ(axis::right_trigger, motion.axis);
+  EXPECT_EQ(1.0, motion.value);
+}
+
+TEST_F(glfw_gamepads, should_release_everything_when_gamepad_disconnects) {
+  auto state = at_rest();
+  state.buttons[std::to_underlying(button::start)] = 1U;
+  state.axes[std::to_underlying(axis::right_x)] = 0.5F;
+  platform_type::gamepads[1] = state;
+  ASSERT_EQ(2UZ, poll());
+  platform_type::gamepads.erase(1);
+
+  ASSERT_EQ(2UZ, poll());
+  const auto released = std::get<button_press>(context.buffer[2].payload);
+  EXPECT_EQ(button::start, released.button);
+  EXPECT_EQ(action::release, released.action);
+  const auto centred = std::get<axis_motion>(context.buffer[3].payload);
+  EXPECT_EQ(axis::right_x, centred.axis);
+  EXPECT_EQ(0.0, centred.value);
+}
+
+TEST_F(glfw_gamepads, should_report_changes_from_several_gamepads_in_order) {
+  auto state = at_rest();
+  state.buttons[std::to_underlying(button::b)] = 1U;
+  state.buttons[std::to_underlying(button::y)] = 1U;
+  platform_type::gamepads[0] = state;
+  platform_type::gamepads[15] = state;
+
+  ASSERT_EQ(4UZ, poll());
+  const auto first = std::get<button_press>(context.buffer[0].payload);
+  const auto second = std::get<button_press>(context.buffer[1].payload);
+  const auto last = std::get<button_press>(context.buffer[3].payload);
+  EXPECT_EQ(0U, first.gamepad);
+  EXPECT_EQ(button::b, first.button);
+  EXPECT_EQ(button::y, second.button);
+  EXPECT_EQ(15U, last.gamepad);
+}
+
+TEST_F(glfw_gamepads, should_apply_custom_filter) {
+  subject = adapter_type{
+      jage::engine::input::gamepad::axis_filter{.dead_zone = 0.5,
+                                                .levels = 2}};
+  auto state = at_rest();
+  state.axes[std::to_underlying(axis::left_x)] = 0.4F;
+  platform_type::gamepads[0] = state;
+  EXPECT_EQ(0UZ, poll());
+
+  state.axes[std::to_underlying(axis::left_x)] = 0.8F;
+  platform_type::gamepads[0] = state;
+  ASSERT_EQ(1UZ, poll());
+  EXPECT_EQ(0.5, std::get<axis_motion>(context.buffer.front().payload).value);
+}
@@ -0,0 +1,63 @@
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/interop/glfw_glad.hpp>
+
+#include <jage/engine/input/adapters/internal/glfw_keys.hpp>
+
+#include <gtest/gtest.h>
+
+#include <unordered_map>
+
+namespace internal = jage::engine::input::adapters::internal;
+namespace keyboard = jage::engine::input::keyboard;
+
+namespace {
+struct platform {
+  std::unordered_map<int, int> key_to_scancode{};
+
+  [[nodiscard]] auto get_key_scancode(const int key) const -> int {
+    if (const auto iter = key_to_scancode.find(key);
+        iter != std::end(key_to_scancode)) {
+      return iter->second;
+    }
+    return -1;
+  }
+};
+} // namespace
+
+TEST(glfw_keys, should_map_logical_keys_at_compile_time) {
+  static_assert(keyboard::key::a == internal::to_key(GLFW_KEY_A));
+  static_assert(keyboard::key::menu == internal::to_key(GLFW_KEY_MENU));
+  static_assert(keyboard::key::unidentified ==
+                internal::to_key(GLFW_KEY_UNKNOWN));
+  static_assert(keyboard::key::unidentified ==
+                internal::to_key(GLFW_KEY_LAST + 1));
+  static_assert(keyboard::key::unidentified == internal::to_key(337));
+}
+
+TEST(glfw_keys, should_map_loaded_os_scancodes) {
+  auto subject = internal::glfw_scancode_table{};
+  subject.load(platform{.key_to_scancode = {{GLFW_KEY_W, 25},
+                                            {GLFW_KEY_ESCAPE, 9}}});
+
+  EXPECT_EQ(keyboard::scancode::w, subject[25]);
+  EXPECT_EQ(keyboard::scancode::escape, subject[9]);
+  EXPECT_EQ(keyboard::scancode::unidentified, subject[10]);
+}
+
+TEST(glfw_keys, should_forget_previous_mapping_on_load) {
+  auto subject = internal::glfw_scancode_table{};
+  subject.load(platform{.key_to_scancode = {{GLFW_KEY_W, 25}}});
+  subject.load(platform{.key_to_scancode = {{GLFW_KEY_S, 39}}});
+
+  EXPECT_EQ(keyboard::scancode::unidentified, subject[25]);
+  EXPECT_EQ(keyboard::scancode::s, subject[39]);
+}
+
+TEST(glfw_keys, should_ignore_out_of_range_os_scancodes) {
+  auto subject = internal::glfw_scancode_table{};
+  subject.load(platform{.key_to_scancode = {{GLFW_KEY_W, 1 << 20}}});
+
+  EXPECT_EQ(keyboard::scancode::unidentified, subject[-1]);
+  EXPECT_EQ(keyboard::scancode::unidentified, subject[1 << 20]);
+}
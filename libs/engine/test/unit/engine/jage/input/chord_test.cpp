@@ -0,0 +1,41 @@
+#include <jage/engine/input/chord.hpp>
+#include <jage/engine/input/modifier.hpp>
+
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <utility>
+
+using jage::engine::input::chord;
+using jage::engine::input::modifier;
+using jage::engine::input::modifier_count;
+using jage::engine::input::to_chord;
+
+namespace {
+auto make_modifiers(const auto... modifiers) -> std::bitset<modifier_count> {
+  auto bits = std::bitset<modifier_count>{};
+  (bits.set(std::to_underlying(modifiers)), ...);
+  return bits;
+}
+} // namespace
+
+TEST(chord, should_be_none_without_modifiers) {
+  EXPECT_EQ(chord::none, to_chord(make_modifiers()));
+}
+
+TEST(chord, should_fold_left_and_right_modifiers_together) {
+  EXPECT_EQ(chord::control, to_chord(make_modifiers(modifier::left_control)));
+  EXPECT_EQ(chord::control, to_chord(make_modifiers(modifier::right_control)));
+  EXPECT_EQ(chord::shift, to_chord(make_modifiers(modifier::left_shift,
+                                                  modifier::right_shift)));
+  EXPECT_EQ(chord::gui, to_chord(make_modifiers(modifier::right_gui)));
+  EXPECT_EQ(chord::control | chord::alt,
+            to_chord(make_modifiers(modifier::left_alt,
+                                    modifier::right_control)));
+}
+
+TEST(chord, should_ignore_lock_keys) {
+  EXPECT_EQ(chord::shift,
+            to_chord(make_modifiers(modifier::caps_lock, modifier::num_lock,
+                                    modifier::left_shift)));
+}
@@ -1,8 +1,21 @@
+#include <jage/engine/input/contexts/coalescing.hpp>
 #include <jage/engine/input/contexts/glfw.hpp>
+#include <jage/engine/input/encoded_event.hpp>
 #include <jage/engine/input/event.hpp>
+#include <jage/engine/input/gamepad/action.hpp>
+#include <jage/engine/input/gamepad/button.hpp>
+#include <jage/engine/input/gamepad/events/button_press.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/cursor/position.hpp>
 #include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/input/window_id.hpp>
 #include <jage/engine/test/fakes/containers/event_sink.hpp>
+#include <jage/engine/time/clock.hpp>
 #include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/hertz.hpp>
+#include <jage/engine/time/virtual_clock.hpp>
+
+#include <jage/engine/time/internal/steady_clock.hpp>
 
 #include <gtest/gtest.h>
 
@@ -87,3 +100,161 @@ TEST_F(glfw_context, should_reflect_cursor_mutation_through_const_accessor) {
   EXPECT_DOUBLE_EQ(3.14, const_context.last_known_cursor_position().first);
   EXPECT_DOUBLE_EQ(2.72, const_context.last_known_cursor_position().second);
 }
+
+TEST_F(glfw_context, should_timestamp_from_same_time_source_as_clock) {
+  using jage::engine::time::operator""_Hz;
+  const auto clock = jage::engine::time::clock<duration_type>{60_Hz};
+  const auto before = clock.real_time();
+  const auto timestamp = context.timestamp();
+  const auto after = clock.real_time();
+  EXPECT_LE(before, timestamp);
+  EXPECT_LE(timestamp, after);
+}
+
+TEST(glfw_context_time_source, should_timestamp_with_injected_time_source) {
+  using time_source_type =
+      jage::engine::time::virtual_time_source<duration_type>;
+  auto sink = sink_type{};
+  auto context = jage::engine::input::contexts::glfw<duration_type, sink_type,
+                                                     time_source_type>{
+      sink, time_source_type{duration_type{42}}};
+  EXPECT_EQ(duration_type{42}, context.timestamp());
+  context.time_source().advance(duration_type{8});
+  EXPECT_EQ(duration_type{50}, context.timestamp());
+}
+
+using motion_type = jage::engine::input::mouse::events::cursor::motion;
+using position_type = jage::engine::input::mouse::events::cursor::position;
+
+TEST_F(glfw_context, should_forward_first_cursor_report_immediately) {
+  context.push(event_type{duration_type{1}, motion_type{1.0, 2.0}});
+  ASSERT_EQ(1, sink.events.size());
+  EXPECT_EQ(1, sink.events.front().timestamp.count());
+}
+
+TEST_F(glfw_context, should_hold_consecutive_motion_until_flush) {
+  context.push(event_type{duration_type{1}, motion_type{1.0, 2.0}});
+  context.push(event_type{duration_type{2}, motion_type{3.0, 4.0}});
+  context.push(event_type{duration_type{3}, motion_type{5.0, 6.0}});
+  EXPECT_EQ(1, sink.events.size());
+  context.flush();
+  ASSERT_EQ(2, sink.events.size());
+}
+
+TEST_F(glfw_context, should_sum_coalesced_motion_deltas) {
+  context.push(event_type{duration_type{1}, motion_type{1.0, 2.0}});
+  context.push(event_type{duration_type{2}, motion_type{3.0, 4.0}});
+  context.push(event_type{duration_type{3}, motion_type{5.0, 6.0}});
+  context.flush();
+  ASSERT_EQ(2, sink.events.size());
+  ASSERT_TRUE(std::holds_alternative<motion_type>(sink.events[1].payload));
+  const auto motion = std::get<motion_type>(sink.events[1].payload);
+  EXPECT_DOUBLE_EQ(8.0, motion.delta_x);
+  EXPECT_DOUBLE_EQ(10.0, motion.delta_y);
+}
+
+TEST_F(glfw_context, should_keep_first_and_last_timestamps_of_a_run) {
+  context.push(event_type{duration_type{1}, motion_type{1.0, 2.0}});
+  context.push(event_type{duration_type{2}, motion_type{3.0, 4.0}});
+  context.push(event_type{duration_type{3}, motion_type{5.0, 6.0}});
+  context.flush();
+  ASSERT_EQ(2, sink.events.size());
+  EXPECT_EQ(1, sink.events[0].timestamp.count());
+  EXPECT_EQ(3, sink.events[1].timestamp.count());
+}
+
+TEST_F(glfw_context, should_keep_only_latest_coalesced_position) {
+  context.push(event_type{duration_type{1}, position_type{1.0, 2.0}});
+  context.push(event_type{duration_type{2}, position_type{3.0, 4.0}});
+  context.push(event_type{duration_type{3}, position_type{5.0, 6.0}});
+  context.flush();
+  ASSERT_EQ(2, sink.events.size());
+  ASSERT_TRUE(std::holds_alternative<position_type>(sink.events[1].payload));
+  const auto position = std::get<position_type>(sink.events[1].payload);
+  EXPECT_DOUBLE_EQ(5.0, position.x);
+  EXPECT_DOUBLE_EQ(6.0, position.y);
+}
+
+TEST_F(glfw_context, should_flush_cursor_run_before_discrete_event) {
+  context.push(event_type{duration_type{1}, motion_type{1.0, 2.0}});
+  context.push(event_type{duration_type{2}, motion_type{3.0, 4.0}});
+  context.push(event_type{duration_type{3}, scroll_type{1.5}});
+  ASSERT_EQ(3, sink.events.size());
+  EXPECT_TRUE(std::holds_alternative<motion_type>(sink.events[1].payload));
+  EXPECT_TRUE(std::holds_alternative<scroll_type>(sink.events[2].payload));
+}
+
+TEST_F(glfw_context, should_start_new_run_when_cursor_report_kind_changes) {
+  context.push(event_type{duration_type{1}, motion_type{1.0, 2.0}});
+  context.push(event_type{duration_type{2}, motion_type{3.0, 4.0}});
+  context.push(event_type{duration_type{3}, position_type{5.0, 6.0}});
+  ASSERT_EQ(3, sink.events.size());
+  EXPECT_TRUE(std::holds_alternative<motion_type>(sink.events[1].payload));
+  EXPECT_TRUE(std::holds_alternative<position_type>(sink.events[2].payload));
+}
+
+TEST_F(glfw_context, should_forward_first_report_after_flush_immediately) {
+  context.push(event_type{duration_type{1}, motion_type{1.0, 2.0}});
+  context.flush();
+  EXPECT_EQ(1, sink.events.size());
+  context.push(event_type{duration_type{2}, motion_type{3.0, 4.0}});
+  EXPECT_EQ(2, sink.events.size());
+}
+
+TEST(glfw_context_coalescing, should_forward_every_report_when_opted_out) {
+  auto sink = sink_type{};
+  auto context = jage::engine::input::contexts::glfw<
+      duration_type, sink_type,
+      jage::engine::time::internal::steady_clock<duration_type>,
+      jage::engine::input::contexts::coalescing::none>{sink};
+  context.push(event_type{duration_type{1}, motion_type{1.0, 2.0}});
+  context.push(event_type{duration_type{2}, motion_type{3.0, 4.0}});
+  context.push(event_type{duration_type{3}, motion_type{5.0, 6.0}});
+  EXPECT_EQ(3, sink.events.size());
+}
+
+TEST_F(glfw_context, should_stamp_default_window_when_none_given) {
+  context.push(event_type{.timestamp = duration_type{1},
+                          .payload = scroll_type{1.5},
+                          .window = 7U});
+  ASSERT_EQ(1, sink.events.size());
+  EXPECT_EQ(0U, sink.events.front().window);
+}
+
+TEST(glfw_context_window, should_leave_gamepad_events_on_default_window) {
+  auto sink = sink_type{};
+  auto context = context_type{sink, jage::engine::input::window_id{2U}};
+  const auto pressed = event_type{
+      .timestamp = duration_type{1},
+      .payload =
+          jage::engine::input::gamepad::events::button_press{
+              .gamepad = 1U,
+              .button = jage::engine::input::gamepad::button::a,
+              .action = jage::engine::input::gamepad::action::press,
+          },
+  };
+  context.push(pressed);
+  ASSERT_EQ(1, sink.events.size());
+  EXPECT_EQ(0U, sink.events.front().window);
+
+  const auto replayed = jage::engine::input::decode<duration_type>(
+      jage::engine::input::encode(sink.events.front()));
+  EXPECT_EQ(sink.events.front().window, replayed.window);
+  EXPECT_EQ(1U, std::get<jage::engine::input::gamepad::events::button_press>(
+                    replayed.payload)
+                    .gamepad);
+}
+
+TEST(glfw_context_window, should_stamp_its_window_on_every_event) {
+  auto sink = sink_type{};
+  auto context = context_type{sink, jage::engine::input::window_id{2U}};
+  context.push(event_type{duration_type{1}, motion_type{1.0, 2.0}});
+  context.push(event_type{duration_type{2}, motion_type{3.0, 4.0}});
+  const auto event = event_type{duration_type{3}, scroll_type{1.5}};
+  context.push(event);
+  ASSERT_EQ(3, sink.events.size());
+  EXPECT_EQ(2U, context.window());
+  for (const auto &input_event : sink.events) {
+    EXPECT_EQ(2U, input_event.window);
+  }
+}
@@ -0,0 +1,138 @@
+#include <jage/engine/input/dispatch.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/stdx/overloaded.hpp>
+
+#include <jage/engine/input/internal/event.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+
+using jage::engine::input::dispatch;
+using jage::engine::input::keyboard::events::key_press;
+using jage::engine::input::mouse::events::vertical_scroll;
+using jage::engine::input::mouse::events::cursor::motion;
+using jage::engine::time::operator""_ns;
+
+namespace {
+auto label(const double value) -> std::string {
+  return std::to_string(static_cast<int>(value));
+}
+
+auto make_motion(const double delta) -> event_type {
+  return {
+      .timestamp = duration_type{delta},
+      .payload = motion{.delta_x = delta, .delta_y = 0.0},
+  };
+}
+
+auto make_scroll(const double offset) -> event_type {
+  return {
+      .timestamp = duration_type{offset},
+      .payload = vertical_scroll{.offset = offset},
+  };
+}
+} // namespace
+
+TEST(dispatch, should_do_nothing_for_empty_batch) {
+  auto calls = 0UZ;
+  dispatch(std::vector<event_type>{}, [&](const auto &) { ++calls; });
+  EXPECT_EQ(0UZ, calls);
+}
+
+TEST(dispatch, should_group_by_payload_and_keep_order_within_payload) {
+  const auto events = std::vector{
+      make_motion(1.0), make_scroll(2.0), make_motion(3.0),
+      make_scroll(4.0), make_motion(5.0),
+  };
+  auto order = std::string{};
+
+  dispatch(events, jage::stdx::overloaded{
+                       [&](const motion &payload) {
+                         order += 'm' + label(payload.delta_x);
+                       },
+                       [&](const vertical_scroll &payload) {
+                         order += 's' + label(payload.offset);
+                       },
+                   });
+
+  EXPECT_EQ("m1m3m5s2s4", order);
+}
+
+TEST(dispatch, should_pass_timestamp_when_handler_takes_it) {
+  const auto events = std::array{make_motion(7.0)};
+  auto timestamp = duration_type{};
+
+  dispatch(events, [&](const motion &, const duration_type event_timestamp) {
+    timestamp = event_timestamp;
+  });
+
+  EXPECT_EQ(7_ns, timestamp);
+}
+
+TEST(dispatch, should_skip_payloads_without_handler) {
+  const auto events = std::vector{
+      make_motion(1.0),
+      event_type{.timestamp = {}, .payload = key_press{}},
+      make_scroll(2.0),
+  };
+  auto motions = 0UZ;
+
+  dispatch(events, [&](const motion &) { ++motions; });
+
+  EXPECT_EQ(1UZ, motions);
+}
+
+TEST(dispatch, should_dispatch_batches_larger_than_batch_size) {
+  auto events = std::vector<event_type>{};
+  for (auto index = 0UZ; index < 10UZ; ++index) {
+    events.push_back(index % 2UZ == 0UZ
+                         ? make_motion(static_cast<double>(index))
+                         : make_scroll(static_cast<double>(index)));
+  }
+  auto order = std::string{};
+
+  dispatch<4UZ>(events, jage::stdx::overloaded{
+                            [&](const motion &payload) {
+                              order += label(payload.delta_x);
+                            },
+                            [&](const vertical_scroll &payload) {
+                              order += label(payload.offset);
+                            },
+                        });
+
+  EXPECT_EQ("0213465789", order);
+}
+
+TEST(dispatch, should_work_with_any_event_instantiation) {
+  struct ping {
+    int value;
+  };
+  struct pong {
+    int value;
+  };
+  using custom_event =
+      jage::engine::input::internal::event<duration_type, ping, pong>;
+  const auto events = std::array{
+      custom_event{.timestamp = {}, .payload = pong{.value = 2}},
+      custom_event{.timestamp = {}, .payload = ping{.value = 1}},
+  };
+  auto sum = 0;
+
+  dispatch(events, jage::stdx::overloaded{
+                       [&](const ping &payload) { sum += payload.value; },
+                       [&](const pong &payload) { sum += 10 * payload.value; },
+                   });
+
+  EXPECT_EQ(21, sum);
+}
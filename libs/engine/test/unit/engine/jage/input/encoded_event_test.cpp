@@ -0,0 +1,225 @@
+#include <jage/engine/input/encoded_event.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/gamepad/events/axis_motion.hpp>
+#include <jage/engine/input/gamepad/events/button_press.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/modifier.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/cursor/position.hpp>
+#include <jage/engine/input/mouse/events/horizontal_scroll.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <stdexcept>
+#include <tuple>
+#include <variant>
+
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using jage::engine::input::decode;
+using jage::engine::input::encode;
+using jage::engine::input::encoded_event;
+namespace gamepad = jage::engine::input::gamepad;
+namespace keyboard = jage::engine::input::keyboard;
+namespace mouse = jage::engine::input::mouse;
+
+namespace {
+auto round_trip(const event_type &input_event) -> event_type {
+  return decode<duration_type>(encode(input_event));
+}
+} // namespace
+
+TEST(encoded_event, Fit_two_events_in_a_cache_line) {
+  static_assert(sizeof(encoded_event) == 32UZ);
+}
+
+TEST(encoded_event, Round_trip_timestamp_ticks_exactly) {
+  const auto decoded = round_trip(event_type{
+      .timestamp = duration_type{1'234'567'890'123'456.0},
+      .payload = mouse::events::vertical_scroll{.offset = 1.0},
+  });
+  EXPECT_EQ(duration_type{1'234'567'890'123'456.0}, decoded.timestamp);
+}
+
+TEST(encoded_event, Store_timestamp_as_nanoseconds_for_any_duration) {
+  using milliseconds = jage::engine::time::milliseconds;
+  const auto input_event = jage::engine::input::event<milliseconds>{
+      .timestamp = milliseconds{1.000'001},
+      .payload = mouse::events::vertical_scroll{.offset = 1.0},
+  };
+
+  const auto encoded = encode(input_event);
+
+  EXPECT_EQ(1'000'001, encoded.timestamp);
+  EXPECT_EQ(input_event.timestamp, decode<milliseconds>(encoded).timestamp);
+}
+
+TEST(encoded_event, Round_trip_key_press) {
+  const auto modifiers = std::bitset<jage::engine::input::modifier_count>{
+      0b10'0000'0011U};
+  const auto decoded = round_trip(event_type{
+      .timestamp = duration_type{42},
+      .payload =
+          keyboard::events::key_press{
+              .key = keyboard::key::escape,
+              .scancode = keyboard::scancode::kp_enter,
+              .action = keyboard::action::repeat,
+              .modifiers = modifiers,
+          },
+  });
+  ASSERT_TRUE(
+      std::holds_alternative<keyboard::events::key_press>(decoded.payload));
+  const auto key_press = std::get<keyboard::events::key_press>(decoded.payload);
+  EXPECT_EQ(keyboard::key::escape, key_press.key);
+  EXPECT_EQ(keyboard::scancode::kp_enter, key_press.scancode);
+  EXPECT_EQ(keyboard::action::repeat, key_press.action);
+  EXPECT_EQ(modifiers, key_press.modifiers);
+}
+
+TEST(encoded_event, Round_trip_click) {
+  const auto modifiers =
+      std::bitset<jage::engine::input::modifier_count>{0b01'0001'0000U};
+  const auto decoded = round_trip(event_type{
+      .timestamp = duration_type{42},
+      .payload =
+          mouse::events::click{
+              .button = mouse::button::forward,
+              .action = mouse::action::press,
+              .modifiers = modifiers,
+          },
+  });
+  ASSERT_TRUE(std::holds_alternative<mouse::events::click>(decoded.payload));
+  const auto click = std::get<mouse::events::click>(decoded.payload);
+  EXPECT_EQ(mouse::button::forward, click.button);
+  EXPECT_EQ(mouse::action::press, click.action);
+  EXPECT_EQ(modifiers, click.modifiers);
+}
+
+TEST(encoded_event, Round_trip_cursor_position_without_loss) {
+  const auto decoded = round_trip(event_type{
+      .timestamp = duration_type{42},
+      .payload = mouse::events::cursor::position{.x = 0.1, .y = 1e+300},
+  });
+  ASSERT_TRUE(std::holds_alternative<mouse::events::cursor::position>(
+      decoded.payload));
+  const auto position =
+      std::get<mouse::events::cursor::position>(decoded.payload);
+  EXPECT_EQ(0.1, position.x);
+  EXPECT_EQ(1e+300, position.y);
+}
+
+TEST(encoded_event, Round_trip_cursor_motion_without_loss) {
+  const auto decoded = round_trip(event_type{
+      .timestamp = duration_type{42},
+      .payload =
+          mouse::events::cursor::motion{.delta_x = -0.3, .delta_y = 1e-300},
+  });
+  ASSERT_TRUE(
+      std::holds_alternative<mouse::events::cursor::motion>(decoded.payload));
+  const auto motion = std::get<mouse::events::cursor::motion>(decoded.payload);
+  EXPECT_EQ(-0.3, motion.delta_x);
+  EXPECT_EQ(1e-300, motion.delta_y);
+}
+
+TEST(encoded_event, Round_trip_scroll_direction) {
+  const auto horizontal = round_trip(event_type{
+      .timestamp = duration_type{1},
+      .payload = mouse::events::horizontal_scroll{.offset = -2.5},
+  });
+  const auto vertical = round_trip(event_type{
+      .timestamp = duration_type{2},
+      .payload = mouse::events::vertical_scroll{.offset = 3.5},
+  });
+  ASSERT_TRUE(std::holds_alternative<mouse::events::horizontal_scroll>(
+      horizontal.payload));
+  ASSERT_TRUE(std::holds_alternative<mouse::events::vertical_scroll>(
+      vertical.payload));
+  EXPECT_EQ(-2.5,
+            std::get<mouse::events::horizontal_scroll>(horizontal.payload)
+                .offset);
+  EXPECT_EQ(3.5,
+            std::get<mouse::events::vertical_scroll>(vertical.payload).offset);
+}
+
+TEST(encoded_event, Round_trip_gamepad_button_press) {
+  const auto decoded = round_trip(event_type{
+      .timestamp = duration_type{42},
+      .payload =
+          gamepad::events::button_press{
+              .gamepad = 3U,
+              .button = gamepad::button::right_thumb,
+              .action = gamepad::action::press,
+          },
+  });
+  ASSERT_TRUE(
+      std::holds_alternative<gamepad::events::button_press>(decoded.payload));
+  const auto button_press =
+      std::get<gamepad::events::button_press>(decoded.payload);
+  EXPECT_EQ(3U, button_press.gamepad);
+  EXPECT_EQ(gamepad::button::right_thumb, button_press.button);
+  EXPECT_EQ(gamepad::action::press, button_press.action);
+}
+
+TEST(encoded_event, Round_trip_gamepad_axis_motion_without_loss) {
+  const auto decoded = round_trip(event_type{
+      .timestamp = duration_type{42},
+      .payload =
+          gamepad::events::axis_motion{
+              .gamepad = 15U,
+              .axis = gamepad::axis::left_y,
+              .value = -0.3,
+          },
+  });
+  ASSERT_TRUE(
+      std::holds_alternative<gamepad::events::axis_motion>(decoded.payload));
+  const auto axis_motion =
+      std::get<gamepad::events::axis_motion>(decoded.payload);
+  EXPECT_EQ(15U, axis_motion.gamepad);
+  EXPECT_EQ(gamepad::axis::left_y, axis_motion.axis);
+  EXPECT_EQ(-0.3, axis_motion.value);
+}
+
+TEST(encoded_event, Round_trip_window_of_keyboard_and_mouse_events) {
+  const auto decoded = round_trip(event_type{
+      .timestamp = duration_type{42},
+      .payload = mouse::events::vertical_scroll{.offset = 1.0},
+      .window = 3U,
+  });
+  EXPECT_EQ(3U, decoded.window);
+}
+
+TEST(encoded_event, Decode_gamepad_events_with_default_window) {
+  const auto decoded = round_trip(event_type{
+      .timestamp = duration_type{42},
+      .payload =
+          gamepad::events::button_press{
+              .gamepad = 3U,
+              .button = gamepad::button::a,
+              .action = gamepad::action::press,
+          },
+      .window = 2U,
+  });
+  EXPECT_EQ(0U, decoded.window);
+  EXPECT_EQ(3U,
+            std::get<gamepad::events::button_press>(decoded.payload).gamepad);
+}
+
+TEST(encoded_event, Tag_payload_with_variant_index) {
+  const auto encoded = encode(event_type{
+      .timestamp = duration_type{7},
+      .payload =
+          mouse::events::cursor::motion{.delta_x = 1.0, .delta_y = 2.0},
+  });
+  EXPECT_EQ(
+      (encoded_event{.type = 3U, .timestamp = 7, .x = 1.0, .y = 2.0}),
+      encoded);
+}
+
+TEST(encoded_event, Throw_when_decoding_unknown_type) {
+  EXPECT_THROW(std::ignore = decode<duration_type>(encoded_event{.type = 8U}),
+               std::invalid_argument);
+}
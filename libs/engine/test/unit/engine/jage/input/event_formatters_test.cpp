@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <fmt/format.h>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -458,6 +459,32 @@ INSTANTIATE_TEST_SUITE_P(event_format, event_format_test,
                            return fmt::format("case_{}", info.index);
                          });
 
+TEST(gamepad_format, should_format_button_press_event) {
+  EXPECT_EQ(R"("gamepad-button-press": {
+      "gamepad": 1,
+      "button": dpad_up,
+      "action": press
+  })",
+            fmt::format("{}", gamepad::events::button_press{
+                                  .gamepad = 1U,
+                                  .button = gamepad::button::dpad_up,
+                                  .action = gamepad::action::press,
+                              }));
+}
+
+TEST(gamepad_format, should_format_axis_motion_event) {
+  EXPECT_EQ(R"("gamepad-axis-motion": {
+      "gamepad": 0,
+      "axis": right_trigger,
+      "value": 0.5
+  })",
+            fmt::format("{}", gamepad::events::axis_motion{
+                                  .gamepad = 0U,
+                                  .axis = gamepad::axis::right_trigger,
+                                  .value = 0.5,
+                              }));
+}
+
 using snapshot_type = events::snapshot<durations::nanoseconds>;
 
 struct snapshot_param {
@@ -494,3 +521,95 @@ INSTANTIATE_TEST_SUITE_P(snapshot_format, snapshot_format_test,
                          [](const auto &info) -> std::string {
                            return fmt::format("case_{}", info.index);
                          });
+
+TEST(compact_format, should_format_payload_on_one_line) {
+  EXPECT_EQ(
+      R"("key-press": {"key": escape, "scancode": escape, "action": release, )"
+      R"("modifiers": 0000000101})",
+      fmt::format("{:c}", keyboard::events::key_press{
+                              .key = keyboard::key::escape,
+                              .scancode = keyboard::scancode::escape,
+                              .action = keyboard::action::release,
+                              .modifiers = std::bitset<modifier_count>{0b101},
+                          }));
+  EXPECT_EQ(R"("cursor-motion": {"delta_x": 1.5, "delta_y": -2.5})",
+            fmt::format("{:c}", mouse::events::cursor::motion{
+                                    .delta_x = 1.5, .delta_y = -2.5}));
+}
+
+TEST(compact_format, should_format_event_on_one_line) {
+  EXPECT_EQ(
+      R"("input-event": {"timestamp": 2000000000 ns, )"
+      R"("mouse-click": {"button": right, "action": press, )"
+      R"("modifiers": 0000000011}})",
+      fmt::format("{:c}", event_type{
+                              .timestamp = durations::nanoseconds{2e9},
+                              .payload =
+                                  mouse::events::click{
+                                      .button = mouse::button::right,
+                                      .action = mouse::action::press,
+                                      .modifiers =
+                                          std::bitset<modifier_count>{0b11},
+                                  },
+                          }));
+}
+
+TEST(compact_format, should_format_snapshot_on_one_line) {
+  const auto snapshot = snapshot_type{
+      .real_time = durations::nanoseconds{1000.0},
+      .tick_duration = durations::nanoseconds{10.0},
+      .time_scale = 1.0,
+      .elapsed_time = durations::nanoseconds{500.0},
+      .elapsed_frames = 50,
+      .frame = 7,
+      .accumulated_time = durations::nanoseconds{5.0},
+  };
+  EXPECT_EQ(R"("frame": {"real_time": 1000 ns, "tick_duration": 10 ns, )"
+            R"("time_scale": 1, "elapsed_time": 500 ns, "elapsed_frames": 50, )"
+            R"("frame": 7, "accumulated_time": 5 ns})",
+            fmt::format("{:c}", snapshot));
+}
+
+TEST(event_format, should_format_the_same_text_every_time) {
+  const auto input_event =
+      event_type{.timestamp = durations::nanoseconds{1.0},
+                 .payload = mouse::events::vertical_scroll{.offset = 1.0}};
+  EXPECT_EQ(fmt::format("{}", input_event), fmt::format("{}", input_event));
+  EXPECT_THAT(fmt::format("{}", input_event),
+              testing::Not(testing::HasSubstr("wall-time")));
+}
+
+TEST(event_format, should_reject_unknown_format_spec) {
+  const auto input_event =
+      event_type{.timestamp = durations::nanoseconds{1.0},
+                 .payload = mouse::events::vertical_scroll{.offset = 1.0}};
+  EXPECT_THROW(std::ignore = fmt::format(fmt::runtime("{:x}"), input_event),
+               fmt::format_error);
+}
+
+TEST(latency_format, should_format_statistics_in_payload_order) {
+  const auto statistics = latency_statistics<durations::nanoseconds, 2UZ>{
+      .payloads = {{
+          {.count = 3U,
+           .p50 = durations::nanoseconds{10.0},
+           .p95 = durations::nanoseconds{20.0},
+           .p99 = durations::nanoseconds{20.0},
+           .max = durations::nanoseconds{30.0}},
+          {},
+      }},
+      .depth = {.count = 2U, .p50 = 1U, .p95 = 4U, .p99 = 4U, .max = 4U},
+  };
+  EXPECT_EQ(R"("input-latency": {"depth": {"count": 2, "p50": 1, "p95": 4, )"
+            R"("p99": 4, "max": 4}, "payloads": [{"count": 3, "p50": 10 ns, )"
+            R"("p95": 20 ns, "p99": 20 ns, "max": 30 ns}, {"count": 0, )"
+            R"("p50": 0 ns, "p95": 0 ns, "p99": 0 ns, "max": 0 ns}]})",
+            fmt::format("{:c}", statistics));
+  EXPECT_EQ(R"("input-latency": {
+    "depth": {"count": 2, "p50": 1, "p95": 4, "p99": 4, "max": 4},
+    "payloads": [
+        {"count": 3, "p50": 10 ns, "p95": 20 ns, "p99": 20 ns, "max": 30 ns},
+        {"count": 0, "p50": 0 ns, "p95": 0 ns, "p99": 0 ns, "max": 0 ns}
+    ]
+})",
+            fmt::format("{}", statistics));
+}
@@ -0,0 +1,101 @@
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/event_formatters.hpp>
+#include <jage/engine/input/event_log.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using jage::engine::input::event_log;
+using jage::engine::input::mouse::events::vertical_scroll;
+
+namespace {
+auto scroll(const double offset) -> event_type {
+  return {.timestamp = duration_type{offset},
+          .payload = vertical_scroll{.offset = offset}};
+}
+} // namespace
+
+TEST(event_log, should_reject_zero_capacity) {
+  EXPECT_THROW(event_log<event_type>{0UZ}, std::invalid_argument);
+}
+
+TEST(event_log, should_format_rows_as_single_lines) {
+  auto sut = event_log<event_type>{4UZ};
+  sut.push(scroll(1.0));
+
+  EXPECT_EQ(1UZ, sut.size());
+  EXPECT_EQ(R"([0]: "input-event": {"timestamp": 1 ns, )"
+            R"("vertical-scroll": {"offset": 1}})",
+            sut.text(0UZ));
+}
+
+TEST(event_log, should_keep_only_the_newest_events_once_full) {
+  auto sut = event_log<event_type>{3UZ};
+  for (auto offset = 0; offset < 5; ++offset) {
+    sut.push(scroll(offset));
+  }
+
+  EXPECT_EQ(3UZ, sut.size());
+  EXPECT_EQ(5UZ, sut.pushed());
+  EXPECT_EQ(2UZ, sut.sequence(0UZ));
+  EXPECT_EQ(2.0, sut.event(0UZ).timestamp.count());
+  EXPECT_EQ(4.0, sut.event(2UZ).timestamp.count());
+  EXPECT_TRUE(sut.text(0UZ).starts_with("[2]: "));
+  EXPECT_TRUE(sut.text(2UZ).starts_with("[4]: "));
+}
+
+TEST(event_log, should_format_nothing_until_a_row_is_asked_for) {
+  auto sut = event_log<event_type>{100'000UZ};
+  for (auto offset = 0; offset < 100'000; ++offset) {
+    sut.push(scroll(offset));
+  }
+  EXPECT_EQ(0UZ, sut.formatted_rows());
+
+  std::ignore = sut.text(99'999UZ);
+  EXPECT_EQ(1UZ, sut.formatted_rows());
+}
+
+TEST(event_log, should_reuse_cached_rows) {
+  auto sut = event_log<event_type>{8UZ};
+  sut.push(scroll(1.0));
+  sut.push(scroll(2.0));
+
+  const auto first = std::string{sut.text(0UZ)};
+  std::ignore = sut.text(1UZ);
+  EXPECT_EQ(first, sut.text(0UZ));
+  EXPECT_EQ(2UZ, sut.formatted_rows());
+}
+
+TEST(event_log, should_keep_rows_after_the_log_wraps) {
+  auto sut = event_log<event_type>{2UZ};
+  sut.push(scroll(1.0));
+  sut.push(scroll(2.0));
+  const auto newest = std::string{sut.text(1UZ)};
+
+  sut.push(scroll(3.0));
+  EXPECT_EQ(newest, sut.text(0UZ));
+  EXPECT_EQ(1UZ, sut.formatted_rows());
+  EXPECT_TRUE(sut.text(1UZ).starts_with("[2]: "));
+}
+
+TEST(event_log, should_format_rows_again_once_evicted_from_cache) {
+  auto sut = event_log<event_type>{1'024UZ};
+  for (auto offset = 0; offset < 1'024; ++offset) {
+    sut.push(scroll(offset));
+  }
+  std::ignore = sut.text(0UZ);
+  std::ignore = sut.text(512UZ);
+  const auto text = std::string{sut.text(0UZ)};
+
+  EXPECT_EQ(3UZ, sut.formatted_rows());
+  EXPECT_TRUE(text.starts_with("[0]: "));
+}
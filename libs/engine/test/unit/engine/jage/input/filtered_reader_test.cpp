@@ -0,0 +1,230 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/filtered_reader.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/cursor/position.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/stdx/overloaded.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <variant>
+
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using ring_type = jage::engine::containers::spmc::ring_buffer<event_type, 8UZ>;
+using jage::engine::input::filtered_reader;
+using jage::engine::input::keyboard::events::key_press;
+using jage::engine::input::mouse::events::vertical_scroll;
+using jage::engine::input::mouse::events::cursor::motion;
+using jage::engine::input::mouse::events::cursor::position;
+namespace keyboard = jage::engine::input::keyboard;
+
+namespace {
+auto make_event(const double timestamp, const auto &payload) -> event_type {
+  return {.timestamp = duration_type{timestamp}, .payload = payload};
+}
+
+auto make_key(const double timestamp) -> event_type {
+  return make_event(timestamp, key_press{
+                                   .key = keyboard::key::w,
+                                   .scancode = keyboard::scancode::w,
+                                   .action = keyboard::action::press,
+                                   .modifiers = {},
+                               });
+}
+
+auto make_motion(const double timestamp, const double delta_x)
+    -> event_type {
+  return make_event(timestamp, motion{.delta_x = delta_x, .delta_y = 0.0});
+}
+
+// Lets the producer lap the reader between its write head load and the tag
+// read of the next slot.
+struct lapping_ring {
+  mutable ring_type ring{};
+  mutable std::size_t keys_on_next_tag{};
+
+  [[nodiscard]] auto capacity() const { return ring.capacity(); }
+  [[nodiscard]] auto write_head() const { return ring.write_head(); }
+  [[nodiscard]] auto read(const std::size_t index) const {
+    return ring.read(index);
+  }
+  [[nodiscard]] auto tag(const std::size_t index) const -> std::uint8_t {
+    for (; 0UZ != keys_on_next_tag; --keys_on_next_tag) {
+      ring.push(make_key(10.0));
+    }
+    return ring.tag(index);
+  }
+};
+} // namespace
+
+class input_filtered_reader : public ::testing::Test {
+protected:
+  ring_type ring{};
+};
+
+TEST_F(input_filtered_reader, should_yield_only_accepted_payloads_in_order) {
+  auto camera = filtered_reader<motion>{};
+  ring.push(make_key(1.0));
+  ring.push(make_motion(2.0, 1.0));
+  ring.push(make_event(3.0, vertical_scroll{.offset = 1.0}));
+  ring.push(make_motion(4.0, 2.0));
+
+  const auto first = camera.next(ring);
+  const auto second = camera.next(ring);
+
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  EXPECT_EQ(2.0, first->timestamp.count());
+  EXPECT_EQ(1.0, std::get<motion>(first->payload).delta_x);
+  EXPECT_EQ(2.0, std::get<motion>(second->payload).delta_x);
+  EXPECT_FALSE(camera.next(ring).has_value());
+  EXPECT_EQ(4UZ, camera.read_index());
+}
+
+TEST_F(input_filtered_reader, should_pick_up_events_pushed_after_catching_up) {
+  auto camera = filtered_reader<motion>{};
+  EXPECT_FALSE(camera.next(ring).has_value());
+
+  ring.push(make_motion(1.0, 3.0));
+
+  const auto pushed = camera.next(ring);
+  ASSERT_TRUE(pushed.has_value());
+  EXPECT_EQ(3.0, std::get<motion>(pushed->payload).delta_x);
+}
+
+TEST_F(input_filtered_reader, should_start_at_write_head_of_ring) {
+  ring.push(make_motion(1.0, 1.0));
+  auto camera = filtered_reader<motion>{ring};
+  ring.push(make_motion(2.0, 2.0));
+
+  const auto pushed = camera.next(ring);
+  ASSERT_TRUE(pushed.has_value());
+  EXPECT_EQ(2.0, pushed->timestamp.count());
+}
+
+TEST_F(input_filtered_reader, should_accept_several_payload_types) {
+  auto cursor = filtered_reader<motion, position>{};
+  ring.push(make_motion(1.0, 1.0));
+  ring.push(make_key(2.0));
+  ring.push(make_event(3.0, position{.x = 4.0, .y = 5.0}));
+
+  const auto first = cursor.next(ring);
+  const auto second = cursor.next(ring);
+
+  ASSERT_TRUE(first.has_value());
+  ASSERT_TRUE(second.has_value());
+  EXPECT_TRUE(std::holds_alternative<motion>(first->payload));
+  EXPECT_TRUE(std::holds_alternative<position>(second->payload));
+  EXPECT_FALSE(cursor.next(ring).has_value());
+}
+
+TEST_F(input_filtered_reader, should_drain_payloads_to_handler) {
+  auto cursor = filtered_reader<motion, position>{};
+  ring.push(make_motion(1.0, 1.5));
+  ring.push(make_key(2.0));
+  ring.push(make_event(3.0, position{.x = 4.0, .y = 5.0}));
+  ring.push(make_motion(4.0, 2.5));
+
+  auto total_x = 0.0;
+  auto latest = 0.0;
+  auto cursor_x = 0.0;
+  const auto handled = cursor.drain(
+      ring, jage::stdx::overloaded{
+                [&](const motion &delta, const duration_type timestamp) {
+                  total_x += delta.delta_x;
+                  latest = timestamp.count();
+                },
+                [&](const position &at) { cursor_x = at.x; },
+            });
+
+  EXPECT_EQ(3UZ, handled);
+  EXPECT_EQ(4.0, total_x);
+  EXPECT_EQ(4.0, latest);
+  EXPECT_EQ(4.0, cursor_x);
+}
+
+TEST_F(input_filtered_reader, should_skip_ahead_and_count_drops_when_lapped) {
+  auto camera = filtered_reader<motion>{};
+  for (auto index = 0UZ; index < 12UZ; ++index) {
+    ring.push(make_motion(static_cast<double>(index), 0.0));
+  }
+
+  const auto oldest = camera.next(ring);
+
+  ASSERT_TRUE(oldest.has_value());
+  EXPECT_EQ(5.0, oldest->timestamp.count());
+  EXPECT_EQ(5U, camera.dropped());
+}
+
+TEST_F(input_filtered_reader,
+       should_count_event_overwritten_before_its_tag_was_read) {
+  auto lapping = lapping_ring{};
+  auto camera = filtered_reader<motion>{};
+  lapping.ring.push(make_motion(1.0, 1.0));
+  lapping.keys_on_next_tag = lapping.capacity();
+
+  EXPECT_FALSE(camera.next(lapping).has_value());
+  EXPECT_EQ(2U, camera.dropped());
+
+  lapping.ring.push(make_motion(11.0, 2.0));
+  const auto latest = camera.next(lapping);
+  ASSERT_TRUE(latest.has_value());
+  EXPECT_EQ(11.0, latest->timestamp.count());
+}
+
+TEST_F(input_filtered_reader, should_keep_readers_independent) {
+  auto camera = filtered_reader<motion>{};
+  auto keys = filtered_reader<key_press>{};
+  ring.push(make_key(1.0));
+  ring.push(make_motion(2.0, 1.0));
+
+  ASSERT_TRUE(camera.next(ring).has_value());
+  const auto key = keys.next(ring);
+  ASSERT_TRUE(key.has_value());
+  EXPECT_EQ(1.0, key->timestamp.count());
+}
+
+TEST(input_filtered_reader_thread, should_see_every_motion_when_not_lapped) {
+  static constexpr auto event_count = 20'000UZ;
+  auto ring =
+      jage::engine::containers::spmc::ring_buffer<event_type, 32'768UZ>{};
+  auto done = std::atomic<bool>{false};
+  auto motions = 0UZ;
+  auto total_x = 0.0;
+  auto camera = filtered_reader<motion>{ring};
+  auto consumer = std::thread{[&] {
+    const auto drain = [&] {
+      for (auto pushed = camera.next(ring); pushed;
+           pushed = camera.next(ring)) {
+        ++motions;
+        total_x += std::get<motion>(pushed->payload).delta_x;
+      }
+    };
+    while (not done.load(std::memory_order::acquire)) {
+      drain();
+    }
+    drain();
+  }};
+  for (auto index = 0UZ; index < event_count; ++index) {
+    const auto timestamp = static_cast<double>(index);
+    ring.push(index % 3UZ == 0UZ ? make_motion(timestamp, 1.0)
+                                 : make_key(timestamp));
+  }
+  done.store(true, std::memory_order::release);
+  consumer.join();
+
+  EXPECT_EQ((event_count + 2UZ) / 3UZ, motions);
+  EXPECT_EQ(static_cast<double>(motions), total_x);
+  EXPECT_EQ(0U, camera.dropped());
+}
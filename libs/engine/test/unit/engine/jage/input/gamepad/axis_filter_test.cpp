@@ -0,0 +1,42 @@
+#include <jage/engine/input/gamepad/axis.hpp>
+#include <jage/engine/input/gamepad/axis_filter.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+using jage::engine::input::gamepad::axis;
+using jage::engine::input::gamepad::axis_filter;
+
+TEST(gamepad_axis_filter, should_snap_readings_inside_dead_zone_to_rest) {
+  constexpr auto filter = axis_filter{.dead_zone = 0.2, .levels = 100};
+  static_assert(0 == filter.quantize(axis::left_x, 0.2));
+  EXPECT_EQ(0, filter.quantize(axis::left_x, -0.19));
+  EXPECT_EQ(0, filter.quantize(axis::right_y, 0.0));
+}
+
+TEST(gamepad_axis_filter, should_rescale_range_outside_dead_zone) {
+  constexpr auto filter = axis_filter{.dead_zone = 0.2, .levels = 100};
+  EXPECT_EQ(1, filter.quantize(axis::left_x, 0.208));
+  EXPECT_EQ(50, filter.quantize(axis::left_x, 0.6));
+  EXPECT_EQ(-100, filter.quantize(axis::left_y, -1.0));
+}
+
+TEST(gamepad_axis_filter, should_clamp_readings_past_full_deflection) {
+  constexpr auto filter = axis_filter{};
+  EXPECT_EQ(filter.levels, filter.quantize(axis::right_x, 1.5));
+  EXPECT_EQ(-filter.levels, filter.quantize(axis::right_x, -1.5));
+}
+
+TEST(gamepad_axis_filter, should_measure_triggers_from_rest_at_minus_one) {
+  constexpr auto filter = axis_filter{.dead_zone = 0.1, .levels = 10};
+  EXPECT_EQ(0, filter.quantize(axis::left_trigger, -1.0));
+  EXPECT_EQ(10, filter.quantize(axis::right_trigger, 1.0));
+  EXPECT_EQ(4, filter.quantize(axis::right_trigger, 0.0));
+}
+
+TEST(gamepad_axis_filter, should_convert_levels_back_to_positions) {
+  constexpr auto filter = axis_filter{.dead_zone = 0.1, .levels = 4};
+  EXPECT_EQ(-0.25, filter.value(std::int16_t{-1}));
+  EXPECT_EQ(1.0, filter.value(std::int16_t{4}));
+}
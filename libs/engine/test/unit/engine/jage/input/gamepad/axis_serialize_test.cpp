@@ -0,0 +1,46 @@
+#include <jage/engine/input/gamepad/axis.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <fmt/format.h>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using jage::engine::input::gamepad::axis;
+using jage::engine::input::gamepad::serialize;
+using test_parameter_type = std::pair<axis, std::string>;
+
+struct input_gamepad_axis_serialize_test
+    : public testing::TestWithParam<test_parameter_type> {};
+
+TEST_P(input_gamepad_axis_serialize_test,
+       should_serialize_axis_to_enum_member_name) {
+  const auto &[input, expected] = GetParam();
+  EXPECT_EQ(serialize(input), expected);
+}
+
+static constexpr auto unknown_axis_enumerator = static_cast<axis>(
+    std::numeric_limits<std::underlying_type_t<axis>>::max());
+
+const auto test_parameters = std::vector<test_parameter_type>{
+    {axis::left_x, "left_x"},
+    {axis::left_y, "left_y"},
+    {axis::right_x, "right_x"},
+    {axis::right_y, "right_y"},
+    {axis::left_trigger, "left_trigger"},
+    {axis::right_trigger, "right_trigger"},
+    {unknown_axis_enumerator, "unknown enumerator"},
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    input_gamepad_axis_serialize, input_gamepad_axis_serialize_test,
+    testing::ValuesIn(test_parameters), [](const auto &info) -> std::string {
+      auto expected = info.param.second;
+      std::replace(std::begin(expected), std::end(expected), ' ', '_');
+      return fmt::format("input_{}_expected_{}",
+                         std::to_underlying(info.param.first), expected);
+    });
@@ -0,0 +1,55 @@
+#include <jage/engine/input/gamepad/button.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <fmt/format.h>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using jage::engine::input::gamepad::button;
+using jage::engine::input::gamepad::serialize;
+using test_parameter_type = std::pair<button, std::string>;
+
+struct input_gamepad_button_serialize_test
+    : public testing::TestWithParam<test_parameter_type> {};
+
+TEST_P(input_gamepad_button_serialize_test,
+       should_serialize_button_to_enum_member_name) {
+  const auto &[input, expected] = GetParam();
+  EXPECT_EQ(serialize(input), expected);
+}
+
+static constexpr auto unknown_button_enumerator = static_cast<button>(
+    std::numeric_limits<std::underlying_type_t<button>>::max());
+
+const auto test_parameters = std::vector<test_parameter_type>{
+    {button::a, "a"},
+    {button::b, "b"},
+    {button::x, "x"},
+    {button::y, "y"},
+    {button::left_bumper, "left_bumper"},
+    {button::right_bumper, "right_bumper"},
+    {button::back, "back"},
+    {button::start, "start"},
+    {button::guide, "guide"},
+    {button::left_thumb, "left_thumb"},
+    {button::right_thumb, "right_thumb"},
+    {button::dpad_up, "dpad_up"},
+    {button::dpad_right, "dpad_right"},
+    {button::dpad_down, "dpad_down"},
+    {button::dpad_left, "dpad_left"},
+    {unknown_button_enumerator, "unknown enumerator"},
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    input_gamepad_button_serialize, input_gamepad_button_serialize_test,
+    testing::ValuesIn(test_parameters), [](const auto &info) -> std::string {
+      auto expected = info.param.second;
+      std::replace(std::begin(expected), std::end(expected), ' ', '_');
+      return fmt::format("input_{}_expected_{}",
+                         std::to_underlying(info.param.first), expected);
+    });
@@ -0,0 +1,135 @@
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/latency_statistics.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/test/fakes/concurrency/atomic.hpp>
+#include <jage/engine/test/fakes/concurrency/double_buffer.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <jage/engine/input/internal/latency_probe.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using jage::engine::input::keyboard::events::key_press;
+using jage::engine::input::mouse::events::click;
+using jage::engine::input::mouse::events::cursor::motion;
+using jage::engine::time::operator""_ns;
+
+namespace fakes {
+using jage::engine::test::fakes::concurrency::atomic;
+using jage::engine::test::fakes::concurrency::double_buffer;
+} // namespace fakes
+
+template <bool Enabled>
+using probe_type =
+    jage::engine::input::internal::latency_probe<event_type, Enabled,
+                                                 fakes::double_buffer,
+                                                 fakes::atomic>;
+using statistics_type = probe_type<true>::statistics_type;
+
+namespace {
+template <class TPayload> constexpr auto payload_index() -> std::size_t {
+  return event_type::payload_type{TPayload{}}.index();
+}
+} // namespace
+
+TEST(latency_probe, should_publish_empty_statistics_before_any_drain) {
+  auto probe = probe_type<true>{};
+  probe.publish();
+  EXPECT_EQ(statistics_type{}, probe.read());
+}
+
+TEST(latency_probe, should_record_event_age_by_payload_type) {
+  auto probe = probe_type<true>{};
+  probe.start_drain([] { return 1'000_ns; }, 3UZ);
+  probe.record({.timestamp = 990_ns, .payload = motion{}});
+  probe.record({.timestamp = 975_ns, .payload = key_press{}});
+  probe.record({.timestamp = 980_ns, .payload = motion{}});
+  probe.publish();
+
+  const auto statistics = probe.read();
+  const auto &motions = statistics.payloads[payload_index<motion>()];
+  EXPECT_EQ(2U, motions.count);
+  EXPECT_EQ(10_ns, motions.p50);
+  EXPECT_EQ(20_ns, motions.max);
+  const auto &key_presses = statistics.payloads[payload_index<key_press>()];
+  EXPECT_EQ(1U, key_presses.count);
+  EXPECT_EQ(25_ns, key_presses.max);
+  EXPECT_EQ(0U, statistics.payloads[payload_index<click>()].count);
+}
+
+TEST(latency_probe, should_record_ring_depth_once_per_drain) {
+  auto probe = probe_type<true>{};
+  probe.start_drain([] { return 0_ns; }, 1UZ);
+  probe.start_drain([] { return 0_ns; }, 4UZ);
+  probe.start_drain([] { return 0_ns; }, 0UZ);
+  probe.publish();
+
+  const auto depth = probe.read().depth;
+  EXPECT_EQ(3U, depth.count);
+  EXPECT_EQ(1U, depth.p50);
+  EXPECT_EQ(4U, depth.max);
+}
+
+TEST(latency_probe, should_measure_every_record_against_the_drain_time) {
+  auto probe = probe_type<true>{};
+  probe.start_drain([] { return 100_ns; }, 1UZ);
+  probe.record({.timestamp = 90_ns, .payload = click{}});
+  probe.start_drain([] { return 200_ns; }, 1UZ);
+  probe.record({.timestamp = 170_ns, .payload = click{}});
+  probe.publish();
+
+  const auto clicks = probe.read().payloads[payload_index<click>()];
+  EXPECT_EQ(2U, clicks.count);
+  EXPECT_EQ(10_ns, clicks.p50);
+  EXPECT_EQ(30_ns, clicks.max);
+}
+
+TEST(latency_probe, should_count_events_stamped_after_the_drain_as_zero) {
+  auto probe = probe_type<true>{};
+  probe.start_drain([] { return 100_ns; }, 1UZ);
+  probe.record({.timestamp = 150_ns, .payload = click{}});
+  probe.publish();
+
+  const auto clicks = probe.read().payloads[payload_index<click>()];
+  EXPECT_EQ(1U, clicks.count);
+  EXPECT_EQ(0_ns, clicks.max);
+}
+
+TEST(latency_probe, should_keep_published_statistics_until_next_publish) {
+  auto probe = probe_type<true>{};
+  probe.start_drain([] { return 100_ns; }, 2UZ);
+  probe.record({.timestamp = 90_ns, .payload = click{}});
+  probe.publish();
+  const auto published = probe.read();
+
+  probe.reset();
+  EXPECT_EQ(published, probe.read());
+  probe.publish();
+  EXPECT_EQ(statistics_type{}, probe.read());
+}
+
+TEST(latency_probe, should_hold_nothing_and_never_read_the_time_when_disabled) {
+  static_assert(std::is_empty_v<probe_type<false>>);
+  static_assert(not probe_type<false>::enabled);
+  auto probe = probe_type<false>{};
+  auto reads = 0UZ;
+  probe.start_drain(
+      [&] {
+        ++reads;
+        return 100_ns;
+      },
+      3UZ);
+  probe.record({.timestamp = 90_ns, .payload = click{}});
+  probe.publish();
+  EXPECT_EQ(0UZ, reads);
+  EXPECT_EQ(statistics_type{}, probe.read());
+}
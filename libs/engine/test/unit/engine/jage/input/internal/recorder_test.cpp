@@ -0,0 +1,314 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/encoded_event.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/recording.hpp>
+#include <jage/engine/test/fakes/input/recording/writer.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+#include <jage/engine/time/snapshot_cache.hpp>
+
+#include <jage/engine/input/internal/recorder.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <thread>
+#include <variant>
+#include <vector>
+
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using snapshot_type = jage::engine::time::events::snapshot<duration_type>;
+using ring_type = jage::engine::containers::spmc::ring_buffer<event_type, 8UZ>;
+using cache_type = jage::engine::time::snapshot_cache<4UZ, duration_type>;
+using writer_type = jage::engine::test::fakes::input::recording::writer;
+using recorder_type =
+    jage::engine::input::internal::recorder<ring_type, cache_type,
+                                            writer_type>;
+
+using jage::engine::input::keyboard::events::key_press;
+using jage::engine::input::mouse::events::cursor::motion;
+using jage::engine::time::operator""_ns;
+namespace recording = jage::engine::input::recording;
+
+namespace {
+struct parsed_recording {
+  recording::file_header header{};
+  std::vector<event_type> events{};
+  std::vector<snapshot_type> snapshots{};
+  std::vector<std::uint64_t> dropped{};
+  std::vector<recording::record_kind> kinds{};
+};
+
+template <class T>
+auto read_as(const std::vector<std::byte> &bytes, const std::size_t offset)
+    -> T {
+  auto value = T{};
+  std::memcpy(&value, std::data(bytes) + offset, sizeof(T));
+  return value;
+}
+
+auto parse(const std::vector<std::byte> &bytes) -> parsed_recording {
+  auto parsed = parsed_recording{
+      .header = read_as<recording::file_header>(bytes, 0UZ),
+  };
+  for (auto offset = sizeof(recording::file_header);
+       offset < std::size(bytes);) {
+    const auto header = read_as<recording::record_header>(bytes, offset);
+    offset += sizeof(header);
+    parsed.kinds.push_back(header.kind);
+    switch (header.kind) {
+    case recording::record_kind::event:
+      parsed.events.push_back(jage::engine::input::decode<duration_type>(
+          read_as<jage::engine::input::encoded_event>(bytes, offset)));
+      break;
+    case recording::record_kind::snapshot:
+      parsed.snapshots.push_back(recording::decode<duration_type>(
+          read_as<recording::snapshot_record>(bytes, offset)));
+      break;
+    case recording::record_kind::dropped:
+      parsed.dropped.push_back(
+          read_as<recording::dropped_record>(bytes, offset).count);
+      break;
+    }
+    offset += recording::size_of(header.kind);
+  }
+  return parsed;
+}
+
+auto make_motion(const double timestamp) -> event_type {
+  return {
+      .timestamp = duration_type{timestamp},
+      .payload = motion{.delta_x = timestamp, .delta_y = -timestamp},
+  };
+}
+} // namespace
+
+class recorder : public ::testing::Test {
+protected:
+  ring_type ring{};
+  cache_type cache{};
+};
+
+TEST_F(recorder, should_write_file_header_on_flush) {
+  auto subject = recorder_type{ring, cache};
+  EXPECT_TRUE(std::empty(subject.writer().bytes));
+
+  subject.flush();
+
+  const auto parsed = parse(subject.writer().bytes);
+  EXPECT_EQ(recording::header<duration_type>(), parsed.header);
+  EXPECT_EQ(1, parsed.header.period_numerator);
+  EXPECT_EQ(1'000'000'000, parsed.header.period_denominator);
+  EXPECT_TRUE(std::empty(parsed.kinds));
+}
+
+TEST_F(recorder, should_record_pushed_events_in_order) {
+  auto subject = recorder_type{ring, cache};
+  ring.push(make_motion(1.0));
+  ring.push({.timestamp = 2_ns, .payload = key_press{}});
+  ring.push(make_motion(3.0));
+
+  EXPECT_EQ(3UZ, subject.poll());
+  subject.flush();
+
+  const auto parsed = parse(subject.writer().bytes);
+  ASSERT_EQ(3UZ, std::size(parsed.events));
+  EXPECT_EQ(jage::engine::input::encode(make_motion(1.0)),
+            jage::engine::input::encode(parsed.events[0]));
+  EXPECT_TRUE(std::holds_alternative<key_press>(parsed.events[1].payload));
+  EXPECT_EQ(3_ns, parsed.events[2].timestamp);
+  EXPECT_EQ(3UZ, subject.recorded_events());
+}
+
+TEST_F(recorder, should_only_record_events_published_after_attaching) {
+  ring.push(make_motion(1.0));
+  auto subject = recorder_type{ring, cache};
+  ring.push(make_motion(2.0));
+
+  subject.poll();
+  subject.flush();
+
+  const auto parsed = parse(subject.writer().bytes);
+  ASSERT_EQ(1UZ, std::size(parsed.events));
+  EXPECT_EQ(2_ns, parsed.events[0].timestamp);
+}
+
+TEST_F(recorder, should_return_zero_when_nothing_was_published) {
+  auto subject = recorder_type{ring, cache};
+  ring.push(make_motion(1.0));
+  subject.poll();
+
+  EXPECT_EQ(0UZ, subject.poll());
+}
+
+TEST_F(recorder, should_interleave_snapshots_by_real_time) {
+  auto subject = recorder_type{ring, cache};
+  cache.push(snapshot_type{.real_time = 0_ns, .frame = 0});
+  ring.push(make_motion(1.0));
+  ring.push(make_motion(1.5));
+  cache.push(snapshot_type{.real_time = 2_ns, .frame = 1});
+  ring.push(make_motion(3.0));
+  cache.push(snapshot_type{.real_time = 4_ns, .frame = 2});
+
+  EXPECT_EQ(6UZ, subject.poll());
+  subject.flush();
+
+  using enum recording::record_kind;
+  const auto parsed = parse(subject.writer().bytes);
+  EXPECT_EQ((std::vector{snapshot, event, event, snapshot, event, snapshot}),
+            parsed.kinds);
+  ASSERT_EQ(3UZ, std::size(parsed.snapshots));
+  EXPECT_EQ(2, parsed.snapshots[2].frame);
+  EXPECT_EQ(3UZ, subject.recorded_snapshots());
+}
+
+TEST_F(recorder, should_round_trip_snapshots) {
+  auto subject = recorder_type{ring, cache};
+  const auto original = snapshot_type{
+      .real_time = 12.5_ns,
+      .tick_duration = 16'666'666.5_ns,
+      .time_scale = 0.25,
+      .elapsed_time = 3_ns,
+      .elapsed_frames = 7,
+      .frame = 9,
+      .accumulated_time = 1.5_ns,
+  };
+  cache.push(original);
+
+  subject.poll();
+  subject.flush();
+
+  const auto parsed = parse(subject.writer().bytes);
+  ASSERT_EQ(1UZ, std::size(parsed.snapshots));
+  EXPECT_EQ(original, parsed.snapshots[0]);
+}
+
+TEST_F(recorder, should_skip_snapshots_overwritten_in_the_cache) {
+  auto subject = recorder_type{ring, cache};
+  for (auto frame = 0UZ; frame < 10UZ; ++frame) {
+    cache.push(snapshot_type{
+        .real_time = duration_type{static_cast<double>(frame)},
+        .frame = frame,
+    });
+  }
+
+  subject.poll();
+  subject.flush();
+
+  const auto parsed = parse(subject.writer().bytes);
+  ASSERT_EQ(3UZ, std::size(parsed.snapshots));
+  EXPECT_EQ(7, parsed.snapshots[0].frame);
+  EXPECT_EQ(9, parsed.snapshots[2].frame);
+}
+
+TEST_F(recorder, should_report_dropped_events_when_lapped) {
+  auto subject = recorder_type{ring, cache};
+  for (auto index = 0UZ; index < 20UZ; ++index) {
+    ring.push(make_motion(static_cast<double>(index)));
+  }
+
+  EXPECT_EQ(20UZ, subject.poll());
+  subject.flush();
+
+  const auto parsed = parse(subject.writer().bytes);
+  EXPECT_EQ(std::vector<std::uint64_t>{13U}, parsed.dropped);
+  EXPECT_EQ(recording::record_kind::dropped, parsed.kinds.front());
+  ASSERT_EQ(7UZ, std::size(parsed.events));
+  EXPECT_EQ(13_ns, parsed.events.front().timestamp);
+  EXPECT_EQ(19_ns, parsed.events.back().timestamp);
+  EXPECT_EQ(13U, subject.dropped_events());
+  EXPECT_EQ(7U, subject.recorded_events());
+}
+
+TEST_F(recorder, should_not_report_drops_when_keeping_up) {
+  auto subject = recorder_type{ring, cache};
+  for (auto index = 0UZ; index < 100UZ; ++index) {
+    ring.push(make_motion(static_cast<double>(index)));
+    subject.poll();
+  }
+  subject.flush();
+
+  const auto parsed = parse(subject.writer().bytes);
+  EXPECT_TRUE(std::empty(parsed.dropped));
+  EXPECT_EQ(100UZ, std::size(parsed.events));
+  EXPECT_EQ(0U, subject.dropped_events());
+}
+
+TEST_F(recorder, should_hand_blocks_of_at_most_64_kib_to_the_writer) {
+  auto subject = recorder_type{ring, cache};
+  static constexpr auto event_record_size =
+      sizeof(recording::record_header) +
+      sizeof(jage::engine::input::encoded_event);
+  static constexpr auto event_count = 2UZ * 64UZ * 1024UZ / event_record_size;
+  for (auto index = 0UZ; index < event_count; ++index) {
+    ring.push(make_motion(static_cast<double>(index)));
+    subject.poll();
+  }
+  EXPECT_EQ(2UZ, subject.writer().writes);
+  EXPECT_LE(std::size(subject.writer().bytes), 2UZ * 64UZ * 1024UZ);
+
+  subject.flush();
+
+  const auto parsed = parse(subject.writer().bytes);
+  EXPECT_EQ(event_count, std::size(parsed.events));
+  EXPECT_EQ(duration_type{static_cast<double>(event_count - 1UZ)},
+            parsed.events.back().timestamp);
+}
+
+TEST(recorder_thread, should_record_everything_published_while_running) {
+  static constexpr auto event_count = 2000UZ;
+  // Twice the events, so the producer cannot lap the recorder even if it
+  // finishes before the recorder thread is first scheduled.
+  auto ring = jage::engine::containers::spmc::ring_buffer<event_type,
+                                                          2UZ * event_count>{};
+  auto cache = jage::engine::time::snapshot_cache<32UZ, duration_type>{};
+  auto subject =
+      jage::engine::input::internal::recorder<decltype(ring), decltype(cache),
+                                              writer_type>{ring, cache};
+
+  subject.start(std::chrono::microseconds{50});
+  EXPECT_TRUE(subject.is_running());
+  for (auto index = 0UZ; index < event_count; ++index) {
+    ring.push(make_motion(static_cast<double>(index)));
+    if (0UZ == index % 100UZ) {
+      cache.push(snapshot_type{
+          .real_time = duration_type{static_cast<double>(index)},
+          .frame = index / 100UZ,
+      });
+      std::this_thread::yield();
+    }
+  }
+  subject.stop();
+  EXPECT_FALSE(subject.is_running());
+
+  const auto parsed = parse(subject.writer().bytes);
+  ASSERT_EQ(event_count, std::size(parsed.events));
+  for (auto index = 0UZ; index < event_count; ++index) {
+    EXPECT_EQ(duration_type{static_cast<double>(index)},
+              parsed.events[index].timestamp);
+  }
+  EXPECT_EQ(0U, subject.dropped_events());
+  EXPECT_EQ(event_count, subject.recorded_events());
+  EXPECT_EQ(20U, subject.recorded_snapshots());
+}
+
+TEST(recorder_thread, should_flush_partial_block_when_stopped) {
+  auto ring = ring_type{};
+  auto cache = cache_type{};
+  auto subject = recorder_type{ring, cache};
+  subject.start();
+  ring.push(make_motion(1.0));
+  ring.push(make_motion(2.0));
+
+  subject.stop();
+
+  EXPECT_EQ(1UZ, subject.writer().writes);
+  EXPECT_EQ(2UZ, std::size(parse(subject.writer().bytes).events));
+}
@@ -0,0 +1,104 @@
+#include <jage/engine/input/contexts/coalescing.hpp>
+#include <jage/engine/input/contexts/glfw.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/gamepad/axis.hpp>
+#include <jage/engine/input/gamepad/events/axis_motion.hpp>
+#include <jage/engine/input/merged_sink.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/input/window_id.hpp>
+#include <jage/engine/test/fakes/containers/event_sink.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/virtual_clock.hpp>
+
+#include <gtest/gtest.h>
+
+#include <variant>
+
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using ring_type = jage::engine::test::fakes::containers::event_sink<event_type>;
+using merged_sink_type =
+    jage::engine::input::merged_sink<duration_type, ring_type>;
+using time_source_type = jage::engine::time::virtual_time_source<duration_type>;
+using context_type = jage::engine::input::contexts::glfw<
+    duration_type, merged_sink_type, time_source_type,
+    jage::engine::input::contexts::coalescing::none>;
+using motion_type = jage::engine::input::mouse::events::cursor::motion;
+using scroll_type = jage::engine::input::mouse::events::vertical_scroll;
+using jage::engine::input::window_id;
+
+class merged_sink : public testing::Test {
+protected:
+  ring_type ring;
+  merged_sink_type sink{ring};
+  context_type first{sink, time_source_type{}, window_id{0U}};
+  context_type second{sink, time_source_type{}, window_id{1U}};
+
+  auto push(context_type &context, const double timestamp,
+            const event_type::payload_type &payload) -> void {
+    context.push(event_type{.timestamp = duration_type{timestamp},
+                            .payload = payload});
+  }
+};
+
+TEST_F(merged_sink, should_keep_each_window_on_its_events) {
+  push(first, 1.0, scroll_type{1.0});
+  push(second, 2.0, scroll_type{2.0});
+  ASSERT_EQ(2, ring.events.size());
+  EXPECT_EQ(0U, ring.events[0].window);
+  EXPECT_EQ(1U, ring.events[1].window);
+}
+
+TEST_F(merged_sink, should_push_gamepad_events_with_default_window) {
+  push(second, 1.0,
+       jage::engine::input::gamepad::events::axis_motion{
+           .gamepad = 2U,
+           .axis = jage::engine::input::gamepad::axis::left_x,
+           .value = 0.5,
+       });
+  sink.push(event_type{
+      .timestamp = duration_type{2.0},
+      .payload = jage::engine::input::gamepad::events::axis_motion{},
+      .window = 1U,
+  });
+  ASSERT_EQ(2, ring.events.size());
+  EXPECT_EQ(0U, ring.events[0].window);
+  EXPECT_EQ(0U, ring.events[1].window);
+}
+
+TEST_F(merged_sink, should_coalesce_cursor_runs_within_a_window) {
+  push(first, 1.0, motion_type{1.0, 1.0});
+  push(first, 2.0, motion_type{2.0, 2.0});
+  push(first, 3.0, motion_type{3.0, 3.0});
+  EXPECT_EQ(1, ring.events.size());
+  sink.flush();
+  ASSERT_EQ(2, ring.events.size());
+  EXPECT_DOUBLE_EQ(5.0, std::get<motion_type>(ring.events[1].payload).delta_x);
+}
+
+TEST_F(merged_sink, should_end_a_cursor_run_when_another_window_pushes) {
+  push(first, 1.0, motion_type{1.0, 1.0});
+  push(first, 2.0, motion_type{2.0, 2.0});
+  push(second, 3.0, motion_type{4.0, 4.0});
+  push(second, 4.0, scroll_type{1.0});
+  ASSERT_EQ(4, ring.events.size());
+  EXPECT_EQ(0U, ring.events[1].window);
+  EXPECT_EQ(1U, ring.events[2].window);
+  EXPECT_DOUBLE_EQ(4.0, std::get<motion_type>(ring.events[2].payload).delta_x);
+}
+
+TEST_F(merged_sink, should_publish_interleaved_windows_in_timestamp_order) {
+  push(first, 1.0, motion_type{1.0, 1.0});
+  push(first, 2.0, motion_type{1.0, 1.0});
+  push(second, 3.0, motion_type{1.0, 1.0});
+  push(second, 4.0, motion_type{1.0, 1.0});
+  push(first, 5.0, scroll_type{1.0});
+  push(second, 6.0, motion_type{1.0, 1.0});
+  push(second, 7.0, motion_type{1.0, 1.0});
+  sink.flush();
+  ASSERT_EQ(7, ring.events.size());
+  for (auto index = 1UZ; index < ring.events.size(); ++index) {
+    EXPECT_LT(ring.events[index - 1UZ].timestamp, ring.events[index].timestamp);
+  }
+}
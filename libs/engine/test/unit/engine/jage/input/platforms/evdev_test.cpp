@@ -0,0 +1,262 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/modifier.hpp>
+#include <jage/engine/input/mouse/action.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/horizontal_scroll.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/input/platforms/evdev.hpp>
+#include <jage/engine/test/fakes/containers/event_sink.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include <linux/input.h>
+#include <unistd.h>
+
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using sink_type = jage::engine::test::fakes::containers::event_sink<event_type>;
+
+using jage::engine::input::modifier;
+using jage::engine::input::keyboard::events::key_press;
+using jage::engine::input::mouse::events::click;
+using jage::engine::input::mouse::events::horizontal_scroll;
+using jage::engine::input::mouse::events::vertical_scroll;
+using jage::engine::input::mouse::events::cursor::motion;
+using jage::engine::time::operator""_ns;
+namespace keyboard = jage::engine::input::keyboard;
+namespace mouse = jage::engine::input::mouse;
+
+namespace {
+auto make_input(const std::uint16_t type, const std::uint16_t code,
+                const std::int32_t value, const long microseconds = 0L)
+    -> ::input_event {
+  auto input = ::input_event{};
+  input.input_event_sec = microseconds / 1'000'000L;
+  input.input_event_usec = microseconds % 1'000'000L;
+  input.type = type;
+  input.code = code;
+  input.value = value;
+  return input;
+}
+
+auto make_report(const long microseconds = 0L) -> ::input_event {
+  return make_input(EV_SYN, SYN_REPORT, 0, microseconds);
+}
+} // namespace
+
+template <class TSink> class evdev_fixture : public ::testing::Test {
+protected:
+  TSink sink{};
+  jage::engine::input::platforms::evdev<duration_type, TSink> subject{sink};
+  int write_end{-1};
+
+  auto SetUp() -> void override {
+    auto ends = std::array<int, 2UZ>{};
+    ASSERT_EQ(0, ::pipe(std::data(ends)));
+    subject.add_device(ends[0]);
+    write_end = ends[1];
+  }
+
+  auto TearDown() -> void override {
+    if (-1 != write_end) {
+      ::close(write_end);
+    }
+  }
+
+  auto write_inputs(const auto &...inputs) -> void {
+    const auto records = std::array{inputs...};
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(records)),
+              ::write(write_end, std::data(records), sizeof(records)));
+  }
+};
+
+using evdev = evdev_fixture<sink_type>;
+
+TEST_F(evdev, should_push_nothing_without_input) {
+  EXPECT_EQ(0UZ, subject.poll());
+  EXPECT_TRUE(std::empty(sink.events));
+}
+
+TEST_F(evdev, should_push_key_press_with_kernel_timestamp) {
+  write_inputs(make_input(EV_KEY, KEY_W, 1, 1'500'002L), make_report());
+
+  EXPECT_EQ(1UZ, subject.poll());
+
+  ASSERT_EQ(1UZ, std::size(sink.events));
+  EXPECT_EQ(1'500'002'000_ns, sink.events[0].timestamp);
+  const auto pressed = std::get<key_press>(sink.events[0].payload);
+  EXPECT_EQ(keyboard::scancode::w, pressed.scancode);
+  EXPECT_EQ(keyboard::key::unidentified, pressed.key);
+  EXPECT_EQ(keyboard::action::press, pressed.action);
+}
+
+TEST_F(evdev, should_map_key_values_to_actions) {
+  write_inputs(make_input(EV_KEY, KEY_ESC, 1), make_input(EV_KEY, KEY_ESC, 2),
+               make_input(EV_KEY, KEY_ESC, 0));
+
+  EXPECT_EQ(3UZ, subject.poll());
+
+  ASSERT_EQ(3UZ, std::size(sink.events));
+  EXPECT_EQ(keyboard::action::press,
+            std::get<key_press>(sink.events[0].payload).action);
+  EXPECT_EQ(keyboard::action::repeat,
+            std::get<key_press>(sink.events[1].payload).action);
+  EXPECT_EQ(keyboard::action::release,
+            std::get<key_press>(sink.events[2].payload).action);
+  EXPECT_EQ(keyboard::scancode::escape,
+            std::get<key_press>(sink.events[2].payload).scancode);
+}
+
+TEST_F(evdev, should_track_modifiers_from_held_keys_and_leds) {
+  write_inputs(make_input(EV_KEY, KEY_LEFTCTRL, 1),
+               make_input(EV_LED, LED_CAPSL, 1), make_input(EV_KEY, KEY_S, 1),
+               make_input(EV_KEY, KEY_LEFTCTRL, 0),
+               make_input(EV_KEY, KEY_S, 0));
+
+  subject.poll();
+
+  ASSERT_EQ(4UZ, std::size(sink.events));
+  const auto chorded = std::get<key_press>(sink.events[1].payload);
+  EXPECT_TRUE(chorded.modifiers[std::to_underlying(modifier::left_control)]);
+  EXPECT_TRUE(chorded.modifiers[std::to_underlying(modifier::caps_lock)]);
+  const auto released = std::get<key_press>(sink.events[3].payload);
+  EXPECT_FALSE(released.modifiers[std::to_underlying(modifier::left_control)]);
+}
+
+TEST_F(evdev, should_push_mouse_buttons_as_clicks) {
+  write_inputs(make_input(EV_KEY, BTN_LEFT, 1),
+               make_input(EV_KEY, BTN_SIDE, 0));
+
+  subject.poll();
+
+  ASSERT_EQ(2UZ, std::size(sink.events));
+  const auto left = std::get<click>(sink.events[0].payload);
+  EXPECT_EQ(mouse::button::left, left.button);
+  EXPECT_EQ(mouse::action::press, left.action);
+  const auto side = std::get<click>(sink.events[1].payload);
+  EXPECT_EQ(mouse::button::back, side.button);
+  EXPECT_EQ(mouse::action::release, side.action);
+}
+
+TEST_F(evdev, should_sum_relative_axes_into_one_event_per_report) {
+  write_inputs(make_input(EV_REL, REL_X, 3), make_input(EV_REL, REL_Y, -2),
+               make_input(EV_REL, REL_X, 4), make_input(EV_REL, REL_WHEEL, 1),
+               make_input(EV_REL, REL_HWHEEL, -1));
+  EXPECT_EQ(0UZ, subject.poll());
+
+  write_inputs(make_report(20L));
+  EXPECT_EQ(3UZ, subject.poll());
+
+  ASSERT_EQ(3UZ, std::size(sink.events));
+  const auto moved = std::get<motion>(sink.events[0].payload);
+  EXPECT_EQ(7.0, moved.delta_x);
+  EXPECT_EQ(-2.0, moved.delta_y);
+  EXPECT_EQ(20'000_ns, sink.events[0].timestamp);
+  EXPECT_EQ(1.0, std::get<vertical_scroll>(sink.events[1].payload).offset);
+  EXPECT_EQ(-1.0, std::get<horizontal_scroll>(sink.events[2].payload).offset);
+}
+
+TEST_F(evdev, should_discard_events_until_report_after_dropped) {
+  write_inputs(make_input(EV_REL, REL_X, 3), make_input(EV_SYN, SYN_DROPPED, 0),
+               make_input(EV_KEY, KEY_A, 1), make_input(EV_REL, REL_X, 5),
+               make_report(), make_input(EV_REL, REL_X, 1), make_report());
+
+  EXPECT_EQ(1UZ, subject.poll());
+
+  ASSERT_EQ(1UZ, std::size(sink.events));
+  EXPECT_EQ(1.0, std::get<motion>(sink.events[0].payload).delta_x);
+  EXPECT_EQ(1U, subject.dropped_reports());
+}
+
+TEST_F(evdev, should_release_keys_lost_to_a_drop) {
+  write_inputs(make_input(EV_KEY, KEY_LEFTSHIFT, 1), make_report(),
+               make_input(EV_SYN, SYN_DROPPED, 0), make_report(30L),
+               make_input(EV_KEY, KEY_A, 1));
+
+  EXPECT_EQ(3UZ, subject.poll());
+
+  ASSERT_EQ(3UZ, std::size(sink.events));
+  const auto released = std::get<key_press>(sink.events[1].payload);
+  EXPECT_EQ(keyboard::scancode::left_shift, released.scancode);
+  EXPECT_EQ(keyboard::action::release, released.action);
+  EXPECT_EQ(30'000_ns, sink.events[1].timestamp);
+  const auto typed = std::get<key_press>(sink.events[2].payload);
+  EXPECT_FALSE(typed.modifiers[std::to_underlying(modifier::left_shift)]);
+}
+
+TEST_F(evdev, should_keep_record_split_across_writes) {
+  const auto input = make_input(EV_KEY, KEY_Q, 1);
+  const auto *bytes = reinterpret_cast<const std::byte *>(&input);
+  ASSERT_EQ(5, ::write(write_end, bytes, 5UZ));
+  EXPECT_EQ(0UZ, subject.poll());
+
+  ASSERT_EQ(static_cast<ssize_t>(sizeof(input) - 5UZ),
+            ::write(write_end, bytes + 5, sizeof(input) - 5UZ));
+  EXPECT_EQ(1UZ, subject.poll());
+
+  ASSERT_EQ(1UZ, std::size(sink.events));
+  EXPECT_EQ(keyboard::scancode::q,
+            std::get<key_press>(sink.events[0].payload).scancode);
+}
+
+TEST_F(evdev, should_close_device_at_end_of_file) {
+  EXPECT_EQ(1UZ, subject.open_devices());
+  ::close(std::exchange(write_end, -1));
+
+  subject.poll();
+
+  EXPECT_EQ(0UZ, subject.open_devices());
+}
+
+TEST_F(evdev, should_throw_when_device_cannot_be_opened) {
+  try {
+    std::ignore = subject.add_device("/dev/input/jage-missing");
+    FAIL() << "Expected std::system_error";
+  } catch (const std::system_error &error) {
+    EXPECT_EQ(std::errc::no_such_file_or_directory, error.code());
+  }
+}
+
+using ring_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 1024UZ>;
+using evdev_thread = evdev_fixture<ring_type>;
+
+TEST_F(evdev_thread, should_push_from_its_own_thread) {
+  subject.start();
+  EXPECT_TRUE(subject.is_running());
+  EXPECT_THROW(subject.add_device(-1), std::invalid_argument);
+
+  for (auto index = 0; index < 100; ++index) {
+    write_inputs(make_input(EV_REL, REL_X, 1), make_report(index));
+  }
+  const auto deadline =
+      std::chrono::steady_clock::now() + std::chrono::seconds{5};
+  while (sink.write_head() < 100UZ and
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::yield();
+  }
+  subject.stop();
+
+  ASSERT_EQ(100UZ, sink.write_head());
+  EXPECT_EQ(99'000_ns, sink.read(99UZ).timestamp);
+  EXPECT_EQ(100U, subject.pushed_events());
+  EXPECT_FALSE(subject.is_running());
+}
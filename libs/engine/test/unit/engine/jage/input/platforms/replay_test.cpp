@@ -0,0 +1,245 @@
+#include <jage/engine/containers/spmc/ring_buffer.hpp>
+#include <jage/engine/input/contexts/coalescing.hpp>
+#include <jage/engine/input/contexts/glfw.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/platforms/replay.hpp>
+#include <jage/engine/input/recorder.hpp>
+#include <jage/engine/input/recording.hpp>
+#include <jage/engine/test/fakes/containers/event_sink.hpp>
+#include <jage/engine/test/fakes/time/source.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+#include <jage/engine/time/snapshot_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <variant>
+
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+using snapshot_type = jage::engine::time::events::snapshot<duration_type>;
+using ring_type =
+    jage::engine::containers::spmc::ring_buffer<event_type, 64UZ>;
+using cache_type = jage::engine::time::snapshot_cache<8UZ, duration_type>;
+using source_type = jage::engine::test::fakes::time::source<duration_type>;
+using sink_type = jage::engine::test::fakes::containers::event_sink<event_type>;
+using replay_type =
+    jage::engine::input::platforms::replay<duration_type, source_type>;
+
+using jage::engine::input::keyboard::events::key_press;
+using jage::engine::input::mouse::events::cursor::motion;
+using jage::engine::time::operator""_ns;
+namespace recording = jage::engine::input::recording;
+
+namespace {
+auto make_motion(const double timestamp) -> event_type {
+  return {
+      .timestamp = duration_type{timestamp},
+      .payload = motion{.delta_x = timestamp, .delta_y = 1.0},
+  };
+}
+} // namespace
+
+class replay : public ::testing::Test {
+protected:
+  std::filesystem::path path{};
+  ring_type ring{};
+  cache_type cache{};
+
+  auto SetUp() -> void override {
+    path = std::filesystem::temp_directory_path() /
+           (std::string{::testing::UnitTest::GetInstance()
+                            ->current_test_info()
+                            ->name()} +
+            ".jage_replay_test.bin");
+    source_type::current_time = 0_ns;
+  }
+
+  auto TearDown() -> void override { std::filesystem::remove(path); }
+
+  auto record(const auto &publish) -> void {
+    auto recorder =
+        jage::engine::input::recorder<ring_type, cache_type>{ring, cache, path};
+    publish();
+    recorder.poll();
+  }
+
+  auto write_bytes(const auto &...values) -> void {
+    auto stream = std::ofstream{path, std::ios::binary};
+    (stream.write(reinterpret_cast<const char *>(&values), sizeof(values)),
+     ...);
+  }
+};
+
+TEST_F(replay, should_throw_when_file_does_not_exist) {
+  EXPECT_THROW(replay_type{path}, std::system_error);
+}
+
+TEST_F(replay, should_throw_when_file_is_not_a_recording) {
+  write_bytes(std::uint64_t{42U});
+  EXPECT_THROW(replay_type{path}, std::invalid_argument);
+
+  auto header = recording::header<duration_type>();
+  header.magic[0] = 'X';
+  write_bytes(header);
+  EXPECT_THROW(replay_type{path}, std::invalid_argument);
+}
+
+TEST_F(replay, should_throw_when_recorded_with_a_different_duration) {
+  write_bytes(recording::header<jage::engine::time::milliseconds>());
+  EXPECT_THROW(replay_type{path}, std::invalid_argument);
+}
+
+TEST_F(replay, should_replay_all_recorded_events_in_order) {
+  record([&] {
+    ring.push(make_motion(1.0));
+    ring.push({.timestamp = 2_ns, .payload = key_press{}});
+    ring.push(make_motion(3.0));
+  });
+  auto sink = sink_type{};
+  auto subject = replay_type{path};
+
+  EXPECT_EQ(3UZ, subject.replay_all(sink));
+
+  ASSERT_EQ(3UZ, std::size(sink.events));
+  EXPECT_EQ(1_ns, sink.events[0].timestamp);
+  EXPECT_EQ(1.0, std::get<motion>(sink.events[0].payload).delta_x);
+  EXPECT_TRUE(std::holds_alternative<key_press>(sink.events[1].payload));
+  EXPECT_EQ(3_ns, sink.events[2].timestamp);
+  EXPECT_TRUE(subject.is_finished());
+  EXPECT_EQ(3U, subject.replayed_events());
+}
+
+TEST_F(replay, should_replay_events_up_to_recorded_time) {
+  record([&] {
+    ring.push(make_motion(1.0));
+    ring.push(make_motion(2.0));
+    ring.push(make_motion(3.0));
+  });
+  auto sink = sink_type{};
+  auto subject = replay_type{path};
+
+  EXPECT_EQ(2UZ, subject.replay_until(sink, 2_ns));
+  EXPECT_FALSE(subject.is_finished());
+  EXPECT_EQ(0UZ, subject.replay_until(sink, 2.5_ns));
+  EXPECT_EQ(1UZ, subject.replay_until(sink, 10_ns));
+  EXPECT_TRUE(subject.is_finished());
+}
+
+TEST_F(replay, should_pace_events_by_time_since_first_poll) {
+  record([&] {
+    ring.push(make_motion(100.0));
+    ring.push(make_motion(110.0));
+    ring.push(make_motion(130.0));
+  });
+  auto sink = sink_type{};
+  auto subject = replay_type{path};
+  EXPECT_EQ(100_ns, subject.origin());
+
+  source_type::current_time = 5'000_ns;
+  EXPECT_EQ(1UZ, subject.poll_events(sink));
+  source_type::current_time = 5'009_ns;
+  EXPECT_EQ(0UZ, subject.poll_events(sink));
+  source_type::current_time = 5'010_ns;
+  EXPECT_EQ(1UZ, subject.poll_events(sink));
+  source_type::current_time = 5'100_ns;
+  EXPECT_EQ(1UZ, subject.poll_events(sink));
+  EXPECT_EQ(130_ns, sink.events.back().timestamp);
+}
+
+TEST_F(replay, should_expose_latest_replayed_snapshot) {
+  record([&] {
+    cache.push(snapshot_type{.real_time = 0_ns, .frame = 0});
+    ring.push(make_motion(1.0));
+    cache.push(snapshot_type{.real_time = 2_ns, .frame = 1});
+    ring.push(make_motion(3.0));
+  });
+  auto sink = sink_type{};
+  auto subject = replay_type{path};
+  EXPECT_FALSE(subject.latest_snapshot());
+
+  subject.replay_until(sink, 2_ns);
+  ASSERT_TRUE(subject.latest_snapshot());
+  EXPECT_EQ(1, subject.latest_snapshot()->frame);
+  EXPECT_EQ(1UZ, std::size(sink.events));
+}
+
+TEST_F(replay, should_report_dropped_events_from_recording) {
+  record([&] {
+    for (auto index = 0UZ; index < 100UZ; ++index) {
+      ring.push(make_motion(static_cast<double>(index)));
+    }
+  });
+  auto sink = sink_type{};
+  auto subject = replay_type{path};
+
+  EXPECT_EQ(63UZ, subject.replay_all(sink));
+  EXPECT_EQ(37U, subject.dropped_events());
+  EXPECT_EQ(37_ns, sink.events.front().timestamp);
+}
+
+TEST_F(replay, should_stop_at_record_cut_short_by_end_of_file) {
+  record([&] {
+    ring.push(make_motion(1.0));
+    ring.push(make_motion(2.0));
+  });
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1UZ);
+  auto sink = sink_type{};
+  auto subject = replay_type{path};
+
+  EXPECT_EQ(1UZ, subject.replay_all(sink));
+  EXPECT_TRUE(subject.is_finished());
+}
+
+TEST_F(replay, should_replay_again_after_rewind) {
+  record([&] {
+    ring.push(make_motion(1.0));
+    ring.push(make_motion(2.0));
+  });
+  auto sink = sink_type{};
+  auto subject = replay_type{path};
+  subject.replay_all(sink);
+
+  subject.rewind();
+
+  EXPECT_FALSE(subject.is_finished());
+  EXPECT_EQ(2UZ, subject.replay_all(sink));
+  EXPECT_EQ(4UZ, std::size(sink.events));
+  EXPECT_EQ(2U, subject.replayed_events());
+}
+
+TEST_F(replay, should_drive_context_into_ring_for_consumers) {
+  record([&] {
+    for (auto index = 0UZ; index < 16UZ; ++index) {
+      ring.push(make_motion(static_cast<double>(index)));
+    }
+    ring.push({.timestamp = 16_ns, .payload = key_press{}});
+  });
+  auto replayed_ring = ring_type{};
+  auto context = jage::engine::input::contexts::glfw<
+      duration_type, ring_type, source_type,
+      jage::engine::input::contexts::coalescing::cursor>{replayed_ring};
+  auto subject = replay_type{path};
+
+  subject.replay_all(context);
+  context.flush();
+
+  ASSERT_EQ(3UZ, replayed_ring.write_head());
+  EXPECT_EQ(0.0, std::get<motion>(replayed_ring.read(0UZ).payload).delta_x);
+  const auto coalesced = std::get<motion>(replayed_ring.read(1UZ).payload);
+  EXPECT_EQ(120.0, coalesced.delta_x);
+  EXPECT_EQ(15.0, coalesced.delta_y);
+  EXPECT_EQ(15_ns, replayed_ring.read(1UZ).timestamp);
+  EXPECT_TRUE(
+      std::holds_alternative<key_press>(replayed_ring.read(2UZ).payload));
+}
@@ -0,0 +1,51 @@
+#include <jage/engine/input/recording_file.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <system_error>
+#include <vector>
+
+using jage::engine::input::recording_file;
+
+TEST(recording_file, should_throw_when_file_cannot_be_opened) {
+  EXPECT_THROW(recording_file{std::filesystem::path{"/nonexistent/x.bin"}},
+               std::system_error);
+}
+
+TEST(recording_file, should_report_failed_write_instead_of_throwing) {
+  const auto path = std::filesystem::path{"/dev/full"};
+  if (not std::filesystem::exists(path)) {
+    GTEST_SKIP() << "No always-full device on this platform";
+  }
+  const auto block = std::array{std::byte{1}, std::byte{2}};
+  auto file = recording_file{path};
+  EXPECT_FALSE(file.failed());
+
+  EXPECT_NO_THROW(file.write(std::span{block}));
+  EXPECT_TRUE(file.failed());
+  EXPECT_NO_THROW(file.write(std::span{block}));
+}
+
+TEST(recording_file, should_append_every_block_written) {
+  const auto path =
+      std::filesystem::temp_directory_path() / "jage_recording_file_test.bin";
+  const auto first = std::array{std::byte{1}, std::byte{2}};
+  const auto second = std::array{std::byte{3}};
+  {
+    auto file = recording_file{path};
+    file.write(std::span{first});
+    file.write(std::span{second});
+  }
+
+  auto stream = std::ifstream{path, std::ios::binary};
+  const auto contents =
+      std::vector<char>{std::istreambuf_iterator<char>{stream}, {}};
+  EXPECT_EQ((std::vector<char>{1, 2, 3}), contents);
+  std::filesystem::remove(path);
+}
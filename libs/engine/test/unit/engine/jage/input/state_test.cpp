@@ -0,0 +1,260 @@
+#include <jage/engine/concurrency/seqlock.hpp>
+#include <jage/engine/input/event.hpp>
+#include <jage/engine/input/frame_state.hpp>
+#include <jage/engine/input/gamepad/action.hpp>
+#include <jage/engine/input/gamepad/axis.hpp>
+#include <jage/engine/input/gamepad/button.hpp>
+#include <jage/engine/input/gamepad/events/axis_motion.hpp>
+#include <jage/engine/input/gamepad/events/button_press.hpp>
+#include <jage/engine/input/keyboard/action.hpp>
+#include <jage/engine/input/keyboard/events/key_press.hpp>
+#include <jage/engine/input/keyboard/key.hpp>
+#include <jage/engine/input/keyboard/scancode.hpp>
+#include <jage/engine/input/modifier.hpp>
+#include <jage/engine/input/mouse/action.hpp>
+#include <jage/engine/input/mouse/button.hpp>
+#include <jage/engine/input/mouse/events/click.hpp>
+#include <jage/engine/input/mouse/events/cursor/motion.hpp>
+#include <jage/engine/input/mouse/events/cursor/position.hpp>
+#include <jage/engine/input/mouse/events/horizontal_scroll.hpp>
+#include <jage/engine/input/mouse/events/vertical_scroll.hpp>
+#include <jage/engine/input/state.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <jage/engine/input/internal/state.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <bitset>
+#include <thread>
+#include <utility>
+
+using duration_type = jage::engine::time::nanoseconds;
+using event_type = jage::engine::input::event<duration_type>;
+
+using jage::engine::input::modifier;
+using jage::engine::input::modifier_count;
+using jage::engine::input::keyboard::key;
+using jage::engine::input::keyboard::scancode;
+using jage::engine::input::keyboard::events::key_press;
+using jage::engine::input::mouse::button;
+using jage::engine::input::mouse::events::click;
+using jage::engine::input::mouse::events::horizontal_scroll;
+using jage::engine::input::mouse::events::vertical_scroll;
+using jage::engine::input::mouse::events::cursor::motion;
+using jage::engine::input::mouse::events::cursor::position;
+namespace gamepad = jage::engine::input::gamepad;
+namespace keyboard = jage::engine::input::keyboard;
+namespace mouse = jage::engine::input::mouse;
+
+namespace {
+auto make_event(const auto &payload) -> event_type {
+  return {.timestamp = {}, .payload = payload};
+}
+
+auto make_key(const key input_key, const scancode input_scancode,
+              const keyboard::action action,
+              const std::bitset<modifier_count> modifiers = {}) -> event_type {
+  return make_event(key_press{
+      .key = input_key,
+      .scancode = input_scancode,
+      .action = action,
+      .modifiers = modifiers,
+  });
+}
+
+auto make_click(const button input_button, const mouse::action action)
+    -> event_type {
+  return make_event(
+      click{.button = input_button, .action = action, .modifiers = {}});
+}
+} // namespace
+
+class state : public ::testing::Test {
+protected:
+  jage::engine::input::state<duration_type> subject{};
+};
+
+TEST_F(state, should_report_nothing_held_before_any_event) {
+  EXPECT_FALSE(subject.current().is_down(key::w));
+  EXPECT_FALSE(subject.current().is_down(scancode::w));
+  EXPECT_FALSE(subject.current().is_down(button::left));
+  EXPECT_EQ(0U, subject.current().frame);
+}
+
+TEST_F(state, should_hold_key_and_scancode_after_press) {
+  subject.apply(make_key(key::w, scancode::z, keyboard::action::press));
+
+  EXPECT_TRUE(subject.current().is_down(key::w));
+  EXPECT_TRUE(subject.current().is_down(scancode::z));
+  EXPECT_FALSE(subject.current().is_down(key::z));
+  EXPECT_FALSE(subject.current().is_down(scancode::w));
+  EXPECT_TRUE(subject.current().was_pressed(key::w));
+  EXPECT_TRUE(subject.current().was_pressed(scancode::z));
+}
+
+TEST_F(state, should_keep_key_held_across_frames_until_released) {
+  subject.apply(make_key(key::w, scancode::w, keyboard::action::press));
+  subject.publish();
+  subject.publish();
+
+  EXPECT_TRUE(subject.current().is_down(key::w));
+  EXPECT_FALSE(subject.current().was_pressed(key::w));
+
+  subject.apply(make_key(key::w, scancode::w, keyboard::action::release));
+
+  EXPECT_FALSE(subject.current().is_down(key::w));
+  EXPECT_TRUE(subject.current().was_released(key::w));
+  EXPECT_TRUE(subject.current().was_released(scancode::w));
+}
+
+TEST_F(state, should_not_report_repeat_as_a_new_press) {
+  subject.apply(make_key(key::a, scancode::a, keyboard::action::press));
+  subject.publish();
+  subject.apply(make_key(key::a, scancode::a, keyboard::action::repeat));
+
+  EXPECT_TRUE(subject.current().is_down(key::a));
+  EXPECT_FALSE(subject.current().was_pressed(key::a));
+}
+
+TEST_F(state, should_report_both_edges_of_a_tap_within_one_frame) {
+  subject.apply(
+      make_key(key::spacebar, scancode::spacebar, keyboard::action::press));
+  subject.apply(
+      make_key(key::spacebar, scancode::spacebar, keyboard::action::release));
+
+  EXPECT_FALSE(subject.current().is_down(key::spacebar));
+  EXPECT_TRUE(subject.current().was_pressed(key::spacebar));
+  EXPECT_TRUE(subject.current().was_released(key::spacebar));
+}
+
+TEST_F(state, should_track_mouse_buttons) {
+  subject.apply(make_click(button::right, mouse::action::press));
+  EXPECT_TRUE(subject.current().is_down(button::right));
+  EXPECT_TRUE(subject.current().was_pressed(button::right));
+  EXPECT_FALSE(subject.current().is_down(button::left));
+
+  subject.publish();
+  subject.apply(make_click(button::right, mouse::action::release));
+  EXPECT_FALSE(subject.current().is_down(button::right));
+  EXPECT_TRUE(subject.current().was_released(button::right));
+}
+
+TEST_F(state, should_keep_latest_modifiers) {
+  auto modifiers = std::bitset<modifier_count>{};
+  modifiers.set(std::to_underlying(modifier::left_shift));
+  subject.apply(
+      make_key(key::a, scancode::a, keyboard::action::press, modifiers));
+
+  EXPECT_TRUE(subject.current().is_modifier_active(modifier::left_shift));
+  EXPECT_FALSE(subject.current().is_modifier_active(modifier::left_control));
+}
+
+TEST_F(state, should_accumulate_scroll_and_motion_within_a_frame) {
+  subject.apply(make_event(motion{.delta_x = 1.5, .delta_y = -2.0}));
+  subject.apply(make_event(motion{.delta_x = 0.5, .delta_y = 1.0}));
+  subject.apply(make_event(vertical_scroll{.offset = 1.0}));
+  subject.apply(make_event(vertical_scroll{.offset = 2.0}));
+  subject.apply(make_event(horizontal_scroll{.offset = -1.0}));
+
+  EXPECT_EQ(2.0, subject.current().motion_x);
+  EXPECT_EQ(-1.0, subject.current().motion_y);
+  EXPECT_EQ(3.0, subject.current().scroll_y);
+  EXPECT_EQ(-1.0, subject.current().scroll_x);
+
+  subject.publish();
+
+  EXPECT_EQ(0.0, subject.current().motion_x);
+  EXPECT_EQ(0.0, subject.current().scroll_y);
+}
+
+TEST_F(state, should_keep_latest_cursor_position_across_frames) {
+  subject.apply(make_event(position{.x = 1.0, .y = 2.0}));
+  subject.apply(make_event(position{.x = 3.0, .y = 4.0}));
+  subject.publish();
+
+  EXPECT_EQ(3.0, subject.current().cursor_x);
+  EXPECT_EQ(4.0, subject.current().cursor_y);
+}
+
+TEST_F(state, should_track_gamepad_buttons_per_gamepad) {
+  subject.apply(make_event(gamepad::events::button_press{
+      .gamepad = 1U,
+      .button = gamepad::button::a,
+      .action = gamepad::action::press,
+  }));
+
+  EXPECT_TRUE(subject.current().is_down(1U, gamepad::button::a));
+  EXPECT_TRUE(subject.current().was_pressed(1U, gamepad::button::a));
+  EXPECT_FALSE(subject.current().is_down(0U, gamepad::button::a));
+  EXPECT_FALSE(subject.current().is_down(1U, gamepad::button::b));
+
+  subject.publish();
+  subject.apply(make_event(gamepad::events::button_press{
+      .gamepad = 1U,
+      .button = gamepad::button::a,
+      .action = gamepad::action::release,
+  }));
+
+  EXPECT_FALSE(subject.current().is_down(1U, gamepad::button::a));
+  EXPECT_TRUE(subject.current().was_released(1U, gamepad::button::a));
+}
+
+TEST_F(state, should_keep_latest_gamepad_axes_across_frames) {
+  subject.apply(make_event(gamepad::events::axis_motion{
+      .gamepad = 3U, .axis = gamepad::axis::left_x, .value = -0.5}));
+  subject.apply(make_event(gamepad::events::axis_motion{
+      .gamepad = 3U, .axis = gamepad::axis::left_x, .value = 0.25}));
+  subject.publish();
+
+  EXPECT_EQ(0.25, subject.current().axis(3U, gamepad::axis::left_x));
+  EXPECT_EQ(0.0, subject.current().axis(3U, gamepad::axis::left_y));
+}
+
+TEST_F(state, should_read_last_published_frame) {
+  subject.apply(make_key(key::w, scancode::w, keyboard::action::press));
+  EXPECT_FALSE(subject.read().is_down(key::w));
+
+  subject.publish();
+  subject.apply(make_key(key::w, scancode::w, keyboard::action::release));
+
+  const auto published = subject.read();
+  EXPECT_TRUE(published.is_down(key::w));
+  EXPECT_TRUE(published.was_pressed(key::w));
+  EXPECT_EQ(0U, published.frame);
+  EXPECT_EQ(1U, subject.current().frame);
+}
+
+TEST(state_seqlock, should_publish_consistent_frames_to_other_threads) {
+  static constexpr auto frame_count = 20'000UZ;
+  auto subject =
+      jage::engine::input::internal::state<duration_type,
+                                           jage::engine::concurrency::seqlock,
+                                           std::atomic>{};
+  auto done = std::atomic<bool>{false};
+  auto inconsistent = 0UZ;
+  auto reader = std::thread{[&] {
+    while (not done.load(std::memory_order::acquire)) {
+      const auto published = subject.read();
+      const auto expected_down = published.frame % 2U == 1U;
+      if (published.motion_x != static_cast<double>(published.frame) or
+          published.is_down(key::w) != expected_down) {
+        ++inconsistent;
+      }
+    }
+  }};
+  subject.publish();
+  for (auto frame = 1UZ; frame < frame_count; ++frame) {
+    subject.apply(make_event(
+        motion{.delta_x = static_cast<double>(frame), .delta_y = 0.0}));
+    subject.apply(make_key(key::w, scancode::w,
+                           frame % 2U == 1U ? keyboard::action::press
+                                            : keyboard::action::release));
+    subject.publish();
+  }
+  done.store(true, std::memory_order::release);
+  reader.join();
+
+  EXPECT_EQ(0UZ, inconsistent);
+}
@@ -0,0 +1,31 @@
+#include <jage/engine/logging/file_sink.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+using jage::engine::logging::file_sink;
+
+TEST(file_sink, should_throw_when_file_cannot_be_opened) {
+  EXPECT_THROW(file_sink{std::filesystem::path{"/nonexistent/x.log"}},
+               std::invalid_argument);
+}
+
+TEST(file_sink, should_make_each_batch_visible_once_written) {
+  const auto path =
+      std::filesystem::temp_directory_path() / "jage_file_sink_test.log";
+  auto sink = file_sink{path};
+  sink.write(std::as_bytes(std::span{std::string_view{"first\n"}}));
+  sink.write(std::as_bytes(std::span{std::string_view{"second\n"}}));
+
+  auto stream = std::ifstream{path, std::ios::binary};
+  EXPECT_EQ("first\nsecond\n",
+            (std::string{std::istreambuf_iterator<char>{stream}, {}}));
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,125 @@
+#include <jage/engine/test/fakes/logging/writer.hpp>
+
+#include <jage/engine/logging/internal/logger.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using writer_type = jage::engine::test::fakes::logging::writer;
+
+template <std::size_t Capacity = 8UZ, std::size_t MaxThreads = 4UZ>
+using logger_type =
+    jage::engine::logging::internal::logger<writer_type, Capacity, MaxThreads>;
+
+TEST(logger, should_write_nothing_until_polled) {
+  auto sut = logger_type{};
+  EXPECT_TRUE(sut.log("frame {}\n", 1));
+
+  EXPECT_EQ("", sut.writer().text);
+  EXPECT_EQ(1UZ, sut.poll());
+  EXPECT_EQ("frame 1\n", sut.writer().text);
+  EXPECT_EQ(1U, sut.written_messages());
+}
+
+TEST(logger, should_write_each_poll_as_one_batch) {
+  auto sut = logger_type{};
+  sut.log("a={}\n", 1);
+  sut.log("b={}\n", 2.5);
+  sut.log("c\n");
+  sut.poll();
+
+  EXPECT_EQ("a=1\nb=2.5\nc\n", sut.writer().text);
+  EXPECT_EQ(1UZ, sut.writer().writes);
+  EXPECT_EQ(0UZ, sut.poll());
+  EXPECT_EQ(1UZ, sut.writer().writes);
+}
+
+TEST(logger, should_drop_and_report_when_queue_is_full) {
+  auto sut = logger_type<2UZ>{};
+  EXPECT_TRUE(sut.log("{}\n", 1));
+  EXPECT_TRUE(sut.log("{}\n", 2));
+  EXPECT_FALSE(sut.log("{}\n", 3));
+  EXPECT_FALSE(sut.log("{}\n", 4));
+  sut.poll();
+
+  EXPECT_EQ("1\n2\n[log] 2 messages dropped\n", sut.writer().text);
+  EXPECT_EQ(2U, sut.dropped_messages());
+  EXPECT_EQ(2U, sut.written_messages());
+
+  EXPECT_TRUE(sut.log("{}\n", 5));
+  sut.poll();
+  EXPECT_EQ("1\n2\n[log] 2 messages dropped\n5\n", sut.writer().text);
+}
+
+TEST(logger, should_give_each_thread_its_own_queue) {
+  auto sut = logger_type<4UZ>{};
+  auto threads = std::vector<std::jthread>{};
+  for (auto thread = 0; thread < 3; ++thread) {
+    threads.emplace_back([&sut, thread] {
+      for (auto index = 0; index < 4; ++index) {
+        EXPECT_TRUE(sut.log("{}\n", thread));
+      }
+    });
+  }
+  threads.clear();
+  EXPECT_EQ(12UZ, sut.poll());
+  EXPECT_EQ(0U, sut.dropped_messages());
+}
+
+TEST(logger, should_drop_messages_from_threads_beyond_capacity) {
+  auto sut = logger_type<4UZ, 1UZ>{};
+  EXPECT_TRUE(sut.log("main\n"));
+  std::jthread{[&sut] { EXPECT_FALSE(sut.log("other\n")); }}.join();
+  sut.poll();
+
+  EXPECT_EQ("main\n[log] 1 messages dropped\n", sut.writer().text);
+  EXPECT_EQ(1U, sut.dropped_messages());
+}
+
+TEST(logger, should_keep_loggers_apart_on_one_thread) {
+  auto first = logger_type{};
+  auto second = logger_type{};
+  first.log("first\n");
+  second.log("second\n");
+  first.log("first again\n");
+  first.poll();
+  second.poll();
+
+  EXPECT_EQ("first\nfirst again\n", first.writer().text);
+  EXPECT_EQ("second\n", second.writer().text);
+}
+
+TEST(logger, should_drain_on_destruction) {
+  auto text = std::string{};
+  {
+    auto sut = logger_type{};
+    sut.log("last words\n");
+    sut.start();
+    sut.stop();
+    text = sut.writer().text;
+  }
+  EXPECT_EQ("last words\n", text);
+}
+
+TEST(logger_thread, should_write_everything_logged_while_running) {
+  constexpr auto message_count = 10'000;
+  auto sut = logger_type<64UZ>{};
+  sut.start(std::chrono::microseconds{10});
+  auto logged = 0U;
+  for (auto index = 0; index < message_count; ++index) {
+    while (not sut.log("{}\n", index)) {
+      std::this_thread::yield();
+    }
+    ++logged;
+  }
+  sut.stop();
+
+  EXPECT_EQ(logged, sut.written_messages());
+  EXPECT_TRUE(sut.writer().text.ends_with("9999\n"));
+}
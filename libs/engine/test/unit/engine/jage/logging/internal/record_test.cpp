@@ -0,0 +1,68 @@
+#include <jage/engine/logging/internal/concepts/loggable_argument.hpp>
+#include <jage/engine/logging/internal/record.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <fmt/format.h>
+#include <string>
+#include <string_view>
+
+namespace logging = jage::engine::logging::internal;
+
+namespace {
+auto format(const logging::record &encoded) -> std::string {
+  auto buffer = fmt::memory_buffer{};
+  logging::decode(encoded, buffer);
+  return fmt::to_string(buffer);
+}
+
+struct position {
+  double x;
+  double y;
+};
+} // namespace
+
+template <> struct fmt::formatter<position> : fmt::formatter<double> {
+  auto format(const position &value, fmt::format_context &ctx) const {
+    return fmt::format_to(ctx.out(), "({}, {})", value.x, value.y);
+  }
+};
+
+TEST(logging_record, should_be_two_cache_lines) {
+  static_assert(128UZ == sizeof(logging::record));
+}
+
+TEST(logging_record, should_format_without_arguments) {
+  EXPECT_EQ("started", format(logging::encode("started")));
+}
+
+TEST(logging_record, should_keep_arguments_of_mixed_alignment) {
+  EXPECT_EQ("a 1 b 2.5 c 3 d true",
+            format(logging::encode("a {} b {} c {} d {}", std::uint8_t{1},
+                                   2.5, std::uint16_t{3}, true)));
+}
+
+TEST(logging_record, should_format_user_types) {
+  EXPECT_EQ("cursor at (1.5, -2)",
+            format(logging::encode("cursor at {}", position{1.5, -2.0})));
+}
+
+TEST(logging_record, should_pack_arguments_by_alignment) {
+  static_assert(0UZ == logging::arguments_size<>());
+  static_assert(16UZ == logging::arguments_size<std::uint8_t, double>());
+  static_assert(10UZ ==
+                logging::arguments_size<double, std::uint8_t, std::uint8_t>());
+  static_assert(logging::argument_offsets<char, std::uint32_t, char>() ==
+                std::array{0UZ, 4UZ, 8UZ});
+}
+
+TEST(logging_record, should_only_accept_arguments_it_can_copy_safely) {
+  static_assert(logging::concepts::loggable_argument<int>);
+  static_assert(logging::concepts::loggable_argument<position>);
+  static_assert(not logging::concepts::loggable_argument<const char *>);
+  static_assert(not logging::concepts::loggable_argument<char[4]>);
+  static_assert(not logging::concepts::loggable_argument<std::string_view>);
+  static_assert(not logging::concepts::loggable_argument<std::string>);
+}
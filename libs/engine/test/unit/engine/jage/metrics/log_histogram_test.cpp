@@ -0,0 +1,135 @@
+#include <jage/engine/metrics/log_histogram.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+
+using jage::engine::metrics::log_histogram;
+
+using histogram = log_histogram<3U, 8U>;
+
+TEST(log_histogram_layout, Size_bucket_count_from_sub_bucket_and_magnitude) {
+  static_assert(8UZ + 5UZ * 4UZ == histogram::bucket_count());
+  static_assert(255U == histogram::max_value());
+}
+
+TEST(log_histogram_layout, Map_small_values_to_exact_buckets) {
+  for (auto value = 0U; value < 8U; ++value) {
+    EXPECT_EQ(value, histogram::bucket_index(value));
+    EXPECT_EQ(value, histogram::bucket_lower_bound(value));
+    EXPECT_EQ(value, histogram::bucket_upper_bound(value));
+  }
+}
+
+TEST(log_histogram_layout, Double_bucket_width_every_magnitude) {
+  EXPECT_EQ(8UZ, histogram::bucket_index(8U));
+  EXPECT_EQ(8UZ, histogram::bucket_index(9U));
+  EXPECT_EQ(9UZ, histogram::bucket_index(10U));
+  EXPECT_EQ(12UZ, histogram::bucket_index(16U));
+  EXPECT_EQ(12UZ, histogram::bucket_index(19U));
+  EXPECT_EQ(13UZ, histogram::bucket_index(20U));
+}
+
+TEST(log_histogram_layout, Cover_value_range_without_gaps) {
+  for (auto index = 1UZ; index < histogram::bucket_count(); ++index) {
+    EXPECT_EQ(histogram::bucket_upper_bound(index - 1UZ) + 1U,
+              histogram::bucket_lower_bound(index));
+  }
+  for (auto value = 0U; value <= histogram::max_value(); ++value) {
+    const auto index = histogram::bucket_index(value);
+    EXPECT_LE(histogram::bucket_lower_bound(index), value);
+    EXPECT_GE(histogram::bucket_upper_bound(index), value);
+  }
+}
+
+TEST(log_histogram_layout, Clamp_values_above_range_into_last_bucket) {
+  EXPECT_EQ(histogram::bucket_count() - 1UZ, histogram::bucket_index(256U));
+  EXPECT_EQ(histogram::bucket_count() - 1UZ,
+            histogram::bucket_index(UINT64_MAX));
+}
+
+TEST(log_histogram_layout, Bound_relative_error_by_sub_bucket_count) {
+  using precise = log_histogram<7U, 22U>;
+  for (auto value = 128ULL; value < precise::max_value(); value += 997U) {
+    const auto upper =
+        precise::bucket_upper_bound(precise::bucket_index(value));
+    EXPECT_LE(static_cast<double>(upper - value) / static_cast<double>(value),
+              1.0 / 64.0);
+  }
+}
+
+TEST(log_histogram, Report_zero_while_empty) {
+  const auto values = histogram{};
+  EXPECT_EQ(0U, values.count());
+  EXPECT_EQ(0U, values.value_at_percentile(50.0));
+  EXPECT_EQ(0U, values.max());
+}
+
+TEST(log_histogram, Report_recorded_value_at_every_percentile) {
+  auto values = histogram{};
+  values.record(5U);
+  EXPECT_EQ(1U, values.count());
+  EXPECT_EQ(5U, values.value_at_percentile(0.0));
+  EXPECT_EQ(5U, values.value_at_percentile(50.0));
+  EXPECT_EQ(5U, values.value_at_percentile(100.0));
+  EXPECT_EQ(5U, values.max());
+}
+
+TEST(log_histogram, Find_percentiles_by_rank) {
+  auto values = histogram{};
+  for (auto value = 1U; value <= 7U; ++value) {
+    values.record(value);
+  }
+  for (auto repeat = 0U; repeat < 3U; ++repeat) {
+    values.record(100U);
+  }
+  EXPECT_EQ(5U, values.value_at_percentile(50.0));
+  EXPECT_EQ(7U, values.value_at_percentile(70.0));
+  EXPECT_EQ(histogram::bucket_upper_bound(histogram::bucket_index(100U)),
+            values.value_at_percentile(71.0));
+  EXPECT_EQ(histogram::bucket_upper_bound(histogram::bucket_index(100U)),
+            values.max());
+}
+
+TEST(log_histogram, Resolve_several_percentiles_in_one_pass) {
+  auto values = histogram{};
+  for (auto value = 0U; value < 8U; ++value) {
+    values.record(value);
+  }
+  const auto [p99, p25, p50] =
+      values.values_at_percentiles(std::array{99.0, 25.0, 50.0});
+  EXPECT_EQ(7U, p99);
+  EXPECT_EQ(1U, p25);
+  EXPECT_EQ(3U, p50);
+}
+
+TEST(log_histogram, Forget_erased_values) {
+  auto values = histogram{};
+  values.record(2U);
+  values.record(200U);
+  values.erase(200U);
+  EXPECT_EQ(1U, values.count());
+  EXPECT_EQ(2U, values.max());
+  EXPECT_EQ(1U, values.count(histogram::bucket_index(2U)));
+  EXPECT_EQ(0U, values.count(histogram::bucket_index(200U)));
+}
+
+TEST(log_histogram, Clear_all_buckets_on_reset) {
+  auto values = histogram{};
+  values.record(2U);
+  values.record(200U);
+  values.reset();
+  EXPECT_EQ(0U, values.count());
+  EXPECT_EQ(0U, values.max());
+}
+
+TEST(log_histogram, Be_usable_in_constant_expressions) {
+  constexpr auto p50 = [] {
+    auto values = histogram{};
+    values.record(3U);
+    values.record(4U);
+    return values.value_at_percentile(50.0);
+  }();
+  static_assert(3U == p50);
+}
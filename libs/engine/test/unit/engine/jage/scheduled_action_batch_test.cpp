@@ -0,0 +1,151 @@
+#include <jage/engine/inplace_action.hpp>
+#include <jage/engine/scheduled_action.hpp>
+#include <jage/engine/scheduled_action_batch.hpp>
+#include <jage/engine/scheduled_action_status.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using namespace std::chrono_literals;
+using jage::engine::inplace_action;
+using jage::engine::scheduled_action_batch;
+using jage::engine::scheduled_action_status;
+
+TEST(scheduled_action_batch, Be_empty_on_construction) {
+  const auto batch = scheduled_action_batch<>{};
+  EXPECT_EQ(0UZ, batch.size());
+}
+
+TEST(scheduled_action_batch, Return_index_of_pushed_action) {
+  auto batch = scheduled_action_batch<>{};
+  EXPECT_EQ(0UZ, batch.push_back(10ns));
+  EXPECT_EQ(1UZ, batch.push_back(20ns));
+  EXPECT_EQ(2UZ, batch.size());
+  EXPECT_EQ(scheduled_action_status::active, batch.status(1UZ));
+  EXPECT_EQ(20ns, batch.nanoseconds_to_wait(1UZ));
+}
+
+TEST(scheduled_action_batch, Count_down_active_actions) {
+  auto batch = scheduled_action_batch<>{};
+  batch.push_back(10ns);
+  batch.update(3ns);
+  EXPECT_EQ(7ns, batch.nanoseconds_to_wait(0UZ));
+  EXPECT_EQ(scheduled_action_status::active, batch.status(0UZ));
+}
+
+TEST(scheduled_action_batch, Complete_and_invoke_action_once_time_expires) {
+  auto fired = 0;
+  auto batch = scheduled_action_batch<inplace_action<>>{};
+  batch.push_back(10ns, [&fired] { ++fired; });
+  batch.update(9ns);
+  EXPECT_EQ(0, fired);
+  batch.update(5ns);
+  EXPECT_EQ(1, fired);
+  EXPECT_EQ(0ns, batch.nanoseconds_to_wait(0UZ));
+  EXPECT_EQ(scheduled_action_status::complete, batch.status(0UZ));
+  EXPECT_TRUE(batch.is_complete(0UZ));
+  batch.update(5ns);
+  EXPECT_EQ(1, fired);
+}
+
+TEST(scheduled_action_batch, Not_count_down_paused_or_canceled_actions) {
+  auto batch = scheduled_action_batch<>{};
+  batch.push_back(10ns);
+  batch.push_back(10ns);
+  batch.pause(0UZ);
+  batch.cancel(1UZ);
+  batch.update(20ns);
+  EXPECT_EQ(10ns, batch.nanoseconds_to_wait(0UZ));
+  EXPECT_EQ(scheduled_action_status::paused, batch.status(0UZ));
+  EXPECT_EQ(10ns, batch.nanoseconds_to_wait(1UZ));
+  EXPECT_EQ(scheduled_action_status::canceled, batch.status(1UZ));
+  EXPECT_TRUE(batch.completed().empty());
+}
+
+TEST(scheduled_action_batch, Follow_scheduled_action_status_transitions) {
+  auto batch = scheduled_action_batch<>{};
+  batch.push_back(10ns);
+  batch.pause(0UZ);
+  batch.resume(0UZ);
+  EXPECT_EQ(scheduled_action_status::active, batch.status(0UZ));
+  batch.cancel(0UZ);
+  batch.resume(0UZ);
+  batch.pause(0UZ);
+  EXPECT_EQ(scheduled_action_status::canceled, batch.status(0UZ));
+  batch.reset(0UZ, 5ns);
+  batch.update(5ns);
+  batch.cancel(0UZ);
+  EXPECT_EQ(scheduled_action_status::complete, batch.status(0UZ));
+}
+
+TEST(scheduled_action_batch, Extend_remaining_wait) {
+  auto batch = scheduled_action_batch<>{};
+  batch.push_back(10ns);
+  batch.extend(0UZ, 5ns);
+  batch.update(14ns);
+  EXPECT_EQ(1ns, batch.nanoseconds_to_wait(0UZ));
+}
+
+TEST(scheduled_action_batch, Run_again_after_reset) {
+  auto fired = 0;
+  auto batch = scheduled_action_batch<inplace_action<>>{};
+  batch.push_back(1ns, [&fired] { ++fired; });
+  batch.update(1ns);
+  batch.reset(0UZ, 2ns);
+  batch.update(2ns);
+  EXPECT_EQ(2, fired);
+}
+
+TEST(scheduled_action_batch, Report_only_actions_completed_by_last_update) {
+  auto batch = scheduled_action_batch<>{};
+  for (auto index = 0U; index < 11U; ++index) {
+    batch.push_back(std::chrono::nanoseconds{index % 3U + 1U});
+  }
+  batch.update(1ns);
+  EXPECT_EQ((std::vector<std::uint32_t>{0U, 3U, 6U, 9U}), batch.completed());
+  batch.update(1ns);
+  EXPECT_EQ((std::vector<std::uint32_t>{1U, 4U, 7U, 10U}), batch.completed());
+}
+
+TEST(scheduled_action_batch, Invoke_completed_actions_in_index_order) {
+  auto order = std::vector<std::size_t>{};
+  auto batch = scheduled_action_batch<inplace_action<>>{};
+  for (auto index = 0UZ; index < 13UZ; ++index) {
+    batch.push_back(std::chrono::nanoseconds{index % 2UZ},
+                    [&order, index] { order.push_back(index); });
+  }
+  batch.update(0ns);
+  EXPECT_EQ((std::vector<std::size_t>{0UZ, 2UZ, 4UZ, 6UZ, 8UZ, 10UZ, 12UZ}),
+            order);
+}
+
+TEST(scheduled_action_batch, Match_scheduled_action_for_every_lane_and_tail) {
+  auto batch_fired = std::vector<std::uint32_t>(37U);
+  auto single_fired = std::vector<std::uint32_t>(37U);
+  auto batch = scheduled_action_batch<inplace_action<>>{};
+  auto singles =
+      std::vector<jage::engine::scheduled_action<inplace_action<>>>{};
+  for (auto index = 0UZ; index < 37UZ; ++index) {
+    const auto wait = std::chrono::nanoseconds{(index * 7UZ) % 23UZ};
+    batch.push_back(wait, [&batch_fired, index] { ++batch_fired[index]; });
+    singles.emplace_back(wait,
+                         [&single_fired, index] { ++single_fired[index]; });
+    if (index % 5UZ == 0UZ) {
+      batch.pause(index);
+      singles.back().pause();
+    }
+  }
+  for (auto frame = 0U; frame < 10U; ++frame) {
+    batch.update(3ns);
+    for (auto &single : singles) {
+      single.update(3ns);
+    }
+    for (auto index = 0UZ; index < 37UZ; ++index) {
+      EXPECT_EQ(singles[index].status(), batch.status(index));
+    }
+  }
+  EXPECT_EQ(single_fired, batch_fired);
+}
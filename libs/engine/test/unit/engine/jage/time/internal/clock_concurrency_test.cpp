@@ -0,0 +1,70 @@
+#include <jage/engine/test/fakes/time/source.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/hertz.hpp>
+
+#include <jage/engine/time/internal/clock.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using time_source =
+    jage::engine::test::fakes::time::source<jage::engine::time::nanoseconds>;
+using jage::engine::time::operator""_Hz;
+using jage::engine::time::operator""_ns;
+
+TEST(clock_concurrency,
+     Publish_time_scale_changes_as_consistent_epochs_to_concurrent_readers) {
+  static constexpr auto reader_count = 4UZ;
+  static constexpr auto rescale_count = 100'000UZ;
+  static constexpr auto read_count = 100'000UZ;
+
+  time_source::current_time = 1'000'000'000_ns;
+  auto clock = jage::engine::time::internal::clock<time_source>{60_Hz};
+  clock.set_time_scale(1.0);
+  const auto frozen_frame = clock.snapshot().frame;
+
+  auto done = std::atomic<bool>{false};
+  auto reads = std::atomic<std::uint64_t>{0U};
+  auto torn_reads = std::atomic<std::uint64_t>{0U};
+  auto readers = std::vector<std::jthread>{};
+  for (auto reader = 0UZ; reader < reader_count; ++reader) {
+    readers.emplace_back([&] {
+      while (not done.load(std::memory_order::acquire)) {
+        const auto snapshot = clock.snapshot();
+        if (snapshot.elapsed_time != snapshot.real_time * snapshot.time_scale or
+            snapshot.elapsed_frames != frozen_frame or
+            snapshot.frame != frozen_frame) [[unlikely]] {
+          torn_reads.fetch_add(1U, std::memory_order::relaxed);
+        }
+        reads.fetch_add(1U, std::memory_order::relaxed);
+      }
+    });
+  }
+
+  for (auto rescale = 0UZ; rescale < rescale_count or
+                           reads.load(std::memory_order::relaxed) < read_count;
+       ++rescale) {
+    clock.set_time_scale(0.5 * static_cast<double>(rescale % 8UZ));
+  }
+  done.store(true, std::memory_order::release);
+  readers.clear();
+
+  EXPECT_EQ(0U, torn_reads.load());
+  EXPECT_GE(reads.load(), read_count);
+  EXPECT_EQ(frozen_frame, clock.ticks());
+}
+
+TEST(clock_concurrency, Never_report_ticks_before_the_current_epoch) {
+  time_source::current_time = 0_ns;
+  auto clock = jage::engine::time::internal::clock<time_source>{60_Hz};
+  time_source::current_time = clock.tick_duration() * 10.0;
+  clock.set_time_scale(2.0);
+  time_source::current_time -= 1_ns;
+  EXPECT_EQ(10U, clock.ticks());
+  EXPECT_EQ(10U, clock.snapshot().frame);
+  EXPECT_EQ(0_ns, clock.snapshot().accumulated_time);
+}
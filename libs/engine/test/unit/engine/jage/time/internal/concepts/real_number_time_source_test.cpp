@@ -1,6 +1,8 @@
 #include <jage/engine/test/fakes/time/source.hpp>
 
 #include <jage/engine/time/internal/concepts/real_number_time_source.hpp>
+#include <jage/engine/time/internal/steady_clock.hpp>
+#include <jage/engine/time/internal/virtual_time_source.hpp>
 
 #include <gtest/gtest.h>
 
@@ -25,3 +27,12 @@ TEST(
                 jage::engine::test::fakes::time::source<
                     std::chrono::duration<std::uint32_t, std::nano>>>));
 }
+
+TEST(time_internal_real_number_time_source,
+     Fit_concept_for_static_and_per_instance_time_sources) {
+  using duration = std::chrono::duration<double, std::nano>;
+  EXPECT_TRUE((jage::engine::time::internal::concepts::real_number_time_source<
+               jage::engine::time::internal::steady_clock<duration>>));
+  EXPECT_TRUE((jage::engine::time::internal::concepts::real_number_time_source<
+               jage::engine::time::internal::virtual_time_source<duration>>));
+}
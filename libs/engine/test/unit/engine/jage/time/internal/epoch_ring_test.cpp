@@ -0,0 +1,56 @@
+#include <jage/engine/test/fakes/concurrency/atomic.hpp>
+#include <jage/engine/time/durations.hpp>
+
+#include <jage/engine/time/internal/epoch_ring.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+using jage::engine::time::operator""_ns;
+
+namespace {
+struct epoch {
+  jage::engine::time::nanoseconds elapsed_time{};
+  std::uint64_t elapsed_ticks{};
+  double time_scale{1.0};
+};
+
+using epoch_ring = jage::engine::time::internal::epoch_ring<
+    epoch, jage::engine::test::fakes::concurrency::atomic>;
+} // namespace
+
+TEST(epoch_ring, Start_with_initial_epoch) {
+  const auto ring = epoch_ring{};
+  EXPECT_EQ(0_ns, ring.load().elapsed_time);
+  EXPECT_EQ(0U, ring.load().elapsed_ticks);
+  EXPECT_EQ(1.0, ring.load().time_scale);
+}
+
+TEST(epoch_ring, Publish_next_epoch_from_current_one) {
+  auto ring = epoch_ring{};
+  ring.publish([](const epoch &previous) {
+    return epoch{.elapsed_time = 10_ns,
+                 .elapsed_ticks = previous.elapsed_ticks + 3U,
+                 .time_scale = 0.5};
+  });
+  ring.publish([](const epoch &previous) {
+    return epoch{.elapsed_time = previous.elapsed_time,
+                 .elapsed_ticks = previous.elapsed_ticks + 4U,
+                 .time_scale = 2.0};
+  });
+
+  const auto current = ring.load();
+  EXPECT_EQ(10_ns, current.elapsed_time);
+  EXPECT_EQ(7U, current.elapsed_ticks);
+  EXPECT_EQ(2.0, current.time_scale);
+  EXPECT_EQ(0.5, ring.load(1U).time_scale);
+}
+
+TEST(epoch_ring, Clamp_accumulated_time_to_non_negative) {
+  const auto current = epoch{.elapsed_time = 30_ns, .time_scale = 2.0};
+  EXPECT_EQ(10_ns,
+            jage::engine::time::internal::accumulated_since(current, 20_ns));
+  EXPECT_EQ(0_ns,
+            jage::engine::time::internal::accumulated_since(current, 10_ns));
+}
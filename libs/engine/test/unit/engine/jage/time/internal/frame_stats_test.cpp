@@ -0,0 +1,124 @@
+#include <jage/engine/test/fakes/concurrency/atomic.hpp>
+#include <jage/engine/test/fakes/concurrency/double_buffer.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/frame_statistics.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+
+#include <jage/engine/time/internal/frame_stats.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+using jage::engine::time::durations::microseconds;
+using jage::engine::time::durations::milliseconds;
+using jage::engine::time::durations::operator""_ms;
+using jage::engine::time::events::frame_statistics;
+using jage::engine::time::events::snapshot;
+using jage::engine::time::internal::frame_stats;
+
+namespace fakes {
+using jage::engine::test::fakes::concurrency::atomic;
+using jage::engine::test::fakes::concurrency::double_buffer;
+} // namespace fakes
+
+template <std::size_t WindowSize>
+using stats = frame_stats<WindowSize, milliseconds, fakes::double_buffer,
+                          fakes::atomic>;
+
+class frame_stats_window : public ::testing::Test {
+protected:
+  stats<4UZ> frame_stats{};
+  std::uint64_t frame{};
+  milliseconds real_time{};
+
+  auto advance(const milliseconds &frame_time) -> void {
+    real_time += frame_time;
+    frame_stats.push(snapshot<milliseconds>{
+        .real_time = real_time,
+        .frame = frame++,
+    });
+  }
+};
+
+TEST(frame_stats_compile_time_queries,
+     Return_window_size_used_to_instantiate_template) {
+  static_assert(120UZ == stats<120UZ>::window_size());
+}
+
+TEST_F(frame_stats_window, Publish_empty_statistics_before_two_snapshots) {
+  frame_stats.publish();
+  EXPECT_EQ(frame_statistics<milliseconds>{}, frame_stats.read());
+  advance(16_ms);
+  frame_stats.publish();
+  EXPECT_EQ(0U, frame_stats.frame_count());
+  EXPECT_EQ(frame_statistics<milliseconds>{}, frame_stats.read());
+}
+
+TEST_F(frame_stats_window, Measure_frame_time_between_consecutive_snapshots) {
+  advance(0_ms);
+  advance(16_ms);
+  frame_stats.publish();
+  const auto statistics = frame_stats.read();
+  EXPECT_EQ(1U, statistics.frame_count);
+  EXPECT_DOUBLE_EQ(16.0, statistics.mean.count());
+  EXPECT_NEAR(16.0, statistics.p50.count(), 16.0 / 64.0);
+  EXPECT_NEAR(16.0, statistics.max.count(), 16.0 / 64.0);
+}
+
+TEST_F(frame_stats_window, Not_expose_unpublished_frames_to_readers) {
+  advance(0_ms);
+  advance(16_ms);
+  frame_stats.publish();
+  advance(33_ms);
+  EXPECT_EQ(2U, frame_stats.frame_count());
+  EXPECT_EQ(1U, frame_stats.read().frame_count);
+}
+
+TEST_F(frame_stats_window, Report_tail_percentiles_and_maximum) {
+  advance(0_ms);
+  advance(10_ms);
+  advance(10_ms);
+  advance(10_ms);
+  advance(40_ms);
+  frame_stats.publish();
+  const auto statistics = frame_stats.read();
+  EXPECT_EQ(4U, statistics.frame_count);
+  EXPECT_DOUBLE_EQ(17.5, statistics.mean.count());
+  EXPECT_NEAR(10.0, statistics.p50.count(), 10.0 / 64.0);
+  EXPECT_NEAR(40.0, statistics.p95.count(), 40.0 / 64.0);
+  EXPECT_NEAR(40.0, statistics.p99.count(), 40.0 / 64.0);
+  EXPECT_NEAR(40.0, statistics.max.count(), 40.0 / 64.0);
+}
+
+TEST_F(frame_stats_window, Evict_frames_older_than_window) {
+  advance(0_ms);
+  advance(100_ms);
+  for (auto index = 0U; index < 4U; ++index) {
+    advance(5_ms);
+  }
+  frame_stats.publish();
+  const auto statistics = frame_stats.read();
+  EXPECT_EQ(4U, statistics.frame_count);
+  EXPECT_DOUBLE_EQ(5.0, statistics.mean.count());
+  EXPECT_NEAR(5.0, statistics.max.count(), 5.0 / 64.0);
+}
+
+TEST_F(frame_stats_window, Keep_window_full_over_many_frames) {
+  advance(0_ms);
+  for (auto index = 0U; index < 1000U; ++index) {
+    advance(milliseconds{static_cast<double>(index % 8U)});
+  }
+  frame_stats.publish();
+  const auto statistics = frame_stats.read();
+  EXPECT_EQ(4U, statistics.frame_count);
+  EXPECT_DOUBLE_EQ((4.0 + 5.0 + 6.0 + 7.0) / 4.0, statistics.mean.count());
+  EXPECT_NEAR(7.0, statistics.max.count(), 7.0 / 64.0);
+}
+
+TEST_F(frame_stats_window, Resolve_sub_millisecond_frame_times) {
+  advance(0_ms);
+  advance(microseconds{250.0});
+  frame_stats.publish();
+  EXPECT_NEAR(0.25, frame_stats.read().p50.count(), 0.25 / 64.0);
+}
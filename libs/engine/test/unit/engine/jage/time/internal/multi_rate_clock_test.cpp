@@ -0,0 +1,118 @@
+#include <jage/engine/test/fakes/concurrency/atomic.hpp>
+#include <jage/engine/test/fakes/time/source.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+#include <jage/engine/time/hertz.hpp>
+
+#include <jage/engine/time/internal/clock.hpp>
+#include <jage/engine/time/internal/multi_rate_clock.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using time_source =
+    jage::engine::test::fakes::time::source<jage::engine::time::nanoseconds>;
+using jage::engine::time::nanoseconds;
+using jage::engine::time::operator""_Hz;
+using jage::engine::time::operator""_ns;
+using jage::engine::time::events::snapshot;
+
+namespace fakes {
+using jage::engine::test::fakes::concurrency::atomic;
+}
+
+using clock_type =
+    jage::engine::time::internal::multi_rate_clock<time_source, fakes::atomic,
+                                                   120U, 60U, 10U>;
+
+namespace {
+struct recording_cache {
+  std::vector<snapshot<nanoseconds>> snapshots{};
+  auto push(const snapshot<nanoseconds> &input_snapshot) -> void {
+    snapshots.push_back(input_snapshot);
+  }
+};
+} // namespace
+
+class multi_rate_clock_queries : public ::testing::Test {
+protected:
+  clock_type clock{};
+
+  auto SetUp() -> void override { time_source::current_time = 0_ns; }
+};
+
+TEST_F(multi_rate_clock_queries, Report_tick_duration_for_every_rate) {
+  static_assert(3UZ == clock_type::rate_count());
+  EXPECT_NEAR(8333333.333333333, clock_type::tick_durations()[0].count(),
+              1e-6);
+  EXPECT_NEAR(16666666.666666666, clock_type::tick_durations()[1].count(),
+              1e-6);
+  EXPECT_NEAR(100000000.0, clock_type::tick_durations()[2].count(), 1e-6);
+}
+
+TEST_F(multi_rate_clock_queries, Tick_each_rate_from_one_time_reading) {
+  time_source::current_time = 250'000'000_ns;
+  EXPECT_EQ((clock_type::ticks_type{30U, 15U, 2U}), clock.ticks());
+
+  const auto snapshots = clock.snapshot();
+  for (const auto &rate_snapshot : snapshots) {
+    EXPECT_EQ(250'000'000_ns, rate_snapshot.real_time);
+  }
+  EXPECT_EQ(30U, snapshots[0].frame);
+  EXPECT_EQ(15U, snapshots[1].frame);
+  EXPECT_EQ(2U, snapshots[2].frame);
+  EXPECT_NEAR(0.0, snapshots[0].accumulated_time.count(), 1e-3);
+  EXPECT_NEAR(0.0, snapshots[1].accumulated_time.count(), 1e-3);
+  EXPECT_NEAR(50'000'000.0, snapshots[2].accumulated_time.count(), 1e-3);
+}
+
+TEST_F(multi_rate_clock_queries, Match_single_rate_clock_snapshots) {
+  auto reference = jage::engine::time::internal::clock<time_source>{60_Hz};
+  time_source::current_time = 1'234'567'891_ns;
+  EXPECT_EQ(reference.snapshot(), clock.snapshot()[1]);
+  reference.set_time_scale(0.5);
+  clock.set_time_scale(0.5);
+  time_source::current_time += 100'000'000_ns;
+  EXPECT_EQ(reference.snapshot(), clock.snapshot()[1]);
+}
+
+TEST_F(multi_rate_clock_queries, Scale_every_rate_together) {
+  time_source::current_time = 100'000'000_ns;
+  clock.set_time_scale(0.0);
+  time_source::current_time += 1'000'000'000_ns;
+  EXPECT_EQ((clock_type::ticks_type{12U, 6U, 1U}), clock.ticks());
+
+  clock.set_time_scale(2.0);
+  time_source::current_time += 100'000'000_ns;
+  const auto snapshots = clock.snapshot();
+  EXPECT_EQ(2.0, snapshots[0].time_scale);
+  EXPECT_EQ((clock_type::ticks_type{12U, 6U, 1U}),
+            (clock_type::ticks_type{snapshots[0].elapsed_frames,
+                                    snapshots[1].elapsed_frames,
+                                    snapshots[2].elapsed_frames}));
+  EXPECT_EQ((clock_type::ticks_type{36U, 18U, 3U}), clock.ticks());
+}
+
+TEST_F(multi_rate_clock_queries, Refuse_negative_time_scale) {
+  EXPECT_THROW(clock.set_time_scale(-1.0), std::invalid_argument);
+}
+
+TEST_F(multi_rate_clock_queries, Push_each_rate_into_its_own_cache) {
+  auto physics = recording_cache{};
+  auto gameplay = recording_cache{};
+  auto ai = recording_cache{};
+  time_source::current_time = 150'000'000_ns;
+  const auto snapshots = clock.push(physics, gameplay, ai);
+  ASSERT_EQ(1UZ, physics.snapshots.size());
+  ASSERT_EQ(1UZ, gameplay.snapshots.size());
+  ASSERT_EQ(1UZ, ai.snapshots.size());
+  EXPECT_EQ(snapshots[0], physics.snapshots.front());
+  EXPECT_EQ(snapshots[1], gameplay.snapshots.front());
+  EXPECT_EQ(snapshots[2], ai.snapshots.front());
+  EXPECT_EQ(18U, physics.snapshots.front().frame);
+  EXPECT_EQ(9U, gameplay.snapshots.front().frame);
+  EXPECT_EQ(1U, ai.snapshots.front().frame);
+}
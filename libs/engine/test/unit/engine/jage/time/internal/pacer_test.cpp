@@ -0,0 +1,138 @@
+#include <jage/engine/test/fakes/time/sleeper.hpp>
+#include <jage/engine/test/fakes/time/source.hpp>
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+#include <jage/engine/time/hertz.hpp>
+
+#include <jage/engine/time/internal/pacer.hpp>
+
+#include <gtest/gtest.h>
+
+using time_source =
+    jage::engine::test::fakes::time::source<jage::engine::time::nanoseconds>;
+using sleeper = jage::engine::test::fakes::time::sleeper<time_source>;
+using pacer = jage::engine::time::internal::pacer<time_source, sleeper>;
+using snapshot =
+    jage::engine::time::events::snapshot<jage::engine::time::nanoseconds>;
+using jage::engine::time::operator""_ns;
+using jage::engine::time::operator""_ms;
+using jage::engine::time::operator""_Hz;
+
+class pacer_wait : public ::testing::Test {
+protected:
+  pacer sut{100_Hz, 1_ms};
+
+  auto SetUp() -> void override {
+    sleeper::reset();
+    sleeper::relax_step = 10_ns;
+    time_source::current_time = 5_ms;
+  }
+
+  [[nodiscard]] static auto current_snapshot() -> snapshot {
+    return {.real_time = time_source::current_time};
+  }
+};
+
+TEST_F(pacer_wait, Use_period_of_target_frequency) {
+  EXPECT_EQ(10_ms, sut.period());
+  EXPECT_EQ(1_ms, sut.margin());
+}
+
+TEST_F(pacer_wait, Clamp_initial_margin_to_half_period) {
+  const auto fast_pacer = pacer{1000_Hz, 5_ms};
+  EXPECT_EQ(fast_pacer.period() / 2, fast_pacer.margin());
+}
+
+TEST_F(pacer_wait, Schedule_first_deadline_one_period_after_snapshot) {
+  EXPECT_EQ(15_ms, sut.wait(current_snapshot()));
+  EXPECT_EQ(25_ms, sut.next_deadline());
+}
+
+TEST_F(pacer_wait, Sleep_until_margin_before_deadline) {
+  std::ignore = sut.wait(current_snapshot());
+  EXPECT_EQ(1U, sleeper::sleep_count);
+  EXPECT_EQ(14_ms, sleeper::last_sleep_target);
+}
+
+TEST_F(pacer_wait, Spin_from_wake_up_until_deadline) {
+  std::ignore = sut.wait(current_snapshot());
+  EXPECT_EQ(100'000U, sleeper::relax_count);
+  EXPECT_LE(15_ms, time_source::current_time);
+}
+
+TEST_F(pacer_wait, Not_spin_when_waking_after_deadline) {
+  sleeper::wake_up_lateness = 2_ms;
+  std::ignore = sut.wait(current_snapshot());
+  EXPECT_EQ(0U, sleeper::relax_count);
+  EXPECT_EQ(16_ms, time_source::current_time);
+}
+
+TEST_F(pacer_wait, Keep_cadence_across_frames) {
+  std::ignore = sut.wait(current_snapshot());
+  time_source::current_time += 3_ms;
+  EXPECT_EQ(25_ms, sut.wait(current_snapshot()));
+  EXPECT_EQ(35_ms, sut.next_deadline());
+}
+
+TEST_F(pacer_wait, Spin_without_sleeping_when_inside_margin) {
+  auto bounded_pacer = pacer{100_Hz, 1_ms, 1_ms};
+  std::ignore = bounded_pacer.wait(current_snapshot());
+  time_source::current_time = 24.5_ms;
+  EXPECT_EQ(25_ms, bounded_pacer.wait(current_snapshot()));
+  EXPECT_EQ(1U, sleeper::sleep_count);
+}
+
+TEST_F(pacer_wait, Return_immediately_when_deadline_was_missed) {
+  std::ignore = sut.wait(current_snapshot());
+  time_source::current_time = 27_ms;
+  const auto relax_count = sleeper::relax_count;
+  EXPECT_EQ(25_ms, sut.wait(current_snapshot()));
+  EXPECT_EQ(1U, sleeper::sleep_count);
+  EXPECT_EQ(relax_count, sleeper::relax_count);
+  EXPECT_EQ(35_ms, sut.next_deadline());
+}
+
+TEST_F(pacer_wait, Resynchronize_after_falling_a_full_period_behind) {
+  std::ignore = sut.wait(current_snapshot());
+  time_source::current_time = 100_ms;
+  EXPECT_EQ(110_ms, sut.wait(current_snapshot()));
+  EXPECT_EQ(120_ms, sut.next_deadline());
+}
+
+TEST_F(pacer_wait, Grow_margin_when_waking_late) {
+  sleeper::wake_up_lateness = 2_ms;
+  for (auto frame = 0; frame < 8; ++frame) {
+    std::ignore = sut.wait(current_snapshot());
+  }
+  EXPECT_LT(2_ms, sut.margin());
+}
+
+TEST_F(pacer_wait, Shrink_margin_when_waking_on_time) {
+  for (auto frame = 0; frame < 64; ++frame) {
+    std::ignore = sut.wait(current_snapshot());
+  }
+  EXPECT_GT(1_ms, sut.margin());
+  EXPECT_LE(0_ns, sut.margin());
+}
+
+TEST_F(pacer_wait, Never_shrink_margin_below_minimum) {
+  auto bounded_pacer = pacer{100_Hz, 1_ms, 0.5_ms};
+  for (auto frame = 0; frame < 64; ++frame) {
+    std::ignore = bounded_pacer.wait(current_snapshot());
+  }
+  EXPECT_EQ(0.5_ms, bounded_pacer.margin());
+}
+
+TEST_F(pacer_wait, Recover_margin_after_one_late_wake_up) {
+  sleeper::wake_up_lateness = 50_ms;
+  std::ignore = sut.wait(current_snapshot());
+  EXPECT_GT(sut.period(), sut.margin());
+
+  sleeper::wake_up_lateness = 0_ns;
+  for (auto frame = 0; frame < 64; ++frame) {
+    time_source::current_time = sut.next_deadline() - 4_ms;
+    std::ignore = sut.wait(current_snapshot());
+  }
+  EXPECT_GT(1_ms, sut.margin());
+  EXPECT_LT(1U, sleeper::sleep_count);
+}
@@ -1,3 +1,4 @@
+#include <jage/engine/concurrency/double_buffer.hpp>
 #include <jage/engine/test/fakes/concurrency/atomic.hpp>
 #include <jage/engine/test/fakes/concurrency/double_buffer.hpp>
 #include <jage/engine/test/mocks/concurrency/atomic.hpp>
@@ -11,6 +12,9 @@
 #include <gtest/gtest.h>
 
 #include <atomic>
+#include <cstdint>
+#include <thread>
+#include <tuple>
 
 using jage::engine::time::cache_match_status;
 using jage::engine::time::durations::nanoseconds;
@@ -128,6 +132,103 @@ TEST_F(snapshot_store_and_retrieve,
   EXPECT_EQ(cache_match_status::ahead, status);
 }
 
+TEST_F(snapshot_store_and_retrieve, Return_most_recently_pushed_as_latest) {
+  EXPECT_EQ(123_ns, cache.latest().real_time);
+  EXPECT_EQ(2, cache.latest().frame);
+  cache.push(snapshot<nanoseconds>{
+      .real_time = 140_ns,
+      .frame = 3,
+  });
+  EXPECT_EQ(140_ns, cache.latest().real_time);
+  EXPECT_EQ(3, cache.latest().frame);
+}
+
+TEST_F(snapshot_store_and_retrieve, Count_every_push_in_write_index) {
+  EXPECT_EQ(3U, cache.write_index());
+  cache.push(snapshot<nanoseconds>{
+      .real_time = 140_ns,
+      .frame = 3,
+  });
+  EXPECT_EQ(4U, cache.write_index());
+}
+
+TEST_F(snapshot_store_and_retrieve, Read_snapshot_by_unwrapped_write_index) {
+  cache.push(snapshot<nanoseconds>{
+      .real_time = 140_ns,
+      .frame = 3,
+  });
+  EXPECT_EQ(3, cache.read(3U).frame);
+  EXPECT_EQ(1, cache.read(1U).frame);
+  EXPECT_EQ(3, cache.read(0U).frame);
+}
+
+TEST_F(snapshot_store_and_retrieve,
+       Return_published_frame_without_waiting_when_already_pushed) {
+  const auto &[snap, status] = cache.wait_for_frame(1);
+  EXPECT_EQ(110_ns, snap.real_time);
+  EXPECT_EQ(1, snap.frame);
+  EXPECT_EQ(cache_match_status::matched, status);
+}
+
+TEST_F(snapshot_store_and_retrieve,
+       Report_eviction_when_waited_for_frame_was_overwritten) {
+  cache.push(snapshot<nanoseconds>{
+      .real_time = 140_ns,
+      .frame = 3,
+  });
+  const auto &[snap, status] = cache.wait_for_frame(0);
+  EXPECT_EQ(1, snap.frame);
+  EXPECT_EQ(cache_match_status::evicted, status);
+}
+
+TEST(snapshot_cache_latest, Return_default_snapshot_before_first_push) {
+  const auto cache = snapshot_cache<4UZ, snapshot<nanoseconds>,
+                                    fakes::double_buffer, fakes::atomic>{};
+  EXPECT_EQ(snapshot<nanoseconds>{}, cache.latest());
+}
+
+TEST(snapshot_cache_wait_for_frame, Block_until_frame_is_published) {
+  auto cache = snapshot_cache<4UZ, snapshot<nanoseconds>,
+                              jage::engine::concurrency::double_buffer,
+                              std::atomic>{};
+  auto producer = std::jthread{[&cache] {
+    for (auto frame = std::uint64_t{}; frame < 64U; ++frame) {
+      cache.push(snapshot<nanoseconds>{
+          .real_time = nanoseconds{static_cast<double>(frame)},
+          .frame = frame,
+      });
+      std::this_thread::yield();
+    }
+  }};
+  const auto &[snap, status] = cache.wait_for_frame(63);
+  EXPECT_EQ(63, snap.frame);
+  EXPECT_EQ(cache_match_status::matched, status);
+}
+
+TEST(snapshot_cache_wait_for_frame, Compare_frames_when_cache_starts_mid_run) {
+  auto cache = snapshot_cache<4UZ, snapshot<nanoseconds>,
+                              jage::engine::concurrency::double_buffer,
+                              std::atomic>{};
+  auto producer = std::jthread{[&cache] {
+    for (auto frame = std::uint64_t{1000U}; frame < 1010U; frame += 3U) {
+      cache.push(snapshot<nanoseconds>{
+          .real_time = nanoseconds{static_cast<double>(frame)},
+          .frame = frame,
+      });
+      std::this_thread::yield();
+    }
+  }};
+  const auto &[snap, status] = cache.wait_for_frame(1005);
+  EXPECT_EQ(1003, snap.frame);
+  EXPECT_EQ(cache_match_status::matched, status);
+  producer.join();
+
+  const auto &[skipped, skipped_status] = cache.find(1007);
+  EXPECT_EQ(1006, skipped.frame);
+  EXPECT_EQ(cache_match_status::matched, skipped_status);
+  EXPECT_EQ(cache_match_status::ahead, cache.find(1010).second);
+}
+
 TEST_F(
     snapshot_store_and_retrieve,
     Find_correct_snapshot_by_timestamp_after_oldest_snapshot_has_been_dropped) {
@@ -187,6 +288,7 @@ protected:
     EXPECT_CALL(mock, mock_store(1UZ, std::memory_order::release)).Times(1);
     EXPECT_CALL(mock, mock_store(2UZ, std::memory_order::release)).Times(1);
     EXPECT_CALL(mock, mock_store(3UZ, std::memory_order::release)).Times(1);
+    EXPECT_CALL(mock, mock_notify_all()).Times(3);
     cache.push(snapshot<nanoseconds>{
         .real_time = 99_ns,
         .frame = 0,
@@ -225,3 +327,35 @@ TEST_F(snapshot_atomic_operations,
   EXPECT_EQ(99_ns, snap.real_time);
   EXPECT_EQ(0, snap.frame);
 }
+
+TEST_F(snapshot_atomic_operations, Atomically_load_write_index_once_on_latest) {
+  using testing::Return;
+  auto &mock = *mocks::atomic<std::uint64_t>::get_instance();
+  EXPECT_CALL(mock, mock_load(std::memory_order::acquire))
+      .WillOnce(Return(3UZ));
+  const auto snap = cache.latest();
+  EXPECT_EQ(105_ns, snap.real_time);
+  EXPECT_EQ(2, snap.frame);
+}
+
+TEST_F(snapshot_atomic_operations,
+       Wait_on_write_index_until_frame_is_published) {
+  using testing::Return;
+  auto &mock = *mocks::atomic<std::uint64_t>::get_instance();
+  EXPECT_CALL(mock, mock_load(std::memory_order::acquire))
+      .WillOnce(Return(3UZ))
+      .WillOnce(Return(3UZ))
+      .WillRepeatedly(Return(4UZ));
+  EXPECT_CALL(mock, mock_store(4UZ, std::memory_order::release)).Times(1);
+  EXPECT_CALL(mock, mock_notify_all()).Times(1);
+  EXPECT_CALL(mock, mock_wait(3UZ, std::memory_order::acquire))
+      .WillOnce([this] {
+        cache.push(snapshot<nanoseconds>{
+            .real_time = 110_ns,
+            .frame = 3,
+        });
+      });
+  const auto &[snap, status] = cache.wait_for_frame(3);
+  EXPECT_EQ(3, snap.frame);
+  EXPECT_EQ(cache_match_status::matched, status);
+}
@@ -0,0 +1,29 @@
+#include <jage/engine/time/durations.hpp>
+
+#include <jage/engine/time/internal/steady_clock.hpp>
+#include <jage/engine/time/internal/steady_sleeper.hpp>
+
+#include <gtest/gtest.h>
+
+using jage::engine::time::operator""_ms;
+using steady_clock =
+    jage::engine::time::internal::steady_clock<jage::engine::time::nanoseconds>;
+using steady_sleeper = jage::engine::time::internal::steady_sleeper<
+    jage::engine::time::nanoseconds>;
+
+TEST(steady_sleeper_sleep_until, Wake_up_at_or_after_absolute_deadline) {
+  const auto deadline = steady_clock::now().time_since_epoch() + 1_ms;
+  steady_sleeper::sleep_until(deadline);
+  EXPECT_LE(deadline, steady_clock::now().time_since_epoch());
+}
+
+TEST(steady_sleeper_sleep_until, Return_immediately_for_deadline_in_the_past) {
+  const auto start = steady_clock::now().time_since_epoch();
+  steady_sleeper::sleep_until(start - 1_ms);
+  EXPECT_GT(start + 1000_ms, steady_clock::now().time_since_epoch());
+}
+
+TEST(steady_sleeper_relax, Return_control_to_caller) {
+  steady_sleeper::relax();
+  SUCCEED();
+}
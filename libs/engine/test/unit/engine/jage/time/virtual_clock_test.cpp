@@ -0,0 +1,75 @@
+#include <jage/engine/time/durations.hpp>
+#include <jage/engine/time/events/snapshot.hpp>
+#include <jage/engine/time/hertz.hpp>
+#include <jage/engine/time/virtual_clock.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <vector>
+
+using jage::engine::time::nanoseconds;
+using jage::engine::time::operator""_Hz;
+using jage::engine::time::operator""_ns;
+using jage::engine::time::virtual_clock;
+using jage::engine::time::virtual_time_source;
+using jage::engine::time::events::snapshot;
+
+namespace {
+auto simulate(const std::size_t frame_count)
+    -> std::vector<snapshot<nanoseconds>> {
+  auto clock = virtual_clock<nanoseconds>{60_Hz};
+  auto snapshots = std::vector<snapshot<nanoseconds>>{};
+  for (auto frame = 0UZ; frame < frame_count; ++frame) {
+    clock.time_source().advance(clock.tick_duration());
+    if (frame == frame_count / 2UZ) {
+      clock.set_time_scale(2.0);
+    }
+    snapshots.push_back(clock.snapshot());
+  }
+  return snapshots;
+}
+} // namespace
+
+TEST(virtual_time_source, Start_at_zero_by_default) {
+  EXPECT_EQ(0_ns, virtual_time_source<nanoseconds>{}.now().time_since_epoch());
+}
+
+TEST(virtual_time_source, Start_at_given_time) {
+  EXPECT_EQ(42_ns,
+            virtual_time_source<nanoseconds>{42_ns}.now().time_since_epoch());
+}
+
+TEST(virtual_time_source, Move_forward_only_when_advanced) {
+  auto source = virtual_time_source<nanoseconds>{};
+  source.advance(10_ns);
+  source.advance(5_ns);
+  EXPECT_EQ(15_ns, source.now().time_since_epoch());
+}
+
+TEST(virtual_time_source, Refuse_to_move_backwards) {
+  auto source = virtual_time_source<nanoseconds>{10_ns};
+  EXPECT_THROW(source.advance(-1_ns), std::invalid_argument);
+  EXPECT_EQ(10_ns, source.now().time_since_epoch());
+}
+
+TEST(virtual_clock, Read_real_time_from_own_time_source) {
+  auto first = virtual_clock<nanoseconds>{60_Hz};
+  auto second = virtual_clock<nanoseconds>{
+      60_Hz, virtual_time_source<nanoseconds>{100_ns}};
+  first.time_source().advance(7_ns);
+  EXPECT_EQ(7_ns, first.real_time());
+  EXPECT_EQ(100_ns, second.real_time());
+}
+
+TEST(virtual_clock, Tick_once_per_tick_duration_advanced) {
+  auto clock = virtual_clock<nanoseconds>{60_Hz};
+  for (auto frame = 0U; frame < 100U; ++frame) {
+    clock.time_source().advance(clock.tick_duration());
+  }
+  EXPECT_EQ(100U, clock.snapshot().frame);
+}
+
+TEST(virtual_clock, Produce_identical_snapshot_sequences_for_identical_runs) {
+  EXPECT_EQ(simulate(1000UZ), simulate(1000UZ));
+}
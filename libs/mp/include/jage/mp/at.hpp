@@ -0,0 +1,10 @@
+#pragma once
+
+#include <jage/mp/internal/at.hpp>
+
+#include <cstddef>
+
+namespace jage::mp {
+template <class TList, std::size_t Index>
+using at = internal::at<TList, Index>::type;
+} // namespace jage::mp
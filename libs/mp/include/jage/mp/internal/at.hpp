@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+#include <tuple>
+
+namespace jage::mp::internal {
+
+template <class, std::size_t> struct at;
+
+template <template <class...> class TList, class... T, std::size_t Index>
+  requires(Index < sizeof...(T))
+struct at<TList<T...>, Index> {
+  using type = std::tuple_element_t<Index, std::tuple<T...>>;
+};
+
+} // namespace jage::mp::internal
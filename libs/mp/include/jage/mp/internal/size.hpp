@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+
+namespace jage::mp::internal {
+
+template <class> static constexpr std::size_t size = 0;
+
+template <template <class...> class TList, class... T>
+static constexpr std::size_t size<TList<T...>> = sizeof...(T);
+
+} // namespace jage::mp::internal
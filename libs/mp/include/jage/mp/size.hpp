@@ -0,0 +1,7 @@
+#pragma once
+
+#include <jage/mp/internal/size.hpp>
+
+namespace jage::mp {
+template <class TList> static constexpr auto size = internal::size<TList>;
+} // namespace jage::mp
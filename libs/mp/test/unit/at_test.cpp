@@ -0,0 +1,19 @@
+#include <jage/mp/at.hpp>
+#include <jage/mp/list.hpp>
+
+#include <gtest/gtest.h>
+
+#include <concepts>
+#include <tuple>
+
+struct foo {};
+struct bar {};
+
+TEST(jage_mp_at_test, should_return_type_at_index_in_list) {
+  using jage::mp::at;
+  using jage::mp::list;
+  static_assert(std::same_as<foo, at<list<foo, bar>, 0>>);
+  static_assert(std::same_as<bar, at<list<foo, bar>, 1>>);
+  static_assert(std::same_as<bar, at<list<foo, foo, bar>, 2>>);
+  static_assert(std::same_as<foo, at<std::tuple<bar, foo>, 1>>);
+}
@@ -0,0 +1,18 @@
+#include <jage/mp/list.hpp>
+#include <jage/mp/size.hpp>
+
+#include <gtest/gtest.h>
+
+#include <tuple>
+
+struct foo {};
+struct bar {};
+
+TEST(jage_mp_size_test, should_count_types_in_list) {
+  using jage::mp::list;
+  using jage::mp::size;
+  static_assert(0 == size<list<>>);
+  static_assert(1 == size<list<foo>>);
+  static_assert(3 == size<list<foo, bar, foo>>);
+  static_assert(2 == size<std::tuple<foo, bar>>);
+}